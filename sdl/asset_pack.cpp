@@ -0,0 +1,366 @@
+#include "asset_pack.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "bee/file_writer.hpp"
+
+using std::string;
+using std::string_view;
+
+namespace sdl {
+namespace {
+
+// Layout, all integers in native byte order:
+//
+//   Header
+//   uint32_t buckets[bucket_count]  entry index + 1, 0 when empty
+//   Record records[entry_count]     8 byte aligned
+//   names
+//   blobs                           each blob_alignment aligned
+//
+// Lookups hash the name and probe the buckets linearly from hash %
+// bucket_count, bucket_count being a power of two at least twice the number
+// of entries.
+
+constexpr char magic[8] = {'S', 'D', 'L', 'P', 'A', 'C', 'K', '\0'};
+constexpr uint32_t version = 1;
+constexpr size_t blob_alignment = 64;
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t entry_count;
+  uint32_t bucket_count;
+  uint32_t reserved;
+  uint64_t size;
+};
+
+struct Record {
+  uint64_t hash;
+  uint64_t data_offset;
+  uint64_t data_size;
+  uint32_t name_offset;
+  uint32_t name_size;
+  uint32_t kind;
+  uint32_t width;
+  uint32_t height;
+  uint32_t bytes_per_pixel;
+};
+
+static_assert(sizeof(Header) == 32);
+static_assert(sizeof(Record) == 48);
+
+// FNV-1a
+uint64_t hash_name(string_view name)
+{
+  uint64_t hash = 0xcbf29ce484222325;
+  for (char c : name) {
+    hash ^= uint8_t(c);
+    hash *= 0x100000001b3;
+  }
+  return hash;
+}
+
+size_t align_up(size_t offset, size_t alignment)
+{
+  return (offset + alignment - 1) / alignment * alignment;
+}
+
+size_t records_offset(uint32_t bucket_count)
+{
+  return align_up(sizeof(Header) + bucket_count * sizeof(uint32_t), 8);
+}
+
+// Reads through memcpy since a buffer isn't guaranteed to be aligned
+template <class T> T read_at(std::span<const std::byte> data, size_t offset)
+{
+  T value;
+  std::memcpy(&value, data.data() + offset, sizeof(T));
+  return value;
+}
+
+template <class T> void write_at(string& out, size_t offset, const T& value)
+{
+  std::memcpy(out.data() + offset, &value, sizeof(T));
+}
+
+bool valid_kind(uint32_t kind)
+{
+  return kind >= uint32_t(AssetKind::Image) &&
+         kind <= uint32_t(AssetKind::Data);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+// AssetPack
+//
+
+AssetPack::AssetPack(void* mapping, size_t size)
+    : _data(static_cast<const std::byte*>(mapping), size), _mapping(mapping)
+{}
+
+AssetPack::AssetPack(string&& buffer) : _buffer(std::move(buffer))
+{
+  _data = std::as_bytes(std::span(_buffer));
+}
+
+AssetPack::~AssetPack()
+{
+  if (_mapping != nullptr) { munmap(_mapping, _data.size()); }
+}
+
+bee::OrError<AssetPack::ptr> AssetPack::open(const bee::FilePath& path)
+{
+  int fd = ::open(path.data(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return EF("Failed to open $: $", path.to_string(), strerror(errno));
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    int err = errno;
+    close(fd);
+    return EF("Failed to stat $: $", path.to_string(), strerror(err));
+  }
+  size_t size = st.st_size;
+  if (size < sizeof(Header)) {
+    close(fd);
+    return EF("Not an asset pack: $", path.to_string());
+  }
+  void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  int err = errno;
+  // The mapping keeps the file alive
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    return EF("Failed to map $: $", path.to_string(), strerror(err));
+  }
+  // Assets are read at startup, let the kernel start reading all of it
+  madvise(mapping, size, MADV_WILLNEED);
+
+  ptr pack(new AssetPack(mapping, size));
+  bail_unit(pack->_read_header());
+  return pack;
+}
+
+bee::OrError<AssetPack::ptr> AssetPack::of_buffer(string&& buffer)
+{
+  ptr pack(new AssetPack(std::move(buffer)));
+  bail_unit(pack->_read_header());
+  return pack;
+}
+
+bee::OrError<> AssetPack::_read_header()
+{
+  if (_data.size() < sizeof(Header)) { return EF("Not an asset pack"); }
+  auto header = read_at<Header>(_data, 0);
+  if (std::memcmp(header.magic, magic, sizeof(magic)) != 0) {
+    return EF("Not an asset pack");
+  }
+  if (header.version != version) {
+    return EF("Unsupported asset pack version: $", header.version);
+  }
+  if (header.size != _data.size()) {
+    return EF("Asset pack is $ bytes, expected $", _data.size(), header.size);
+  }
+  if (!std::has_single_bit(header.bucket_count) ||
+      header.bucket_count < header.entry_count * 2) {
+    return EF("Invalid asset pack bucket count: $", header.bucket_count);
+  }
+  size_t records_end = records_offset(header.bucket_count) +
+                       size_t(header.entry_count) * sizeof(Record);
+  if (records_end > _data.size()) { return EF("Truncated asset pack"); }
+
+  // Everything is checked once here so lookups can trust the offsets
+  for (uint32_t i = 0; i < header.bucket_count; i++) {
+    auto bucket =
+      read_at<uint32_t>(_data, sizeof(Header) + i * sizeof(uint32_t));
+    if (bucket > header.entry_count) {
+      return EF("Invalid asset pack bucket: $", bucket);
+    }
+  }
+  for (uint32_t i = 0; i < header.entry_count; i++) {
+    auto record = read_at<Record>(
+      _data, records_offset(header.bucket_count) + i * sizeof(Record));
+    if (!valid_kind(record.kind)) {
+      return EF("Invalid asset kind: $", record.kind);
+    }
+    if (size_t(record.name_offset) + record.name_size > _data.size() ||
+        record.data_offset > _data.size() ||
+        record.data_size > _data.size() - record.data_offset) {
+      return EF("Asset pack entry $ is out of bounds", i);
+    }
+    if (record.kind == uint32_t(AssetKind::Image) &&
+        uint64_t(record.width) * record.height * record.bytes_per_pixel !=
+          record.data_size) {
+      return EF("Image size doesn't match its dimensions");
+    }
+  }
+
+  _entry_count = header.entry_count;
+  _bucket_count = header.bucket_count;
+  return bee::ok();
+}
+
+AssetPack::Entry AssetPack::entry(size_t index) const
+{
+  auto record = read_at<Record>(
+    _data, records_offset(_bucket_count) + index * sizeof(Record));
+  return {
+    .kind = AssetKind(record.kind),
+    .name = string_view(
+      reinterpret_cast<const char*>(_data.data()) + record.name_offset,
+      record.name_size),
+    .data = _data.subspan(record.data_offset, record.data_size),
+    .width = int(record.width),
+    .height = int(record.height),
+    .bytes_per_pixel = int(record.bytes_per_pixel),
+  };
+}
+
+std::optional<AssetPack::Entry> AssetPack::find(string_view name) const
+{
+  if (_bucket_count == 0) { return std::nullopt; }
+  uint64_t hash = hash_name(name);
+  uint32_t mask = _bucket_count - 1;
+  for (uint32_t probe = 0; probe < _bucket_count; probe++) {
+    size_t bucket = (hash + probe) & mask;
+    auto index =
+      read_at<uint32_t>(_data, sizeof(Header) + bucket * sizeof(uint32_t));
+    if (index == 0) { break; }
+    auto record_hash = read_at<uint64_t>(
+      _data, records_offset(_bucket_count) + (index - 1) * sizeof(Record));
+    if (record_hash != hash) { continue; }
+    auto e = entry(index - 1);
+    if (e.name == name) { return e; }
+  }
+  return std::nullopt;
+}
+
+bee::OrError<RawImage> AssetPack::image(string_view name) const
+{
+  auto e = find(name);
+  if (!e.has_value() || e->kind != AssetKind::Image) {
+    return EF("No image named $ in asset pack", name);
+  }
+  return RawImage(e->width, e->height, e->bytes_per_pixel, e->data);
+}
+
+bee::OrError<std::span<const std::byte>> AssetPack::blob(
+  string_view name, AssetKind kind) const
+{
+  auto e = find(name);
+  if (!e.has_value() || e->kind != kind) {
+    return EF("No asset named $ of kind $ in asset pack", name, int(kind));
+  }
+  return e->data;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// AssetPackWriter
+//
+
+void AssetPackWriter::add_image(string name, const RawImage& img)
+{
+  auto pixels = img.pixels();
+  _assets.push_back({
+    .name = std::move(name),
+    .kind = AssetKind::Image,
+    .data = string(reinterpret_cast<const char*>(pixels.data()), pixels.size()),
+    .width = img.width,
+    .height = img.height,
+    .bytes_per_pixel = img.bytes_per_pixel,
+  });
+}
+
+void AssetPackWriter::add(string name, AssetKind kind, string data)
+{
+  _assets.push_back(
+    {.name = std::move(name), .kind = kind, .data = std::move(data)});
+}
+
+bee::OrError<string> AssetPackWriter::serialize() const
+{
+  uint32_t entry_count = _assets.size();
+  uint32_t bucket_count = std::bit_ceil(std::max<uint32_t>(entry_count * 2, 1));
+
+  size_t names_offset = records_offset(bucket_count) +
+                        size_t(entry_count) * sizeof(Record);
+  size_t size = names_offset;
+  for (const auto& asset : _assets) { size += asset.name.size(); }
+
+  std::vector<Record> records;
+  for (const auto& asset : _assets) {
+    size = align_up(size, blob_alignment);
+    records.push_back({
+      .hash = hash_name(asset.name),
+      .data_offset = size,
+      .data_size = asset.data.size(),
+      .name_offset = 0,
+      .name_size = uint32_t(asset.name.size()),
+      .kind = uint32_t(asset.kind),
+      .width = uint32_t(asset.width),
+      .height = uint32_t(asset.height),
+      .bytes_per_pixel = uint32_t(asset.bytes_per_pixel),
+    });
+    size += asset.data.size();
+  }
+
+  string out(size, '\0');
+  write_at(
+    out,
+    0,
+    Header{
+      .magic = {},
+      .version = version,
+      .entry_count = entry_count,
+      .bucket_count = bucket_count,
+      .reserved = 0,
+      .size = size,
+    });
+  std::memcpy(out.data(), magic, sizeof(magic));
+
+  std::vector<uint32_t> buckets(bucket_count, 0);
+  size_t name_offset = names_offset;
+  for (uint32_t i = 0; i < entry_count; i++) {
+    const auto& asset = _assets[i];
+    auto& record = records[i];
+    record.name_offset = name_offset;
+    std::memcpy(out.data() + name_offset, asset.name.data(), asset.name.size());
+    name_offset += asset.name.size();
+    std::memcpy(
+      out.data() + record.data_offset, asset.data.data(), asset.data.size());
+
+    size_t bucket = record.hash & (bucket_count - 1);
+    while (buckets[bucket] != 0) {
+      if (_assets[buckets[bucket] - 1].name == asset.name) {
+        return EF("Duplicate asset name: $", asset.name);
+      }
+      bucket = (bucket + 1) & (bucket_count - 1);
+    }
+    buckets[bucket] = i + 1;
+  }
+  std::memcpy(
+    out.data() + sizeof(Header),
+    buckets.data(),
+    buckets.size() * sizeof(uint32_t));
+  for (uint32_t i = 0; i < entry_count; i++) {
+    write_at(
+      out, records_offset(bucket_count) + i * sizeof(Record), records[i]);
+  }
+  return out;
+}
+
+bee::OrError<> AssetPackWriter::write(const bee::FilePath& path) const
+{
+  bail(data, serialize());
+  return bee::FileWriter::save_file(path, data);
+}
+
+} // namespace sdl
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "raw_image.hpp"
+
+#include "bee/file_path.hpp"
+#include "bee/or_error.hpp"
+
+namespace sdl {
+
+enum class AssetKind : uint32_t {
+  Image = 1,
+  Font = 2,
+  Data = 3,
+};
+
+// Read only archive of named assets. The file starts with a header and a hash
+// table indexing the entries by name, followed by the blobs, each aligned so
+// it can be used in place. Opening maps the whole file, so entries are views
+// into the mapping and a texture or font made from them reads the bytes
+// straight from the page cache.
+struct AssetPack {
+ public:
+  using ptr = std::unique_ptr<AssetPack>;
+
+  struct Entry {
+    AssetKind kind;
+    std::string_view name;
+    std::span<const std::byte> data;
+
+    // Images only, data holds the pixels row by row
+    int width = 0;
+    int height = 0;
+    int bytes_per_pixel = 0;
+  };
+
+  ~AssetPack();
+
+  AssetPack(const AssetPack& other) = delete;
+  AssetPack(AssetPack&& other) = delete;
+
+  static bee::OrError<ptr> open(const bee::FilePath& path);
+
+  // Reads a pack held in memory instead of a file
+  static bee::OrError<ptr> of_buffer(std::string&& buffer);
+
+  size_t size() const { return _entry_count; }
+
+  // Entries in the order they were added to the writer
+  Entry entry(size_t index) const;
+
+  std::optional<Entry> find(std::string_view name) const;
+
+  // Views into the pack, which must outlive them
+  bee::OrError<RawImage> image(std::string_view name) const;
+  bee::OrError<std::span<const std::byte>> blob(
+    std::string_view name, AssetKind kind) const;
+
+ private:
+  AssetPack(void* mapping, size_t size);
+  explicit AssetPack(std::string&& buffer);
+
+  bee::OrError<> _read_header();
+
+  std::span<const std::byte> _data;
+  uint32_t _entry_count = 0;
+  uint32_t _bucket_count = 0;
+
+  // Set when opened from a file
+  void* _mapping = nullptr;
+
+  // Set when opened from a buffer
+  std::string _buffer;
+};
+
+// Builds asset packs, see pack_assets_main.cpp for the command line tool
+struct AssetPackWriter {
+ public:
+  void add_image(std::string name, const RawImage& img);
+  void add(std::string name, AssetKind kind, std::string data);
+
+  // Fails if two assets have the same name
+  bee::OrError<std::string> serialize() const;
+
+  bee::OrError<> write(const bee::FilePath& path) const;
+
+ private:
+  struct Asset {
+    std::string name;
+    AssetKind kind;
+    std::string data;
+    int width = 0;
+    int height = 0;
+    int bytes_per_pixel = 0;
+  };
+
+  std::vector<Asset> _assets;
+};
+
+} // namespace sdl
@@ -0,0 +1,93 @@
+#include "asset_pack.hpp"
+
+#include <string>
+
+#include "bee/testing.hpp"
+
+namespace sdl {
+namespace {
+
+std::string to_string(std::span<const std::byte> data)
+{
+  return std::string(reinterpret_cast<const char*>(data.data()), data.size());
+}
+
+template <class T> void print_error(const bee::OrError<T>& result)
+{
+  if (result.is_error()) {
+    P("error: $", result.error());
+  } else {
+    P("ok");
+  }
+}
+
+AssetPackWriter make_writer()
+{
+  AssetPackWriter writer;
+  writer.add_image("squares", RawImage(2, 1, 3, std::string("abcdef")));
+  writer.add("font", AssetKind::Font, "not really a font");
+  writer.add("level.cof", AssetKind::Data, "[[0 0] []]");
+  for (int i = 0; i < 20; i++) {
+    writer.add("blob" + std::to_string(i), AssetKind::Data, std::to_string(i));
+  }
+  return writer;
+}
+
+TEST(round_trip)
+{
+  must(data, make_writer().serialize());
+  must(pack, AssetPack::of_buffer(std::move(data)));
+  P("entries:$", pack->size());
+  for (size_t i = 0; i < 3; i++) {
+    auto e = pack->entry(i);
+    P("$ kind:$ data:'$' aligned:$",
+      e.name,
+      int(e.kind),
+      to_string(e.data),
+      (e.data.data() - pack->entry(0).data.data()) % 64 == 0);
+  }
+
+  must(img, pack->image("squares"));
+  P("image $x$x$ owns:$ pixels:'$'",
+    img.width,
+    img.height,
+    img.bytes_per_pixel,
+    img.owns_pixels(),
+    to_string(img.pixels()));
+
+  must(font, pack->blob("font", AssetKind::Font));
+  P("font:'$'", to_string(font));
+
+  bool all_found = true;
+  for (int i = 0; i < 20; i++) {
+    auto e = pack->find("blob" + std::to_string(i));
+    all_found &= e.has_value() && to_string(e->data) == std::to_string(i);
+  }
+  P("all blobs found:$", all_found);
+
+  P("missing:$", pack->find("blob20").has_value());
+  print_error(pack->image("font"));
+  print_error(pack->blob("squares", AssetKind::Data));
+}
+
+TEST(errors)
+{
+  AssetPackWriter writer;
+  writer.add("a", AssetKind::Data, "1");
+  writer.add("a", AssetKind::Data, "2");
+  print_error(writer.serialize());
+
+  must(data, make_writer().serialize());
+  print_error(AssetPack::of_buffer(data.substr(0, 16)));
+  print_error(AssetPack::of_buffer("SDLPACKX" + data.substr(8)));
+  print_error(AssetPack::of_buffer(data.substr(0, data.size() - 1)));
+
+  must(empty, AssetPackWriter().serialize());
+  must(empty_pack, AssetPack::of_buffer(std::move(empty)));
+  P("empty entries:$ found:$",
+    empty_pack->size(),
+    empty_pack->find("a").has_value());
+}
+
+} // namespace
+} // namespace sdl
@@ -13,6 +13,13 @@ struct Color {
   constexpr static Color black() { return {0, 0, 0, 255}; }
 
   SDL_Color to_sdl_color() const { return {r, g, b, a}; }
+
+  constexpr uint32_t to_rgba32() const
+  {
+    return (uint32_t(r) << 24) | (uint32_t(g) << 16) | (uint32_t(b) << 8) | a;
+  }
+
+  bool operator==(const Color& other) const = default;
 };
 
 } // namespace sdl
@@ -0,0 +1,287 @@
+#include "command_buffer.hpp"
+
+#include <array>
+#include <cassert>
+
+#include "sdl_error.hpp"
+
+namespace sdl {
+
+namespace {
+
+// Key layout, most significant first:
+//   16 bits layer (biased so negative layers sort first)
+//    8 bits blend mode
+//    8 bits command kind
+//   32 bits texture id for copies, RGBA for fills, 0 for gradients
+uint64_t make_key(int layer, uint8_t blend, uint8_t kind, uint32_t resource)
+{
+  uint64_t biased_layer = uint16_t(layer + 0x8000);
+  return (biased_layer << 48) | (uint64_t(blend) << 40) |
+         (uint64_t(kind) << 32) | resource;
+}
+
+uint8_t texture_blend_key(SDL_Texture* texture)
+{
+  SDL_BlendMode mode = SDL_BLENDMODE_NONE;
+  SDL_GetTextureBlendMode(texture, &mode);
+  return uint8_t(mode);
+}
+
+SDL_FRect to_sdl_frect(const Rectf& r)
+{
+  return {.x = r.pos.x, .y = r.pos.y, .w = r.size.x, .h = r.size.y};
+}
+
+SDL_Rect to_sdl_rect(const Recti& r)
+{
+  return {.x = r.pos.x, .y = r.pos.y, .w = r.size.x, .h = r.size.y};
+}
+
+} // namespace
+
+void append_quad(
+  std::vector<SDL_Vertex>& vertices,
+  std::vector<int>& indices,
+  const Rectf& dst,
+  const std::array<Color, 4>& corners,
+  const Rectf& uv)
+{
+  float x0 = dst.pos.x;
+  float y0 = dst.pos.y;
+  float x1 = x0 + dst.size.x;
+  float y1 = y0 + dst.size.y;
+  float u0 = uv.pos.x;
+  float v0 = uv.pos.y;
+  float u1 = u0 + uv.size.x;
+  float v1 = v0 + uv.size.y;
+
+  int base = int(vertices.size());
+  vertices.push_back({{x0, y0}, corners[0].to_sdl_color(), {u0, v0}});
+  vertices.push_back({{x1, y0}, corners[1].to_sdl_color(), {u1, v0}});
+  vertices.push_back({{x1, y1}, corners[2].to_sdl_color(), {u1, v1}});
+  vertices.push_back({{x0, y1}, corners[3].to_sdl_color(), {u0, v1}});
+  for (int idx : {0, 1, 2, 0, 2, 3}) { indices.push_back(base + idx); }
+}
+
+CommandBuffer::CommandBuffer() {}
+
+CommandBuffer::~CommandBuffer() {}
+
+void CommandBuffer::_push(uint64_t key, Command&& command)
+{
+  _order.push_back({.key = key, .index = uint32_t(_commands.size())});
+  _commands.push_back(std::move(command));
+}
+
+void CommandBuffer::fill(int layer, const Color& color, const Rectf& dst)
+{
+  _push(
+    make_key(layer, 0, uint8_t(Kind::Fill), color.to_rgba32()),
+    {
+      .kind = Kind::Fill,
+      .color = color,
+      .corners = {},
+      .texture = nullptr,
+      .src = {},
+      .dst = dst,
+      .angle = 0,
+    });
+}
+
+void CommandBuffer::fill_gradient(
+  int layer, const Rectf& dst, const std::array<Color, 4>& corners)
+{
+  _push(
+    make_key(layer, 0, uint8_t(Kind::Gradient), 0),
+    {
+      .kind = Kind::Gradient,
+      .color = Color::white(),
+      .corners = corners,
+      .texture = nullptr,
+      .src = {},
+      .dst = dst,
+      .angle = 0,
+    });
+}
+
+void CommandBuffer::copy(
+  int layer,
+  const Texture& texture,
+  const Recti& src,
+  const Rectf& dst,
+  double angle)
+{
+  auto owner = texture.weak_from_this().lock();
+  assert(owner != nullptr && "Deferred textures must be owned by a ptr");
+  _push(
+    make_key(
+      layer,
+      texture_blend_key(texture.sdl_texture()),
+      uint8_t(Kind::Copy),
+      texture.id()),
+    {
+      .kind = Kind::Copy,
+      .color = Color::white(),
+      .corners = {},
+      .texture = std::move(owner),
+      .src = src,
+      .dst = dst,
+      .angle = angle,
+    });
+}
+
+void CommandBuffer::clear()
+{
+  _commands.clear();
+  _order.clear();
+}
+
+// LSD radix sort on 8 bit digits. Stable, so commands with equal keys keep
+// their submission order. Passes where every key has the same digit are
+// skipped, which in practice leaves 3 or 4 passes out of 8.
+void CommandBuffer::_sort()
+{
+  _scratch.resize(_order.size());
+  for (int shift = 0; shift < 64; shift += 8) {
+    std::array<uint32_t, 256> counts{};
+    for (const auto& item : _order) { counts[(item.key >> shift) & 0xff]++; }
+    if (counts[(_order.front().key >> shift) & 0xff] == _order.size()) {
+      continue;
+    }
+    uint32_t offset = 0;
+    for (auto& count : counts) {
+      auto c = count;
+      count = offset;
+      offset += c;
+    }
+    for (const auto& item : _order) {
+      _scratch[counts[(item.key >> shift) & 0xff]++] = item;
+    }
+    std::swap(_order, _scratch);
+  }
+}
+
+bee::OrError<> CommandBuffer::_flush_fills(
+  SDL_Renderer* ren, size_t begin, size_t end)
+{
+  const auto& color = _commands[_order[begin].index].color;
+  if (_draw_color != color) {
+    bail_unit_sdl(
+      SDL_SetRenderDrawColor(ren, color.r, color.g, color.b, color.a));
+    _draw_color = color;
+    _stats.state_changes++;
+  }
+  _rects.clear();
+  for (size_t i = begin; i < end; i++) {
+    _rects.push_back(to_sdl_frect(_commands[_order[i].index].dst));
+  }
+  bail_unit_sdl(SDL_RenderFillRectsF(ren, _rects.data(), int(_rects.size())));
+  _stats.draw_calls++;
+  return bee::ok();
+}
+
+bee::OrError<> CommandBuffer::_flush_gradients(
+  SDL_Renderer* ren, size_t begin, size_t end)
+{
+  _vertices.clear();
+  _indices.clear();
+  for (size_t i = begin; i < end; i++) {
+    const auto& cmd = _commands[_order[i].index];
+    append_quad(
+      _vertices, _indices, cmd.dst, cmd.corners, Rectf{{0, 0}, {0, 0}});
+  }
+  bail_unit_sdl(SDL_RenderGeometry(
+    ren,
+    nullptr,
+    _vertices.data(),
+    int(_vertices.size()),
+    _indices.data(),
+    int(_indices.size())));
+  _stats.draw_calls++;
+  return bee::ok();
+}
+
+bee::OrError<> CommandBuffer::_flush_copies(
+  SDL_Renderer* ren, size_t begin, size_t end)
+{
+  const auto white = Color::white();
+
+  _vertices.clear();
+  _indices.clear();
+  SDL_Texture* texture =
+    _commands[_order[begin].index].texture->sdl_texture();
+  for (size_t i = begin; i < end; i++) {
+    const auto& cmd = _commands[_order[i].index];
+    if (cmd.angle != 0) {
+      // Rotated copies can't be expressed as an axis aligned quad
+      auto src = to_sdl_rect(cmd.src);
+      auto dst = to_sdl_frect(cmd.dst);
+      bail_unit_sdl(SDL_RenderCopyExF(
+        ren,
+        cmd.texture->sdl_texture(),
+        &src,
+        &dst,
+        cmd.angle,
+        nullptr,
+        SDL_FLIP_NONE));
+      _stats.draw_calls++;
+      continue;
+    }
+
+    auto tex_size = cmd.texture->size().cast<float>();
+    Rectf uv{
+      cmd.src.pos.cast<float>() / tex_size,
+      cmd.src.size.cast<float>() / tex_size,
+    };
+    append_quad(_vertices, _indices, cmd.dst, {white, white, white, white}, uv);
+  }
+
+  if (!_vertices.empty()) {
+    bail_unit_sdl(SDL_RenderGeometry(
+      ren,
+      texture,
+      _vertices.data(),
+      int(_vertices.size()),
+      _indices.data(),
+      int(_indices.size())));
+    _stats.draw_calls++;
+  }
+  return bee::ok();
+}
+
+bee::OrError<> CommandBuffer::flush(SDL_Renderer* ren)
+{
+  _stats = Stats{.commands = int64_t(_commands.size())};
+  _draw_color = std::nullopt;
+  if (_commands.empty()) { return bee::ok(); }
+
+  _sort();
+
+  // Commands with the same key share all their state, so each run of equal
+  // keys becomes one batch
+  size_t begin = 0;
+  while (begin < _order.size()) {
+    size_t end = begin + 1;
+    while (end < _order.size() && _order[end].key == _order[begin].key) {
+      end++;
+    }
+    switch (_commands[_order[begin].index].kind) {
+    case Kind::Fill:
+      bail_unit(_flush_fills(ren, begin, end));
+      break;
+    case Kind::Gradient:
+      bail_unit(_flush_gradients(ren, begin, end));
+      break;
+    case Kind::Copy:
+      bail_unit(_flush_copies(ren, begin, end));
+      break;
+    }
+    begin = end;
+  }
+
+  clear();
+  return bee::ok();
+}
+
+} // namespace sdl
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "color.hpp"
+#include "rect.hpp"
+#include "sdl_header.hpp"
+#include "texture.hpp"
+
+#include "bee/or_error.hpp"
+
+namespace sdl {
+
+// Appends two triangles covering `dst`. Corners go clockwise from the top left
+// and `uv` is the normalized source rect, ignored by untextured geometry.
+void append_quad(
+  std::vector<SDL_Vertex>& vertices,
+  std::vector<int>& indices,
+  const Rectf& dst,
+  const std::array<Color, 4>& corners,
+  const Rectf& uv);
+
+// Records draws instead of issuing them, then replays them sorted by (layer,
+// blend mode, texture or color). Fills of the same color go out as a single
+// SDL_RenderFillRectsF, gradients and unrotated copies of the same texture as
+// a single SDL_RenderGeometry, and the draw color is only set when it changes.
+//
+// Draw order is only preserved between different layers and, within a layer,
+// between draws that share a texture or color. Anything that must be drawn on
+// top of something else needs a higher layer.
+//
+// Copies keep a reference to their texture until flush() or clear(), so a
+// texture can be dropped right after it was drawn.
+struct CommandBuffer {
+ public:
+  struct Stats {
+    int64_t commands = 0;
+    int64_t draw_calls = 0;
+    int64_t state_changes = 0;
+  };
+
+  CommandBuffer();
+  ~CommandBuffer();
+
+  CommandBuffer(const CommandBuffer& other) = delete;
+
+  // Rects are expected to be already projected to screen coordinates
+  void fill(int layer, const Color& color, const Rectf& dst);
+
+  void fill_gradient(
+    int layer, const Rectf& dst, const std::array<Color, 4>& corners);
+
+  // The texture must be owned by a Texture::ptr
+  void copy(
+    int layer,
+    const Texture& texture,
+    const Recti& src,
+    const Rectf& dst,
+    double angle);
+
+  [[nodiscard]] bee::OrError<> flush(SDL_Renderer* ren);
+
+  void clear();
+
+  bool empty() const { return _commands.empty(); }
+
+  const Stats& last_flush_stats() const { return _stats; }
+
+ private:
+  enum class Kind : uint8_t {
+    Fill,
+    Gradient,
+    Copy,
+  };
+
+  struct Command {
+    Kind kind;
+    Color color;
+    std::array<Color, 4> corners;
+    std::shared_ptr<const Texture> texture;
+    Recti src;
+    Rectf dst;
+    double angle;
+  };
+
+  struct SortItem {
+    uint64_t key;
+    uint32_t index;
+  };
+
+  void _push(uint64_t key, Command&& command);
+
+  void _sort();
+
+  bee::OrError<> _flush_fills(SDL_Renderer* ren, size_t begin, size_t end);
+  bee::OrError<> _flush_gradients(
+    SDL_Renderer* ren, size_t begin, size_t end);
+  bee::OrError<> _flush_copies(SDL_Renderer* ren, size_t begin, size_t end);
+
+  std::vector<Command> _commands;
+  std::vector<SortItem> _order;
+  std::vector<SortItem> _scratch;
+
+  // Reused across flushes to avoid allocating per frame
+  std::vector<SDL_FRect> _rects;
+  std::vector<SDL_Vertex> _vertices;
+  std::vector<int> _indices;
+
+  std::optional<Color> _draw_color;
+
+  Stats _stats;
+};
+
+} // namespace sdl
@@ -0,0 +1,120 @@
+#include "command_buffer.hpp"
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "software_canvas.hpp"
+
+#include "bee/testing.hpp"
+
+using std::string;
+using std::vector;
+
+namespace sdl {
+namespace {
+
+Rectf rectf(int x, int y, int w, int h)
+{
+  return Rectf{{float(x), float(y)}, {float(w), float(h)}};
+}
+
+void show_stats(const CommandBuffer& commands)
+{
+  const auto& stats = commands.last_flush_stats();
+  P("commands:$ draw_calls:$ state_changes:$",
+    stats.commands,
+    stats.draw_calls,
+    stats.state_changes);
+}
+
+// Columns x and up are filled on layers that grow with x, submitted in an
+// order unrelated to the layers, so each column ends up with the color of
+// its own layer only if the layers were sorted. The layers are spread out
+// enough to need more than one radix pass.
+TEST(layer_order)
+{
+  const vector<int> layers = {-300, -1, 0, 1, 255, 256, 511, 10000};
+  const vector<Color> colors = {
+    {255, 0, 0, 255},
+    {0, 255, 0, 255},
+    {0, 0, 255, 255},
+    {255, 255, 0, 255},
+    {0, 255, 255, 255},
+    {255, 0, 255, 255},
+    {128, 128, 128, 255},
+    {255, 255, 255, 255},
+  };
+
+  SoftwareCanvas canvas({8, 1});
+  CommandBuffer commands;
+  for (int i : {5, 2, 7, 0, 3, 6, 1, 4}) {
+    commands.fill(layers[i], colors[i], rectf(i, 0, 8 - i, 1));
+  }
+  must_unit(commands.flush(canvas.ren()));
+
+  string columns;
+  for (int x = 0; x < 8; x++) {
+    for (int i = 0; i < std::ssize(colors); i++) {
+      if (canvas.pixel(x, 0) == colors[i].to_rgba32()) {
+        columns += std::to_string(i);
+      }
+    }
+  }
+  P("columns:$", columns);
+  show_stats(commands);
+}
+
+TEST(batching)
+{
+  const Color red = {255, 0, 0, 255};
+  const Color blue = {0, 0, 255, 255};
+  const std::array<Color, 4> corners = {red, red, blue, blue};
+
+  SoftwareCanvas canvas({16, 16});
+  must(a, Texture::create_streaming(canvas.ren(), {4, 4}));
+  must(b, Texture::create_streaming(canvas.ren(), {4, 4}));
+
+  CommandBuffer commands;
+  for (int i = 0; i < 3; i++) {
+    commands.fill(0, red, rectf(i, 0, 1, 1));
+    commands.copy(0, *a, {{0, 0}, {4, 4}}, rectf(i, 4, 4, 4), 0);
+    commands.fill(0, blue, rectf(i, 1, 1, 1));
+    commands.fill_gradient(0, rectf(i, 8, 1, 1), corners);
+  }
+  commands.copy(0, *b, {{0, 0}, {4, 4}}, rectf(8, 4, 4, 4), 0);
+  commands.copy(0, *a, {{0, 0}, {4, 4}}, rectf(8, 8, 4, 4), 45);
+  P("empty before flush:$", commands.empty());
+  must_unit(commands.flush(canvas.ren()));
+  P("empty after flush:$", commands.empty());
+
+  // Fills of red and blue, the gradients, the unrotated copies of a, the
+  // rotated copy of a and the copies of b
+  show_stats(commands);
+
+  // Nothing recorded, nothing drawn
+  must_unit(commands.flush(canvas.ren()));
+  show_stats(commands);
+}
+
+// Copies hold on to their texture, so one dropped before the flush, like a
+// temporary made to draw some text, is still there to be drawn
+TEST(keeps_textures_alive)
+{
+  SoftwareCanvas canvas({8, 8});
+  CommandBuffer commands;
+  {
+    must(texture, Texture::create_streaming(canvas.ren(), {4, 4}));
+    std::vector<uint32_t> pixels(16, Color::white().to_rgba32());
+    must_unit(texture->update({{0, 0}, {4, 4}}, pixels.data(), 4));
+    commands.copy(0, *texture, {{0, 0}, {4, 4}}, rectf(0, 0, 4, 4), 0);
+  }
+  must_unit(commands.flush(canvas.ren()));
+  P("drawn:$ outside:$",
+    canvas.pixel(1, 1) == Color::white().to_rgba32(),
+    canvas.pixel(6, 6) == Color::white().to_rgba32());
+  show_stats(commands);
+}
+
+} // namespace
+} // namespace sdl
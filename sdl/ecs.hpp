@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace sdl {
+
+// Stable handle to an entity, stale handles are detected by the generation
+struct Entity {
+  uint32_t index;
+  uint32_t generation;
+
+  auto operator<=>(const Entity& other) const = default;
+};
+
+// Storage for entities that all have the same set of components. Each
+// component type lives in its own contiguous array, so a system that touches
+// two components walks two arrays front to back. Despawning moves the last
+// entity into the hole, which keeps the arrays dense but doesn't preserve
+// order.
+template <class... Cs> struct Archetype {
+ public:
+  static_assert(sizeof...(Cs) > 0, "An archetype needs components");
+
+  Entity spawn(Cs... components)
+  {
+    uint32_t index;
+    if (_free.empty()) {
+      index = uint32_t(_slots.size());
+      _slots.push_back({.dense = 0, .generation = 0});
+    } else {
+      index = _free.back();
+      _free.pop_back();
+    }
+    auto& slot = _slots[index];
+    slot.dense = uint32_t(size());
+    _entities.push_back(index);
+    (_column<Cs>().push_back(std::move(components)), ...);
+    return {.index = index, .generation = slot.generation};
+  }
+
+  void despawn(Entity entity)
+  {
+    assert(alive(entity));
+    auto& slot = _slots[entity.index];
+    uint32_t dense = slot.dense;
+    uint32_t last = uint32_t(size() - 1);
+    if (dense != last) {
+      ((_column<Cs>()[dense] = std::move(_column<Cs>()[last])), ...);
+      _entities[dense] = _entities[last];
+      _slots[_entities[dense]].dense = dense;
+    }
+    (_column<Cs>().pop_back(), ...);
+    _entities.pop_back();
+    slot.generation++;
+    _free.push_back(entity.index);
+  }
+
+  bool alive(Entity entity) const
+  {
+    return entity.index < _slots.size() &&
+           _slots[entity.index].generation == entity.generation;
+  }
+
+  size_t size() const { return _entities.size(); }
+
+  bool empty() const { return _entities.empty(); }
+
+  void reserve(size_t size)
+  {
+    _entities.reserve(size);
+    (_column<Cs>().reserve(size), ...);
+  }
+
+  void clear()
+  {
+    while (!empty()) { despawn(entity_at(size() - 1)); }
+  }
+
+  // Entity stored at a position of the dense arrays
+  Entity entity_at(size_t dense) const
+  {
+    uint32_t index = _entities[dense];
+    return {.index = index, .generation = _slots[index].generation};
+  }
+
+  template <class C> std::span<C> column() { return _column<C>(); }
+
+  template <class C> std::span<const C> column() const
+  {
+    return std::get<std::vector<C>>(_columns);
+  }
+
+  template <class C> C& get(Entity entity)
+  {
+    assert(alive(entity));
+    return _column<C>()[_slots[entity.index].dense];
+  }
+
+  // Calls f with the requested components of every entity, in storage order
+  template <class... Ts, class F> void each(F&& f)
+  {
+    auto columns = std::make_tuple(column<Ts>()...);
+    for (size_t i = 0; i < size(); i++) {
+      f(std::get<std::span<Ts>>(columns)[i]...);
+    }
+  }
+
+  template <class... Ts, class F> void each(F&& f) const
+  {
+    auto columns = std::make_tuple(column<Ts>()...);
+    for (size_t i = 0; i < size(); i++) {
+      f(std::get<std::span<const Ts>>(columns)[i]...);
+    }
+  }
+
+ private:
+  struct Slot {
+    uint32_t dense;
+    uint32_t generation;
+  };
+
+  template <class C> std::vector<C>& _column()
+  {
+    return std::get<std::vector<C>>(_columns);
+  }
+
+  std::tuple<std::vector<Cs>...> _columns;
+
+  // Slot index of the entity at each dense position
+  std::vector<uint32_t> _entities;
+
+  std::vector<Slot> _slots;
+  std::vector<uint32_t> _free;
+};
+
+} // namespace sdl
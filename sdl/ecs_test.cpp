@@ -0,0 +1,73 @@
+#include "ecs.hpp"
+
+#include <utility>
+
+#include "bee/testing.hpp"
+
+namespace sdl {
+namespace {
+
+struct Position {
+  int x;
+};
+
+struct Velocity {
+  int dx;
+};
+
+using Bodies = Archetype<Position, Velocity>;
+
+void print(const Bodies& bodies)
+{
+  for (size_t i = 0; i < bodies.size(); i++) {
+    auto e = bodies.entity_at(i);
+    P("entity:$/$ x:$ dx:$",
+      e.index,
+      e.generation,
+      bodies.column<Position>()[i].x,
+      bodies.column<Velocity>()[i].dx);
+  }
+}
+
+TEST(spawn_despawn)
+{
+  Bodies bodies;
+  auto a = bodies.spawn({10}, {1});
+  auto b = bodies.spawn({20}, {2});
+  auto c = bodies.spawn({30}, {3});
+  print(bodies);
+
+  P("despawn b");
+  bodies.despawn(b);
+  print(bodies);
+  P("alive a:$ b:$ c:$", bodies.alive(a), bodies.alive(b), bodies.alive(c));
+  P("c.x:$", bodies.get<Position>(c).x);
+
+  P("spawn d, reuses b's slot");
+  auto d = bodies.spawn({40}, {4});
+  print(bodies);
+  P("alive b:$ d:$", bodies.alive(b), bodies.alive(d));
+
+  P("despawn last");
+  bodies.despawn(d);
+  print(bodies);
+
+  bodies.clear();
+  P("cleared size:$ alive a:$", bodies.size(), bodies.alive(a));
+}
+
+TEST(each)
+{
+  Bodies bodies;
+  for (int i = 0; i < 5; i++) { bodies.spawn({i * 10}, {i}); }
+  bodies.each<Position, Velocity>(
+    [](Position& p, const Velocity& v) { p.x += v.dx; });
+  int sum = 0;
+  std::as_const(bodies).each<Position>(
+    [&](const Position& p) { sum += p.x; });
+  print(bodies);
+  P("sum:$", sum);
+}
+
+} // namespace
+} // namespace sdl
@@ -0,0 +1,119 @@
+// Generates the source that embeds QOI images in the binary:
+//
+//   embed_images <output.cpp> <Name>=<image.qoi>...
+//
+// Each image becomes a byte array and an EmbeddedImage defined as
+// Images::<Name>, which must be declared in raw_image.hpp. The images are
+// validated by decoding them.
+
+#include <cctype>
+#include <string>
+#include <vector>
+
+#include "qoi.hpp"
+
+#include "bee/file_path.hpp"
+#include "bee/file_reader.hpp"
+#include "bee/file_writer.hpp"
+#include "bee/or_error.hpp"
+#include "bee/print.hpp"
+
+using std::string;
+using std::vector;
+
+namespace sdl {
+namespace {
+
+struct Input {
+  string name;
+  bee::FilePath path;
+};
+
+// Squares -> squares_qoi
+string array_name(const string& name)
+{
+  string out;
+  for (char c : name) {
+    if (isupper(c)) {
+      if (!out.empty()) { out += '_'; }
+      out += char(tolower(c));
+    } else {
+      out += c;
+    }
+  }
+  return out + "_qoi";
+}
+
+string byte_array(const string& name, const string& data)
+{
+  string out = "constexpr uint8_t " + name + "[] = {";
+  for (size_t i = 0; i < data.size(); i++) {
+    if (i % 12 == 0) { out += "\n "; }
+    char hex[8];
+    snprintf(hex, sizeof(hex), " 0x%02x,", uint8_t(data[i]));
+    out += hex;
+  }
+  out += "\n};\n";
+  return out;
+}
+
+bee::OrError<> run(int argc, char* argv[])
+{
+  if (argc < 3) {
+    return EF("Usage: $ <output.cpp> <Name>=<image.qoi>...", argv[0]);
+  }
+  bee::FilePath output(argv[1]);
+
+  string command = "embed_images";
+  vector<Input> inputs;
+  for (int i = 1; i < argc; i++) { command += string("\n//     ") + argv[i]; }
+  for (int i = 2; i < argc; i++) {
+    string arg = argv[i];
+    auto eq = arg.find('=');
+    if (eq == string::npos || eq == 0) {
+      return EF("Expected <Name>=<image.qoi>, got: $", arg);
+    }
+    inputs.push_back(
+      {.name = arg.substr(0, eq), .path = bee::FilePath(arg.substr(eq + 1))});
+  }
+
+  string arrays;
+  string definitions;
+  for (const auto& input : inputs) {
+    bail(data, bee::FileReader::read_file(input.path));
+    bail(
+      img,
+      qoi_decode({reinterpret_cast<const uint8_t*>(data.data()), data.size()}));
+    P("$: $x$x$, $ bytes",
+      input.name,
+      img.width,
+      img.height,
+      img.channels,
+      data.size());
+    auto name = array_name(input.name);
+    arrays += "\n" + byte_array(name, data);
+    definitions += "constinit const EmbeddedImage Images::" + input.name +
+                   "{" + name + "};\n";
+  }
+
+  string source = "// Generated by embed_images, do not edit:\n//\n//   " +
+                  command +
+                  "\n\n#include \"raw_image.hpp\"\n\nnamespace sdl {\n\n"
+                  "namespace {\n" +
+                  arrays + "\n} // namespace\n\n" + definitions +
+                  "\n} // namespace sdl\n";
+  return bee::FileWriter::save_file(output, source);
+}
+
+} // namespace
+} // namespace sdl
+
+int main(int argc, char* argv[])
+{
+  auto ret = sdl::run(argc, argv);
+  if (ret.is_error()) {
+    PE("Error: $", ret.error());
+    return 1;
+  }
+  return 0;
+}
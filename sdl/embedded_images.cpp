@@ -0,0 +1,2960 @@
+// Generated by embed_images, do not edit:
+//
+//   embed_images
+//     sdl/embedded_images.cpp
+//     Squares=sdl/assets/squares.qoi
+//     Ascii=sdl/assets/ascii.qoi
+
+#include "raw_image.hpp"
+
+namespace sdl {
+
+namespace {
+
+constexpr uint8_t squares_qoi[] = {
+  0x71, 0x6f, 0x69, 0x66, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20,
+  0x03, 0x00, 0xfe, 0x42, 0xf7, 0x12, 0xce, 0xfe, 0x32, 0x32, 0x32, 0xce,
+  0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce,
+  0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce,
+  0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce,
+  0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce,
+  0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xde,
+  0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce,
+  0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce,
+  0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce,
+  0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce,
+  0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce, 0x0c, 0xce, 0x23, 0xce,
+  0x0c, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+};
+
+constexpr uint8_t ascii_qoi[] = {
+  0x71, 0x6f, 0x69, 0x66, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xc0,
+  0x04, 0x01, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0x31, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x67, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x31,
+  0xd7, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xff, 0x78, 0x31,
+  0xfd, 0xfd, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x66, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xd4, 0x07, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x0e, 0xff, 0xff,
+  0xff, 0xff, 0xed, 0x26, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xc5, 0x01, 0x26, 0x0d, 0x31, 0xd8,
+  0xff, 0xff, 0xff, 0xff, 0x60, 0x26, 0xc0, 0x31, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x24, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x31, 0xd7, 0xff,
+  0xff, 0xff, 0xff, 0x2f, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
+  0xff, 0xff, 0x08, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x8b, 0x31, 0xd7, 0x29, 0xff, 0xff, 0xff, 0xff, 0x78,
+  0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0xff, 0xc9,
+  0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff,
+  0xff, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0x1c, 0x31, 0xda, 0xff, 0xff,
+  0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0x62, 0xff, 0xff, 0xff, 0xff,
+  0xc3, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff,
+  0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff,
+  0xff, 0x2d, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0x98, 0x31, 0xdc, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff,
+  0xff, 0xff, 0xec, 0x26, 0xff, 0xff, 0xff, 0xff, 0x54, 0x31, 0xd7, 0xff,
+  0xff, 0xff, 0xff, 0x7a, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff,
+  0xff, 0xff, 0x03, 0x31, 0xdc, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x38, 0x31, 0xfd, 0xfd, 0xe3, 0xff, 0xff, 0xff, 0xff,
+  0x1a, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x26, 0xff, 0xff, 0xff, 0xff, 0x83,
+  0x31, 0xf6, 0x01, 0x26, 0x0d, 0x31, 0xd8, 0x11, 0x26, 0xc0, 0x31, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x24, 0x26, 0xc0, 0x05, 0x31, 0xd7, 0xff, 0xff,
+  0xff, 0xff, 0x6c, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x31, 0xc1, 0xff,
+  0xff, 0xff, 0xff, 0xe1, 0x26, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x31, 0xd7,
+  0x29, 0xff, 0xff, 0xff, 0xff, 0x78, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff,
+  0x6e, 0x26, 0xc3, 0x29, 0xff, 0xff, 0xff, 0xff, 0x20, 0x31, 0xd8, 0x07,
+  0xff, 0xff, 0xff, 0xff, 0xac, 0x26, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xf4,
+  0x31, 0xd9, 0x09, 0x26, 0x39, 0x31, 0xdc, 0xff, 0xff, 0xff, 0xff, 0x87,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x3c, 0x31, 0xd7, 0xff, 0xff, 0xff,
+  0xff, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xec, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0x61, 0x31, 0xdc, 0x25, 0x26, 0xff, 0xff, 0xff, 0xff, 0x38, 0x31, 0xfd,
+  0xfd, 0xe3, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xf6, 0xff, 0xff, 0xff, 0xff, 0x15, 0x31, 0xf6, 0x01, 0x26, 0x0d, 0x31,
+  0xd8, 0xff, 0xff, 0xff, 0xff, 0x60, 0x26, 0xc0, 0x31, 0xc0, 0x3d, 0x26,
+  0xc0, 0x05, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x26, 0x3e, 0x31,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x1e, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0x12, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x05,
+  0x27, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xea, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff,
+  0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xff,
+  0x20, 0x31, 0xd0, 0x3b, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
+  0xff, 0xff, 0x6a, 0xff, 0xff, 0xff, 0xff, 0x10, 0x3d, 0xff, 0xff, 0xff,
+  0xff, 0xb2, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x31, 0xd8, 0xff, 0xff,
+  0xff, 0xff, 0x5a, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa1, 0xff, 0xff,
+  0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0x08, 0xff, 0xff, 0xff, 0xff,
+  0x2e, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x2d, 0x31, 0xd9, 0xff, 0xff, 0xff,
+  0xff, 0xc8, 0x26, 0xff, 0xff, 0xff, 0xff, 0x98, 0x31, 0xdb, 0x37, 0x2d,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0x5e, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff,
+  0x85, 0x26, 0xff, 0xff, 0xff, 0xff, 0xde, 0x07, 0x31, 0xd6, 0xff, 0xff,
+  0xff, 0xff, 0x3e, 0x24, 0x13, 0x31, 0xc0, 0x25, 0x26, 0x19, 0x31, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x37, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff,
+  0xff, 0xff, 0x21, 0x31, 0xfd, 0xfd, 0xdd, 0x21, 0xff, 0xff, 0xff, 0xff,
+  0xf2, 0x26, 0xff, 0xff, 0xff, 0xff, 0x94, 0x31, 0xf7, 0xff, 0xff, 0xff,
+  0xff, 0xf0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xd8, 0xff, 0xff,
+  0xff, 0xff, 0x60, 0x26, 0xc0, 0x31, 0xc0, 0x3d, 0x26, 0xc0, 0x05, 0x31,
+  0xd7, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x26, 0xff, 0xff, 0xff, 0xff, 0x4a,
+  0x31, 0xc0, 0x25, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x31, 0xd3, 0xff,
+  0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x26, 0xc6, 0xff,
+  0xff, 0xff, 0xff, 0xec, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0x8d, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x09,
+  0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x21, 0x31,
+  0xd7, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd5,
+  0x07, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x76, 0x31, 0xd9, 0x09, 0x26,
+  0x39, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x79, 0x26, 0x2d, 0xff, 0xff,
+  0xff, 0xff, 0x0c, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x29, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x52, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x5d,
+  0x01, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x85, 0xff,
+  0xff, 0xff, 0xff, 0x0a, 0x25, 0x26, 0x19, 0xff, 0xff, 0xff, 0xff, 0x13,
+  0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x08, 0xff,
+  0xff, 0xff, 0xff, 0x43, 0x31, 0xfd, 0xfd, 0xdd, 0xff, 0xff, 0xff, 0xff,
+  0x7c, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1c, 0x31, 0xf7, 0x01, 0x26,
+  0x0d, 0x31, 0xd8, 0x11, 0x26, 0xc0, 0x31, 0xc0, 0x3d, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x3c, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x22, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xfd, 0x21, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x99, 0x26, 0xff, 0xff, 0xff, 0xff, 0x96, 0x31, 0xd3, 0xff, 0xff, 0xff,
+  0xff, 0xbc, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff,
+  0x6c, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff,
+  0xff, 0xff, 0xff, 0x7d, 0x3d, 0xff, 0xff, 0xff, 0xff, 0x49, 0xff, 0xff,
+  0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xca, 0x31, 0xd0, 0xff, 0xff,
+  0xff, 0xff, 0x86, 0x26, 0xff, 0xff, 0xff, 0xff, 0x57, 0x31, 0xc2, 0xff,
+  0xff, 0xff, 0xff, 0xb4, 0x26, 0x34, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff,
+  0xbe, 0x26, 0xff, 0xff, 0xff, 0xff, 0xad, 0x31, 0xdf, 0x09, 0x26, 0x39,
+  0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xa3, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xce, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xb5, 0x31, 0xd7, 0x02, 0xff, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff,
+  0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff,
+  0xa1, 0x26, 0xff, 0xff, 0xff, 0xff, 0x95, 0xff, 0xff, 0xff, 0xff, 0xed,
+  0x0c, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xff, 0xff, 0xff, 0xff, 0x0a, 0x31,
+  0xd7, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x26, 0xff, 0xff, 0xff, 0xff, 0x94,
+  0x31, 0xfd, 0xfd, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x09, 0xff, 0xff, 0xff,
+  0xff, 0xea, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x31, 0xf8, 0x01, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x60,
+  0x26, 0xc0, 0x31, 0xc0, 0x3d, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x3c,
+  0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x68, 0x26, 0xcc, 0xff, 0xff, 0xff,
+  0xff, 0xcc, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x2c, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x70, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff,
+  0xff, 0xff, 0xff, 0x78, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0x8a, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x08,
+  0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0x11, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xdb, 0x31, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x26,
+  0x39, 0x31, 0xda, 0xff, 0xff, 0xff, 0xff, 0x33, 0x26, 0xc0, 0x37, 0x31,
+  0xdb, 0xff, 0xff, 0xff, 0xff, 0x7b, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfb,
+  0xff, 0xff, 0xff, 0xff, 0x12, 0x31, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x1f,
+  0xff, 0xff, 0xff, 0xff, 0xa3, 0x1b, 0x26, 0x24, 0xff, 0xff, 0xff, 0xff,
+  0x90, 0x02, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0x94, 0x31, 0xfd, 0xfd, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x6b,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x31, 0xf8, 0xff, 0xff, 0xff,
+  0xff, 0xf0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xd8, 0x11, 0x26,
+  0xc0, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x24, 0x26, 0xc0, 0x05, 0x31,
+  0xd2, 0xff, 0xff, 0xff, 0xff, 0x68, 0x26, 0xcc, 0x35, 0x31, 0xcf, 0xff,
+  0xff, 0xff, 0xff, 0x5c, 0x26, 0xc0, 0x3d, 0x31, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xe8, 0xff, 0xff, 0xff, 0xff, 0x78, 0x31, 0xd4, 0x06, 0xff, 0xff,
+  0xff, 0xff, 0xfa, 0x24, 0xff, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xb0,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xb9, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff,
+  0x03, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0x59, 0x31,
+  0xd1, 0x0f, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x31, 0xde, 0x09,
+  0x26, 0x39, 0x31, 0xda, 0xff, 0xff, 0xff, 0xff, 0x74, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x19, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x43, 0x26,
+  0xc0, 0x2e, 0x31, 0xd8, 0x06, 0xff, 0xff, 0xff, 0xff, 0xa2, 0xff, 0xff,
+  0xff, 0xff, 0xfd, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
+  0xff, 0x8f, 0x02, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x94, 0x31, 0xfd, 0xfd, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x03, 0x3b, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x31, 0xf9, 0xff, 0xff,
+  0xff, 0xff, 0xf0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xd8, 0x11,
+  0x26, 0xc0, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x24, 0x26, 0xc0, 0x05,
+  0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x26, 0x0b, 0x31, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x56, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x31, 0xd3,
+  0xff, 0xff, 0xff, 0xff, 0x5e, 0x26, 0xc0, 0x36, 0x31, 0xc0, 0x29, 0xff,
+  0xff, 0xff, 0xff, 0x78, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x71, 0x26,
+  0xc3, 0x3f, 0x32, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x19, 0xff, 0xff,
+  0xff, 0xff, 0x7c, 0x27, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x31, 0xd1,
+  0xff, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x31, 0xdd, 0x09,
+  0x26, 0x39, 0x31, 0xda, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x26, 0x27, 0x31,
+  0xdc, 0xff, 0xff, 0xff, 0xff, 0x0d, 0x10, 0x26, 0x18, 0x31, 0xd6, 0x37,
+  0xff, 0xff, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
+  0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0x96, 0x20, 0x01, 0xff, 0xff, 0xff, 0xff, 0x79, 0x14, 0x31, 0xd7,
+  0xff, 0xff, 0xff, 0xff, 0xb8, 0x26, 0xff, 0xff, 0xff, 0xff, 0x94, 0x31,
+  0xfd, 0xfd, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x5b, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x3e, 0x31, 0xf9, 0x01, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4,
+  0x31, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x1b, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x14, 0x31, 0xc0, 0x21, 0x26, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x31,
+  0xd3, 0xff, 0xff, 0xff, 0xff, 0x31, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0xa8, 0x12, 0x31, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xff,
+  0x78, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x52, 0xff, 0xff, 0xff, 0xff,
+  0xca, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x20, 0x08, 0x06, 0x31, 0xff, 0xff,
+  0xff, 0xff, 0x41, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x2f, 0xff, 0xff, 0xff,
+  0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0xff, 0x48,
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa1,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xea, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xb4, 0x31, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xda,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff,
+  0x5c, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff,
+  0xff, 0xff, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x0a, 0x25, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x38, 0x0d, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff,
+  0x43, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0x94, 0x31, 0xfd, 0xfd, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xc6, 0x31, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xe9,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x31, 0xf8, 0xff, 0xff, 0xff, 0xff,
+  0x56, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x31, 0xc1, 0xff, 0xff, 0xff,
+  0xff, 0xca, 0x26, 0xff, 0xff, 0xff, 0xff, 0x63, 0x31, 0xd4, 0xff, 0xff,
+  0xff, 0xff, 0xc3, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xff,
+  0xff, 0xff, 0x7b, 0x01, 0xff, 0xff, 0xff, 0xff, 0x78, 0x31, 0xda, 0xff,
+  0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xff,
+  0xff, 0xd8, 0x26, 0x08, 0xff, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff,
+  0xff, 0x1c, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x21, 0x0f, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xc5, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x74, 0x31,
+  0xfa, 0xff, 0xff, 0xff, 0xff, 0x04, 0x1b, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0x9f, 0x31, 0xdd, 0x28, 0x26, 0x29, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff,
+  0x3f, 0xff, 0xff, 0xff, 0xff, 0xb9, 0x13, 0x31, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38,
+  0x31, 0xc0, 0x0e, 0x28, 0x1c, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xb8,
+  0x26, 0x0d, 0x31, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x4b, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x4f, 0x31, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xdb,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x31, 0xf8, 0xff, 0xff, 0xff, 0xff,
+  0x91, 0x26, 0x06, 0x31, 0xc0, 0x14, 0x2f, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0x28, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x1a, 0xff, 0xff, 0xff, 0xff,
+  0xd2, 0x26, 0xc2, 0x05, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xff, 0xff, 0xff,
+  0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x22, 0x31, 0xd5, 0xff, 0xff, 0xff,
+  0xff, 0x34, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xf6,
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xff, 0xff,
+  0xff, 0xff, 0x53, 0x1d, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0xd6, 0x26, 0xff, 0xff, 0xff, 0xff, 0x96, 0x3c, 0xff,
+  0xff, 0xff, 0xff, 0x84, 0x26, 0x10, 0x2a, 0x31, 0xc2, 0xff, 0xff, 0xff,
+  0xff, 0xcf, 0x26, 0xff, 0xff, 0xff, 0xff, 0x65, 0x31, 0xf2, 0xff, 0xff,
+  0xff, 0xff, 0x17, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x31, 0xdd,
+  0x22, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x31, 0xda, 0x25, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x38, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x26,
+  0xcb, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x31, 0xfd, 0xf7, 0x12, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xd5, 0x3c, 0x31, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xcd,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x31, 0xf8, 0xff, 0xff, 0xff, 0xff,
+  0xcb, 0x26, 0x08, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x3c, 0x31, 0xd5, 0xff,
+  0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x2a, 0x1b, 0x26,
+  0xc2, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x7b, 0x31,
+  0xd1, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xff, 0xff, 0xff, 0xff, 0x62, 0x35,
+  0x26, 0x20, 0xff, 0xff, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x25,
+  0x31, 0x0c, 0x38, 0x17, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xff, 0xff,
+  0xff, 0xff, 0x30, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x89, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xce, 0xff, 0xff, 0xff, 0xff, 0x04, 0x31, 0xff, 0xff,
+  0xff, 0xff, 0x02, 0x22, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff,
+  0xff, 0xff, 0x2a, 0x31, 0xc1, 0x2a, 0x26, 0xff, 0xff, 0xff, 0xff, 0x56,
+  0x31, 0xf2, 0xff, 0xff, 0xff, 0xff, 0x27, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xdd, 0xff, 0xff, 0xff, 0xff,
+  0xa5, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x05, 0x31, 0xd9, 0x25, 0x26,
+  0x19, 0x31, 0xd5, 0x35, 0x26, 0xcb, 0x29, 0x31, 0xf2, 0xff, 0xff, 0xff,
+  0xff, 0x20, 0x26, 0xc4, 0x05, 0x31, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x39,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x31, 0xfb, 0xff, 0xff, 0xff,
+  0xff, 0xbe, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x31, 0xf4, 0xff, 0xff,
+  0xff, 0xff, 0xf8, 0x26, 0xcc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x31, 0xd5,
+  0xff, 0xff, 0xff, 0xff, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff,
+  0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff,
+  0xfc, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x70, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xac, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xc7, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0xff, 0xff, 0xff, 0x08, 0x31,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x26,
+  0xc2, 0x03, 0x1b, 0x31, 0xce, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff,
+  0xff, 0xff, 0xf1, 0x26, 0xff, 0xff, 0xff, 0xff, 0x61, 0x31, 0xc1, 0x0b,
+  0x39, 0x26, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0x13,
+  0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xda, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0x3c, 0x31, 0xf2, 0x2e, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x31,
+  0xdd, 0x22, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x31, 0xfa, 0xff, 0xff,
+  0xff, 0xff, 0xb8, 0x26, 0x0d, 0x31, 0xf8, 0x11, 0x26, 0xc4, 0x05, 0x31,
+  0xf8, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe2,
+  0x28, 0x31, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0x93, 0x31, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x26, 0xcc, 0xff,
+  0xff, 0xff, 0xff, 0x3c, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff,
+  0xff, 0xff, 0xff, 0x78, 0x31, 0xff, 0xff, 0xff, 0xff, 0x2c, 0xff, 0xff,
+  0xff, 0xff, 0xea, 0x26, 0xff, 0xff, 0xff, 0xff, 0xef, 0x28, 0x31, 0xcf,
+  0xff, 0xff, 0xff, 0xff, 0x35, 0xff, 0xff, 0xff, 0xff, 0x30, 0x31, 0xc2,
+  0x12, 0x30, 0x26, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
+  0x18, 0x2e, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xdf, 0x28, 0x31, 0xcd, 0xff, 0xff, 0xff, 0xff, 0x22, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x38, 0x31, 0xc2, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xf0,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x28, 0xff, 0xff, 0xff, 0xff, 0x0c,
+  0xff, 0xff, 0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff, 0xff, 0xff, 0x09, 0x31,
+  0xf2, 0x12, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xa0, 0x31, 0xdd, 0x33, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xe7, 0x31, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x26, 0x0d, 0x31,
+  0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x2b, 0x1b, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0x70, 0x31, 0xfd, 0xfa, 0x16, 0x26, 0x11, 0x31, 0xc0, 0x14, 0xff,
+  0xff, 0xff, 0xff, 0xf9, 0x26, 0xff, 0xff, 0xff, 0xff, 0x29, 0x31, 0xda,
+  0x29, 0xff, 0xff, 0xff, 0xff, 0x78, 0x31, 0xc0, 0x3a, 0x26, 0xc0, 0x2b,
+  0x31, 0xd5, 0x38, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x31, 0xc2, 0xff,
+  0xff, 0xff, 0xff, 0xbb, 0x26, 0xff, 0xff, 0xff, 0xff, 0x42, 0x31, 0xcd,
+  0x2b, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x4a, 0x31, 0xc3, 0xff, 0xff,
+  0xff, 0xff, 0x4b, 0x10, 0x26, 0xff, 0xff, 0xff, 0xff, 0x99, 0xff, 0xff,
+  0xff, 0xff, 0x68, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x31, 0xf4, 0xff,
+  0xff, 0xff, 0xff, 0xe9, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x31, 0xdd,
+  0x1a, 0x26, 0x33, 0x31, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x26, 0x0d,
+  0x31, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x26, 0x20, 0xff, 0xff,
+  0xff, 0xff, 0x0b, 0x31, 0xfd, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xcb, 0x26,
+  0x32, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x40, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xeb, 0x3c, 0xff, 0xff, 0xff, 0xff, 0x00, 0xda, 0xff, 0xff, 0xff,
+  0xff, 0xe8, 0xff, 0xff, 0xff, 0xff, 0x78, 0x31, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x68, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x31, 0xd5, 0xff,
+  0xff, 0xff, 0xff, 0x4e, 0x26, 0x16, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff,
+  0x84, 0x26, 0x1c, 0x31, 0xcd, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x2f, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0x9f, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x7a,
+  0x26, 0xc0, 0x24, 0x10, 0xff, 0xff, 0xff, 0xff, 0x38, 0x31, 0xf4, 0x17,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x31, 0xdc, 0x0b, 0x10, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x95, 0x31, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x26,
+  0x0d, 0x31, 0xfd, 0xfa, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xff, 0xff, 0xff,
+  0xff, 0xfb, 0x26, 0xff, 0xff, 0xff, 0xff, 0x81, 0x31, 0xfd, 0xfa, 0x35,
+  0x3a, 0x26, 0x13, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xaf, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff,
+  0xff, 0xff, 0xff, 0x78, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xf2, 0x09, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff,
+  0x37, 0x26, 0x12, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xba, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x47, 0x31, 0xce, 0xff, 0xff, 0xff, 0xff, 0xac, 0x26,
+  0x10, 0xff, 0xff, 0xff, 0xff, 0x54, 0x31, 0xc4, 0x2f, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x94, 0x31, 0xf5, 0xff, 0xff, 0xff, 0xff, 0x74, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x1b, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff,
+  0x45, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x58, 0x31, 0xfa, 0xff, 0xff,
+  0xff, 0xff, 0xb8, 0x26, 0x0d, 0x31, 0xda, 0xff, 0xff, 0xff, 0xff, 0x24,
+  0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x50, 0x31, 0xf9, 0x21, 0x26, 0xc1,
+  0xff, 0xff, 0xff, 0xff, 0x20, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x92,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0x14, 0x31,
+  0xfd, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4,
+  0x31, 0xf6, 0x28, 0x26, 0x29, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xbb,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0x73, 0x31, 0xd5, 0x1c, 0xff, 0xff, 0xff,
+  0xff, 0xbc, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0x32,
+  0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0xff, 0x01, 0x29, 0xff,
+  0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff,
+  0xff, 0x9b, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x7b, 0x31, 0xd6, 0xff,
+  0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x26, 0x16, 0xff,
+  0xff, 0xff, 0xff, 0x18, 0x2e, 0xff, 0xff, 0xff, 0xff, 0x89, 0x26, 0x1e,
+  0x09, 0x31, 0xce, 0xff, 0xff, 0xff, 0xff, 0x21, 0x0a, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0x04, 0xff, 0xff, 0xff, 0xff, 0x35, 0xff, 0xff, 0xff,
+  0xff, 0x09, 0xff, 0xff, 0xff, 0xff, 0x0d, 0xff, 0xff, 0xff, 0xff, 0x3d,
+  0x06, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0xe1, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x31, 0xf4, 0xff, 0xff, 0xff, 0xff,
+  0x33, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x54, 0x31, 0xdb, 0xff, 0xff,
+  0xff, 0xff, 0x7e, 0x26, 0x05, 0xff, 0xff, 0xff, 0xff, 0x12, 0x31, 0xfa,
+  0x19, 0x26, 0xff, 0xff, 0xff, 0xff, 0x94, 0x31, 0xda, 0x3d, 0x26, 0xc1,
+  0x21, 0x31, 0xf9, 0x21, 0x26, 0xc1, 0x11, 0x31, 0xd6, 0xff, 0xff, 0xff,
+  0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0x91, 0x31, 0xfd, 0xc0, 0x01, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x31,
+  0xf6, 0xff, 0xff, 0xff, 0xff, 0x81, 0x26, 0xff, 0xff, 0xff, 0xff, 0xab,
+  0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0xff, 0xf3,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0x36, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff,
+  0x68, 0x26, 0xc2, 0x24, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x26, 0xc2, 0xff,
+  0xff, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0xff, 0x01, 0x31, 0xd7, 0xff,
+  0xff, 0xff, 0xff, 0x46, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x26, 0xc2, 0x24,
+  0xff, 0xff, 0xff, 0xff, 0x48, 0x31, 0xd0, 0x2b, 0x0f, 0x26, 0xc5, 0xff,
+  0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x24, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xa3, 0x31, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xa6, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xd1,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x31, 0xfd, 0xdc, 0xff, 0xff, 0xff,
+  0xff, 0x25, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x31, 0xf9, 0xff,
+  0xff, 0xff, 0xff, 0x50, 0x26, 0xc1, 0x11, 0x31, 0xd6, 0xff, 0xff, 0xff,
+  0xff, 0x81, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
+  0x1f, 0x31, 0xfd, 0xc0, 0x01, 0x26, 0x0d, 0x31, 0xf6, 0xff, 0xff, 0xff,
+  0xff, 0xbe, 0x26, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x31, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x35, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x1d, 0x31, 0xd5,
+  0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff,
+  0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff,
+  0xd5, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x25, 0xff, 0xff, 0xff,
+  0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0x38, 0x31, 0xda, 0x19, 0xff, 0xff,
+  0xff, 0xff, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xba, 0xff, 0xff, 0xff, 0xff, 0x37, 0x31, 0xd2, 0x14, 0xff, 0xff,
+  0xff, 0xff, 0x67, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff,
+  0xeb, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
+  0xff, 0xff, 0xff, 0xc6, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff,
+  0xff, 0x15, 0x31, 0xff, 0xff, 0xff, 0xff, 0x86, 0x26, 0xc0, 0x23, 0x31,
+  0xf4, 0xff, 0xff, 0xff, 0xff, 0x77, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf6,
+  0xff, 0xff, 0xff, 0xff, 0x0d, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x2c,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x53, 0x31, 0xfd, 0xdc, 0xff, 0xff,
+  0xff, 0xff, 0x52, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0xff,
+  0xff, 0xff, 0x0b, 0x31, 0xf9, 0x21, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff,
+  0x20, 0x31, 0xd5, 0x2a, 0x20, 0x26, 0x27, 0x31, 0xfd, 0xfd, 0xe4, 0xff,
+  0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0x78, 0x31, 0xfd, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x11, 0x22, 0x26, 0xff, 0xff, 0xff, 0xff, 0x61,
+  0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x89, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xde, 0x12, 0x31, 0xfd, 0xdc, 0xff, 0xff, 0xff, 0xff, 0x94, 0x26, 0xc0,
+  0x2b, 0x31, 0xfd, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x71, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x2c, 0x31, 0xfd, 0xfd, 0xe4,
+  0x0a, 0x19, 0x31, 0xfd, 0xfd, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x85, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x01, 0x31, 0xd7,
+  0x0b, 0xff, 0xff, 0xff, 0xff, 0xee, 0x26, 0xff, 0xff, 0xff, 0xff, 0x62,
+  0x31, 0xfd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xe1, 0xff, 0xff, 0xff, 0xff, 0x07, 0x31, 0xfd, 0xd7, 0xff, 0xff,
+  0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xb3, 0x31, 0xfd, 0xfd, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xea, 0x19,
+  0x31, 0xfd, 0xfd, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0a, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x55, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xd5, 0x12, 0x31, 0xfd, 0xdc, 0xff, 0xff, 0xff,
+  0xff, 0x19, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x63, 0x31, 0xfd, 0xd8,
+  0xff, 0xff, 0xff, 0xff, 0x60, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x3b,
+  0x31, 0xfd, 0xfd, 0xe5, 0x34, 0x19, 0x31, 0xfd, 0xfd, 0xc1, 0xff, 0xff,
+  0xff, 0xff, 0x64, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff,
+  0xff, 0x02, 0x31, 0xd5, 0x0b, 0x2b, 0x26, 0xff, 0xff, 0xff, 0xff, 0x41,
+  0x31, 0xfd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0x5b, 0x26, 0x0f, 0x1d, 0x31,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc2, 0xff, 0xff, 0xff,
+  0xff, 0x4b, 0x22, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff,
+  0xf8, 0x27, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xff, 0xff, 0xff, 0xff, 0x37,
+  0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xff, 0xff, 0x3f,
+  0xff, 0xff, 0xff, 0xff, 0x77, 0xff, 0xff, 0xff, 0xff, 0xae, 0xff, 0xff,
+  0xff, 0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xb8, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x13, 0x23, 0xff, 0xff,
+  0xff, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xff,
+  0xe3, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
+  0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff,
+  0xff, 0x22, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x09, 0x09, 0xff, 0xff,
+  0xff, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x29, 0xff, 0xff, 0xff,
+  0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xd6,
+  0xff, 0xff, 0xff, 0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0x35, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xcc, 0x31, 0xd3, 0x15, 0x26, 0xc8, 0x15, 0x31, 0xd5,
+  0xff, 0xff, 0xff, 0xff, 0x09, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0xff,
+  0xff, 0xff, 0xbe, 0x13, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff,
+  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x3d, 0x0b, 0x31, 0xd1, 0x39,
+  0x26, 0xca, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0xd3, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff,
+  0xff, 0xff, 0xff, 0xcd, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
+  0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xff, 0xff, 0xff, 0xff,
+  0x7b, 0xff, 0xff, 0xff, 0xff, 0x12, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff,
+  0x24, 0xff, 0xff, 0xff, 0xff, 0x94, 0x23, 0x2d, 0xff, 0xff, 0xff, 0xff,
+  0xf5, 0x25, 0x1a, 0xff, 0xff, 0xff, 0xff, 0x31, 0x31, 0xfd, 0xfd, 0xfb,
+  0xff, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x32, 0x24,
+  0x01, 0x33, 0xff, 0xff, 0xff, 0xff, 0x70, 0x3e, 0x31, 0xd5, 0xff, 0xff,
+  0xff, 0xff, 0x96, 0x26, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff,
+  0xff, 0xff, 0x71, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x26, 0xc4,
+  0x19, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x26, 0xc6, 0xff, 0xff,
+  0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x84, 0x26, 0xc6, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x92, 0x07, 0x31, 0xd8, 0xff, 0xff,
+  0xff, 0xff, 0x65, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x31, 0xd3,
+  0xff, 0xff, 0xff, 0xff, 0x2c, 0x26, 0xc8, 0x15, 0x31, 0xd4, 0xff, 0xff,
+  0xff, 0xff, 0x35, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x26, 0xc5, 0xff, 0xff,
+  0xff, 0xff, 0x8c, 0x31, 0xd1, 0x39, 0x26, 0xca, 0xff, 0xff, 0xff, 0xff,
+  0x9c, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x53, 0x2d, 0x26, 0xc5, 0x3f,
+  0xff, 0xff, 0xff, 0xff, 0x39, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x5d,
+  0xff, 0xff, 0xff, 0xff, 0xf9, 0x26, 0xc4, 0x05, 0x0c, 0x31, 0xfd, 0xfd,
+  0xf8, 0xff, 0xff, 0xff, 0xff, 0x25, 0x33, 0x26, 0xc5, 0xff, 0xff, 0xff,
+  0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x13, 0x31, 0xd3, 0xff, 0xff, 0xff,
+  0xff, 0x74, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x15, 0x14, 0xff,
+  0xff, 0xff, 0xff, 0x39, 0xff, 0xff, 0xff, 0xff, 0xce, 0x26, 0x1b, 0xff,
+  0xff, 0xff, 0xff, 0x4d, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x98, 0xff,
+  0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x8a, 0xff, 0xff, 0xff,
+  0xff, 0x52, 0xff, 0xff, 0xff, 0xff, 0x1e, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xb8, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xc9, 0xff, 0xff, 0xff, 0xff, 0x66, 0x08, 0xff, 0xff, 0xff,
+  0xff, 0x08, 0x3b, 0xff, 0xff, 0xff, 0xff, 0x61, 0xff, 0xff, 0xff, 0xff,
+  0xe8, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x58, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x7a, 0x19, 0xff, 0xff, 0xff, 0xff,
+  0x72, 0x24, 0x06, 0x09, 0xff, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff,
+  0xff, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x86, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xff, 0xff, 0xff,
+  0xff, 0xf0, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x26, 0x35, 0x31, 0xd3,
+  0x15, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x58, 0x31, 0xdb, 0xff, 0xff,
+  0xff, 0xff, 0x2b, 0x36, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff,
+  0xff, 0xff, 0x77, 0xff, 0xff, 0xff, 0xff, 0x24, 0x3e, 0xff, 0xff, 0xff,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x3b, 0x0d, 0xff, 0xff, 0xff, 0xff,
+  0x7c, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x87, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x3a, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x27, 0x24, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0xff,
+  0xff, 0xff, 0x20, 0x09, 0x08, 0x33, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x26,
+  0x3f, 0x2c, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x39, 0xff, 0xff, 0xff,
+  0xff, 0xfb, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff,
+  0x56, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0x09, 0xff,
+  0xff, 0xff, 0xff, 0x3f, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x4e, 0x31, 0xfd, 0xfd, 0xf7, 0xff, 0xff, 0xff, 0xff,
+  0xa8, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xff, 0x4f,
+  0x02, 0xff, 0xff, 0xff, 0xff, 0x0d, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff,
+  0xff, 0xff, 0xff, 0xc2, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x31,
+  0xd2, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xd3, 0x28, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff,
+  0x13, 0xff, 0xff, 0xff, 0xff, 0xea, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd9,
+  0x12, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x04, 0x26, 0xc0, 0x19, 0x31,
+  0xd5, 0xff, 0xff, 0xff, 0xff, 0x96, 0xff, 0xff, 0xff, 0xff, 0x45, 0x31,
+  0xc4, 0x27, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xe6, 0x12, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x0e, 0xff, 0xff, 0xff,
+  0xff, 0xdd, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x31, 0xd6, 0xff,
+  0xff, 0xff, 0xff, 0xb4, 0x26, 0xff, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff,
+  0xff, 0xff, 0xf4, 0x26, 0x35, 0x31, 0xd3, 0x15, 0x26, 0xc0, 0x39, 0x31,
+  0xda, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x26,
+  0x2b, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x31, 0xe1, 0x1d, 0xff, 0xff, 0xff,
+  0xff, 0xe7, 0x26, 0x2e, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x69, 0x31, 0xc3, 0x00, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x67, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xfb, 0x15, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff,
+  0x0c, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd8,
+  0xff, 0xff, 0xff, 0xff, 0x02, 0x31, 0xfd, 0xfd, 0xf6, 0xff, 0xff, 0xff,
+  0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x3d, 0x31, 0xc3, 0xff, 0xff, 0xff,
+  0xff, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xde, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xfc, 0x21, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x5a, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x43, 0x31, 0xd6,
+  0x1d, 0x26, 0xc0, 0x19, 0x31, 0xde, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x36, 0x31, 0xda, 0xff, 0xff, 0xff, 0xff,
+  0x8f, 0x26, 0xc0, 0x2f, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x5d, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xca, 0x07, 0x2d, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xcc, 0x31, 0xd3, 0x15, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x58, 0x31,
+  0xda, 0x12, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x65, 0x31, 0xe2, 0xff,
+  0xff, 0xff, 0xff, 0x51, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x74, 0x31,
+  0xd2, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x1a, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xc0, 0x16, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x0d, 0x05, 0x26,
+  0x19, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x66, 0x26, 0xc0, 0x2f, 0x31,
+  0xfd, 0xde, 0x27, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff,
+  0x91, 0x31, 0xef, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xff, 0xff, 0xff, 0xff,
+  0x79, 0xff, 0xff, 0xff, 0xff, 0x17, 0x31, 0xe5, 0xff, 0xff, 0xff, 0xff,
+  0x9b, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x30, 0x31, 0xd1, 0xff, 0xff,
+  0xff, 0xff, 0xb6, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x00, 0x31, 0xc3,
+  0x01, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x90, 0x31, 0xd6, 0x1d, 0x26,
+  0xc0, 0x19, 0x31, 0xde, 0xff, 0xff, 0xff, 0xff, 0x82, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x50, 0x31, 0xda, 0xff, 0xff, 0xff, 0xff, 0x83, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x31, 0x31, 0xd4, 0x2e, 0x20, 0x10, 0xff,
+  0xff, 0xff, 0xff, 0x32, 0x31, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x26, 0x35,
+  0x31, 0xd3, 0x15, 0x26, 0xc0, 0x39, 0x31, 0xda, 0x25, 0x26, 0x36, 0xff,
+  0xff, 0xff, 0xff, 0x05, 0x31, 0xe2, 0x03, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xfa, 0xff, 0xff, 0xff, 0xff, 0x16, 0x31, 0xd2, 0x25, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x18, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x76, 0x31, 0xd0, 0x17, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x84, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x26,
+  0xc0, 0x12, 0x31, 0xfd, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff,
+  0xff, 0xff, 0x51, 0xff, 0xff, 0xff, 0xff, 0xb9, 0x1b, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xa8, 0x31, 0xef, 0x35, 0x26, 0x2f, 0xff, 0xff, 0xff, 0xff,
+  0xaa, 0xff, 0xff, 0xff, 0xff, 0x42, 0x3c, 0x31, 0xe2, 0xff, 0xff, 0xff,
+  0xff, 0xaf, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x1c, 0x31, 0xd1, 0xff,
+  0xff, 0xff, 0xff, 0xe7, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x31, 0xc4,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xc1, 0x31, 0xd6, 0x1d, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xb8, 0x31, 0xde, 0xff, 0xff, 0xff, 0xff, 0x99, 0x26, 0xc0, 0x05,
+  0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xd9,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 0x08, 0x31,
+  0xd4, 0xff, 0xff, 0xff, 0xff, 0xad, 0x26, 0xff, 0xff, 0xff, 0xff, 0x93,
+  0x31, 0xc0, 0x2d, 0x26, 0x35, 0x31, 0xd3, 0x15, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xff,
+  0xf9, 0xff, 0xff, 0xff, 0xff, 0xef, 0x35, 0xff, 0xff, 0xff, 0xff, 0x84,
+  0xff, 0xff, 0xff, 0xff, 0x17, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xd8,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xac, 0x31, 0xe2, 0xff, 0xff, 0xff, 0xff,
+  0x1d, 0x10, 0x26, 0x20, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x26,
+  0xc0, 0x08, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x26, 0x3a, 0xff,
+  0xff, 0xff, 0xff, 0x2b, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x77, 0x31, 0xc4,
+  0xff, 0xff, 0xff, 0xff, 0x18, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xaf,
+  0x31, 0xd5, 0x21, 0x26, 0xc1, 0x11, 0x31, 0xd9, 0x21, 0x26, 0xc1, 0x11,
+  0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xff, 0xff, 0xff, 0xff, 0x82,
+  0xff, 0xff, 0xff, 0xff, 0xe5, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xf2,
+  0xff, 0xff, 0xff, 0xff, 0x71, 0x31, 0xef, 0xff, 0xff, 0xff, 0xff, 0x8f,
+  0xff, 0xff, 0xff, 0xff, 0xf8, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xda,
+  0xff, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0x13, 0x31, 0xdf,
+  0xff, 0xff, 0xff, 0xff, 0x35, 0x3a, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc4,
+  0x31, 0xd1, 0x00, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xc5,
+  0xff, 0xff, 0xff, 0xff, 0xdd, 0x26, 0x1e, 0x31, 0xd6, 0xff, 0xff, 0xff,
+  0xff, 0x04, 0x26, 0xc0, 0x19, 0x31, 0xdd, 0x12, 0xff, 0xff, 0xff, 0xff,
+  0xe3, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x09, 0x31, 0xd6, 0x12, 0xff,
+  0xff, 0xff, 0xff, 0x1d, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0xff, 0xff,
+  0xff, 0xd1, 0x26, 0x24, 0xff, 0xff, 0xff, 0xff, 0x52, 0x31, 0xd4, 0xff,
+  0xff, 0xff, 0xff, 0x56, 0x26, 0x1e, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x31,
+  0xc0, 0x2d, 0x26, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x31, 0xd3, 0xff, 0xff,
+  0xff, 0xff, 0x2c, 0x26, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x21, 0x31,
+  0xd2, 0x09, 0x10, 0x26, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1d, 0xff, 0xff,
+  0xff, 0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x2d, 0x17, 0xff, 0xff,
+  0xff, 0xff, 0xd0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xda, 0xff, 0xff, 0xff, 0xff, 0x80, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0xff,
+  0xff, 0x97, 0x26, 0x22, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x3b, 0x09, 0xff,
+  0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff,
+  0xff, 0xfc, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x71, 0x31, 0xd1, 0xff, 0xff,
+  0xff, 0xff, 0x31, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x84, 0x31, 0xc4,
+  0xff, 0xff, 0xff, 0xff, 0x2a, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xd3,
+  0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x50, 0x26, 0xc1, 0x11, 0x31, 0xd9,
+  0x21, 0x26, 0xc1, 0x11, 0x31, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff,
+  0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x10, 0x26, 0xc1,
+  0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x60, 0x2a, 0x31,
+  0xf1, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff,
+  0xff, 0xff, 0xff, 0xd0, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+  0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xff, 0xff, 0x3d, 0x31, 0xdc, 0xff,
+  0xff, 0xff, 0xff, 0x29, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x26, 0x17, 0x0a,
+  0x31, 0xd1, 0x06, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x31, 0xff,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff,
+  0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xa1, 0xff, 0xff, 0xff, 0xff, 0x03,
+  0x31, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x26, 0x2f, 0x31, 0xd6, 0xff, 0xff,
+  0xff, 0xff, 0x04, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xdd,
+  0x2b, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x31, 0xd5, 0xff, 0xff,
+  0xff, 0xff, 0x98, 0x26, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
+  0xff, 0xff, 0xaa, 0xff, 0xff, 0xff, 0xff, 0x32, 0x31, 0xd4, 0xff, 0xff,
+  0xff, 0xff, 0x13, 0x34, 0x26, 0xff, 0xff, 0xff, 0xff, 0x5b, 0x31, 0xc1,
+  0x2d, 0x26, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x31, 0xd3, 0xff, 0xff, 0xff,
+  0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x11, 0x15, 0x0b, 0xff, 0xff,
+  0xff, 0xff, 0x0a, 0x17, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff,
+  0xff, 0xfd, 0x26, 0x3a, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xd1, 0x25, 0x26, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xc0,
+  0x26, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0x3b,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xd8, 0x07, 0xff, 0xff, 0xff, 0xff, 0xe2,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x12, 0x31, 0xd5, 0x23, 0xff, 0xff,
+  0xff, 0xff, 0xc0, 0x26, 0xc2, 0x10, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xff,
+  0xff, 0xff, 0xff, 0x42, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd2, 0xff, 0xff,
+  0xff, 0xff, 0x0c, 0x05, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x31, 0xc4,
+  0xff, 0xff, 0xff, 0xff, 0x65, 0x26, 0xc0, 0x27, 0x31, 0xd5, 0xff, 0xff,
+  0xff, 0xff, 0x50, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x20, 0x31, 0xd9,
+  0x21, 0x26, 0xc1, 0x11, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x19, 0xff,
+  0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x26, 0xc1, 0xff,
+  0xff, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff, 0xff,
+  0xff, 0x26, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x26, 0xcb, 0x29,
+  0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0xff, 0x96,
+  0xff, 0xff, 0xff, 0xff, 0xef, 0x26, 0xc1, 0x18, 0x2b, 0xff, 0xff, 0xff,
+  0xff, 0x10, 0x31, 0xd8, 0x0a, 0x34, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf6,
+  0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd2, 0x3f,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x9b, 0x31, 0xff, 0xff, 0xff, 0xff,
+  0x56, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x30, 0x31, 0xff, 0xff, 0xff,
+  0xff, 0xc0, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xd5, 0x1d, 0x26, 0xc0, 0x19, 0x31, 0xdc, 0x0a, 0x38, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x31, 0xd5, 0x39, 0x26, 0xc2, 0x24,
+  0xff, 0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0xff, 0x32, 0x31, 0xd4,
+  0xff, 0xff, 0xff, 0xff, 0xa6, 0x26, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x31,
+  0xc2, 0x2d, 0x26, 0x35, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xff,
+  0xff, 0xff, 0x01, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x29, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xdf, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x0a,
+  0x33, 0xff, 0xff, 0xff, 0xff, 0x1a, 0xff, 0xff, 0xff, 0xff, 0x74, 0x24,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xea, 0xff, 0xff, 0xff, 0xff, 0x16, 0x31,
+  0xd7, 0xff, 0xff, 0xff, 0xff, 0x4a, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x84, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x07, 0x10, 0xff, 0xff, 0xff,
+  0xff, 0xdd, 0x26, 0xc3, 0x2c, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x3c, 0x31,
+  0xd2, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfb,
+  0xff, 0xff, 0xff, 0xff, 0x2a, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x0a,
+  0xff, 0xff, 0xff, 0xff, 0xd9, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xee,
+  0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x50, 0x26, 0xc1, 0xff, 0xff, 0xff,
+  0xff, 0x20, 0x31, 0xd9, 0x21, 0x26, 0xc1, 0x11, 0x31, 0xd4, 0xff, 0xff,
+  0xff, 0xff, 0x40, 0x20, 0x3a, 0x26, 0xc0, 0x2f, 0xff, 0xff, 0xff, 0xff,
+  0xaf, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x12, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0xd5, 0x35, 0x26, 0xcb, 0x29, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x08,
+  0xff, 0xff, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x1b, 0x26,
+  0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x01, 0x31, 0xd5, 0x3b, 0xff,
+  0xff, 0xff, 0xff, 0xe6, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
+  0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0xff,
+  0xff, 0x2b, 0x26, 0xc0, 0x1a, 0x31, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff,
+  0xff, 0xff, 0xff, 0xc4, 0x03, 0x08, 0xff, 0xff, 0xff, 0xff, 0x04, 0x31,
+  0xff, 0xff, 0xff, 0xff, 0xc1, 0x26, 0xc0, 0x28, 0x31, 0xd5, 0x1d, 0x26,
+  0xc0, 0x19, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x11, 0x04, 0x26, 0x03,
+  0x17, 0x31, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x02, 0x23, 0xff, 0xff, 0xff,
+  0xff, 0x56, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xf7, 0xff, 0xff, 0xff, 0xff, 0x54, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff,
+  0x4e, 0x26, 0x24, 0xff, 0xff, 0xff, 0xff, 0x28, 0x31, 0xc2, 0xff, 0xff,
+  0xff, 0xff, 0xf4, 0x26, 0x35, 0x31, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xab,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x3d, 0x31, 0xd0, 0xff, 0xff, 0xff,
+  0xff, 0x2b, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x31, 0xc3, 0xff,
+  0xff, 0xff, 0xff, 0x67, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x85, 0x31,
+  0xd7, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x26, 0x1b, 0xff, 0xff, 0xff, 0xff,
+  0x23, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0xff,
+  0xc4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x69,
+  0xff, 0xff, 0xff, 0xff, 0x19, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff,
+  0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3a, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xa9, 0x12, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff,
+  0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x26, 0x27, 0xff, 0xff,
+  0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x09, 0xff, 0xff, 0xff,
+  0xff, 0x3e, 0x14, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x26, 0x15, 0x31,
+  0xfd, 0xd2, 0x35, 0x26, 0xc0, 0x18, 0xff, 0xff, 0xff, 0xff, 0x74, 0xff,
+  0xff, 0xff, 0xff, 0x16, 0x31, 0xfd, 0xc3, 0x1c, 0xff, 0xff, 0xff, 0xff,
+  0x82, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0xa8, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x26, 0x2f, 0xff, 0xff,
+  0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0xff,
+  0xff, 0x1f, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x31, 0xc5, 0x14,
+  0x26, 0x2f, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x04, 0x26, 0xc0, 0x19,
+  0x31, 0xda, 0xff, 0xff, 0xff, 0xff, 0x09, 0xff, 0xff, 0xff, 0xff, 0xc4,
+  0x26, 0x10, 0xff, 0xff, 0xff, 0xff, 0x52, 0x31, 0xdc, 0x14, 0xff, 0xff,
+  0xff, 0xff, 0xc9, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
+  0xff, 0x22, 0x31, 0xd0, 0x21, 0x13, 0x26, 0xff, 0xff, 0xff, 0xff, 0x86,
+  0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x26, 0x35, 0x31, 0xdc, 0xff,
+  0xff, 0xff, 0xff, 0x55, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x78, 0x31,
+  0xd0, 0xff, 0xff, 0xff, 0xff, 0x20, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff,
+  0x2f, 0x31, 0xc3, 0x28, 0xff, 0xff, 0xff, 0xff, 0xef, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xd1, 0x31, 0xd6, 0x04, 0x3a, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xbe, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x96, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x4a, 0x31, 0xc3, 0x1e, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x6f, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x65, 0x3a, 0x26, 0xc4, 0xff,
+  0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xdf, 0x31, 0xfd, 0xd2, 0x35, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xce, 0xff, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff, 0xff, 0xff, 0x12,
+  0x31, 0xfd, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xff, 0xff, 0xff, 0xff,
+  0x7a, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x26, 0xc0, 0x29, 0x31, 0xd4, 0xff,
+  0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0x94, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x0d, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xb7, 0x31, 0xc5, 0x30, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xe7, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x04, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xb8, 0x31, 0xd9, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xb4,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x64, 0x31, 0xde, 0xff, 0xff, 0xff,
+  0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x83, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x88, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x0a, 0x31, 0xc3, 0xff, 0xff, 0xff,
+  0xff, 0xf4, 0x26, 0x35, 0x31, 0xdc, 0x0c, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x92, 0x31, 0xd0, 0x21, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xf8,
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xc2,
+  0x26, 0x24, 0x31, 0xd6, 0x2f, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x5b,
+  0x31, 0xd4, 0x1d, 0x2d, 0x26, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x31, 0xc4,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xd4, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x2c, 0xff,
+  0xff, 0xff, 0xff, 0x9c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
+  0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff,
+  0x55, 0x31, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xc8, 0x31, 0xfd, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff,
+  0xff, 0xae, 0x3a, 0x26, 0xc0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xa9, 0xff,
+  0xff, 0xff, 0xff, 0x48, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xfb, 0x3e, 0xff, 0xff, 0xff, 0xff, 0x56, 0xff, 0xff, 0xff,
+  0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x26, 0xc0, 0x03, 0xff, 0xff,
+  0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0x30, 0x31, 0xd4, 0xff, 0xff,
+  0xff, 0xff, 0x37, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x61, 0x31, 0xd6,
+  0x1e, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x31, 0xc4, 0x12, 0x19, 0x26,
+  0x3c, 0x31, 0xd6, 0x1d, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31,
+  0xd8, 0x07, 0x13, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x74, 0x31, 0xdf,
+  0x3e, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x31, 0xd0, 0x25, 0x26,
+  0xcb, 0xff, 0xff, 0xff, 0xff, 0x84, 0x31, 0xd9, 0x0c, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x91, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xed, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xe0, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xb4,
+  0x26, 0xc0, 0x3e, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x01, 0x30, 0x26,
+  0x36, 0xff, 0xff, 0xff, 0xff, 0x08, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff,
+  0x27, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x31, 0xc5, 0xff, 0xff,
+  0xff, 0xff, 0xbd, 0x26, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x04, 0x31, 0xda,
+  0xff, 0xff, 0xff, 0xff, 0xe8, 0x26, 0xff, 0xff, 0xff, 0xff, 0x9a, 0x31,
+  0xfd, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x1a, 0xff, 0xff, 0xff, 0xff, 0x7e,
+  0xff, 0xff, 0xff, 0xff, 0xe2, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xe4,
+  0xff, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x25, 0x31, 0xd3,
+  0x35, 0x26, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x31, 0xd3, 0xff, 0xff,
+  0xff, 0xff, 0x32, 0xff, 0xff, 0xff, 0xff, 0x93, 0x20, 0x26, 0xc1, 0xff,
+  0xff, 0xff, 0xff, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x21, 0x31, 0xd6,
+  0xff, 0xff, 0xff, 0xff, 0x40, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x5c,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x0d, 0x31, 0xc3,
+  0xff, 0xff, 0xff, 0xff, 0x2f, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x90,
+  0x31, 0xd6, 0x1d, 0x26, 0xc0, 0x19, 0x31, 0xd8, 0x39, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x7f, 0x31, 0xe0, 0x09, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xc0, 0x03, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x26, 0xcb, 0xff,
+  0xff, 0xff, 0xff, 0x84, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x52, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x77, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff,
+  0xc1, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x01,
+  0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x26, 0x24, 0x31, 0xd5, 0xff,
+  0xff, 0xff, 0xff, 0x44, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x94, 0x31,
+  0xd5, 0xff, 0xff, 0xff, 0xff, 0x2d, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x99, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x26, 0xc0, 0x09, 0x31,
+  0xd9, 0x0c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x31, 0xfd, 0xd6,
+  0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x2d, 0x10,
+  0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x1c, 0xff, 0xff, 0xff, 0xff,
+  0x0c, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x26, 0xcb, 0x29, 0x31,
+  0xd0, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xff,
+  0xff, 0xff, 0xff, 0xd0, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+  0xff, 0xff, 0xff, 0xa5, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x31, 0xd9, 0xff,
+  0xff, 0xff, 0xff, 0x40, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x59, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x7e,
+  0x26, 0xc0, 0x1d, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x04, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x8a,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x87, 0x31, 0xe1, 0xff, 0xff, 0xff,
+  0xff, 0x41, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x96, 0x31, 0xd9, 0xff,
+  0xff, 0xff, 0xff, 0xf4, 0x26, 0x35, 0x31, 0xdc, 0x32, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x3a, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x79, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff,
+  0x05, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xcf,
+  0x31, 0xd5, 0x34, 0x26, 0xc0, 0x0c, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff,
+  0x13, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x31, 0xc4, 0x07, 0xff,
+  0xff, 0xff, 0xff, 0xe9, 0x26, 0xff, 0xff, 0xff, 0xff, 0xec, 0x31, 0xda,
+  0xff, 0xff, 0xff, 0xff, 0xa0, 0x26, 0x0e, 0xff, 0xff, 0xff, 0xff, 0x0e,
+  0x31, 0xfd, 0xd9, 0x3b, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff,
+  0xff, 0xe6, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
+  0xff, 0x73, 0x31, 0xef, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x26, 0xc1,
+  0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0x74, 0x0d, 0x31,
+  0xf7, 0x02, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xd1, 0x28, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x12, 0x34, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x03, 0x31, 0xd6, 0x1d,
+  0x26, 0xc0, 0x19, 0x31, 0xd6, 0x1b, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x8f, 0x31, 0xe1, 0xff, 0xff, 0xff, 0xff, 0x08, 0xff, 0xff, 0xff, 0xff,
+  0xc7, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x46, 0x31, 0xd9, 0xff, 0xff,
+  0xff, 0xff, 0xf4, 0x26, 0x35, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x45,
+  0xff, 0xff, 0xff, 0xff, 0xfc, 0x26, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff,
+  0xff, 0xff, 0xff, 0x01, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff,
+  0xff, 0xff, 0xff, 0xfa, 0x26, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x31, 0xc3,
+  0xff, 0xff, 0xff, 0xff, 0x67, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x80,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xd4, 0x0d, 0x24, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xce, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xca, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x41, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x62, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff,
+  0x53, 0x10, 0x26, 0xff, 0xff, 0xff, 0xff, 0x89, 0x31, 0xd6, 0xff, 0xff,
+  0xff, 0xff, 0x50, 0x26, 0xc1, 0x11, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff,
+  0x24, 0x26, 0xc1, 0x21, 0x31, 0xdd, 0x1d, 0xff, 0xff, 0xff, 0xff, 0x52,
+  0xff, 0xff, 0xff, 0xff, 0xba, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x26, 0x29,
+  0x31, 0xef, 0x35, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff,
+  0xff, 0xab, 0xff, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0xff, 0x01,
+  0x31, 0xfa, 0xff, 0xff, 0xff, 0xff, 0x74, 0x26, 0xc0, 0x03, 0xff, 0xff,
+  0xff, 0xff, 0x2b, 0x09, 0xff, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff,
+  0xff, 0xcd, 0x26, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x31, 0xd7, 0x1d,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xd5, 0xff, 0xff, 0xff,
+  0xff, 0x71, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x94, 0x31, 0xd9, 0xff,
+  0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff,
+  0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x4a, 0x3f, 0xff, 0xff, 0xff, 0xff,
+  0x13, 0x1d, 0xff, 0xff, 0xff, 0xff, 0x19, 0xff, 0xff, 0xff, 0xff, 0x58,
+  0xff, 0xff, 0xff, 0xff, 0xd2, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb3,
+  0x31, 0xda, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x26, 0x35, 0x31, 0xd2, 0xff,
+  0xff, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xff, 0xff,
+  0xff, 0x8a, 0x28, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0x0d, 0xff, 0xff, 0xff, 0xff, 0x07, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x84,
+  0x24, 0x26, 0x0e, 0xff, 0xff, 0xff, 0xff, 0x35, 0x31, 0xd3, 0xff, 0xff,
+  0xff, 0xff, 0x8d, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x3f, 0xff,
+  0xff, 0xff, 0xff, 0x05, 0x04, 0xff, 0xff, 0xff, 0xff, 0x73, 0x24, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xe6, 0x02, 0x31, 0xd4, 0x22, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x6b, 0x31, 0xd7, 0x33, 0x1b, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x6a, 0xff, 0xff, 0xff, 0xff, 0x18,
+  0xff, 0xff, 0xff, 0xff, 0x04, 0x3b, 0xff, 0xff, 0xff, 0xff, 0x7b, 0x24,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0x27, 0x31,
+  0xd2, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xff, 0xff, 0x7a, 0x17,
+  0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xff, 0xff,
+  0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xff, 0x92, 0x10, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xd3, 0x2a, 0x31, 0xd6, 0x21, 0x26, 0xc1, 0x11, 0x31, 0xd9,
+  0xff, 0xff, 0xff, 0xff, 0x24, 0x26, 0xc1, 0x21, 0x31, 0xe0, 0xff, 0xff,
+  0xff, 0xff, 0x22, 0x14, 0x37, 0x31, 0xef, 0xff, 0xff, 0xff, 0xff, 0xab,
+  0x2f, 0xff, 0xff, 0xff, 0xff, 0x17, 0x31, 0xe0, 0xff, 0xff, 0xff, 0xff,
+  0x58, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x70, 0x31, 0xd8, 0xff, 0xff,
+  0xff, 0xff, 0x97, 0x26, 0xc4, 0x10, 0xff, 0xff, 0xff, 0xff, 0x72, 0x31,
+  0xd4, 0x21, 0x26, 0xc8, 0x2d, 0x31, 0xd1, 0x15, 0x26, 0xc9, 0xff, 0xff,
+  0xff, 0xff, 0x7c, 0x31, 0xd0, 0x11, 0x26, 0xc8, 0x0a, 0x1f, 0x31, 0xda,
+  0x2d, 0x26, 0x35, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x26, 0xc7,
+  0x34, 0xff, 0xff, 0xff, 0xff, 0x41, 0x31, 0xd4, 0x1d, 0xff, 0xff, 0xff,
+  0xff, 0xa9, 0x26, 0xc5, 0x13, 0xff, 0xff, 0xff, 0xff, 0x33, 0x31, 0xd5,
+  0xff, 0xff, 0xff, 0xff, 0xd7, 0x26, 0x0e, 0xff, 0xff, 0xff, 0xff, 0x11,
+  0x31, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x62, 0x0e, 0x26, 0xc5, 0x15, 0xff,
+  0xff, 0xff, 0xff, 0x45, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x26,
+  0xc5, 0x1d, 0xff, 0xff, 0xff, 0xff, 0x16, 0x31, 0xd7, 0x21, 0x26, 0xc1,
+  0x11, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x25, 0x26, 0xc1, 0xff, 0xff,
+  0xff, 0xff, 0x4d, 0x31, 0xfd, 0xfb, 0x39, 0x26, 0xc0, 0x01, 0x31, 0xd9,
+  0xff, 0xff, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff,
+  0xff, 0xff, 0xe8, 0x24, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff,
+  0xff, 0xa6, 0xff, 0xff, 0xff, 0xff, 0x37, 0x31, 0xd5, 0x21, 0x26, 0xc8,
+  0xff, 0xff, 0xff, 0xff, 0xf4, 0x31, 0xd1, 0x15, 0x26, 0xc9, 0x05, 0x31,
+  0xd1, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0x6d, 0xff,
+  0xff, 0xff, 0xff, 0xae, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x29, 0xff, 0xff,
+  0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff,
+  0xd6, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x31,
+  0xdc, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc,
+  0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x36, 0xff, 0xff, 0xff, 0xff, 0x8a,
+  0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xff, 0xff,
+  0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
+  0xea, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x73, 0xff,
+  0xff, 0xff, 0xff, 0x0e, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xff,
+  0xff, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x2f, 0x0c, 0xff,
+  0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xff,
+  0xff, 0x12, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x31, 0xda, 0xff, 0xff,
+  0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff,
+  0xce, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xee,
+  0xff, 0xff, 0xff, 0xff, 0xc6, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff,
+  0xff, 0xff, 0x15, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xff,
+  0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xff, 0xff,
+  0xeb, 0x19, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xad,
+  0xff, 0xff, 0xff, 0xff, 0x56, 0xff, 0xff, 0xff, 0xff, 0x01, 0x31, 0xd8,
+  0x21, 0x26, 0xc1, 0x11, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x52, 0x26,
+  0xc0, 0x29, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x31, 0xfd, 0xfb, 0x39, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x70, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xc6, 0xff, 0xff, 0xff, 0xff, 0x94, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x6e, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xca,
+  0x2e, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x3e, 0x31, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc9, 0x04, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x63, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xca,
+  0x1a, 0x26, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x04, 0x31, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc5, 0xff, 0xff, 0xff, 0xff, 0x69,
+  0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x43, 0x31, 0xd5, 0xff, 0xff, 0xff,
+  0xff, 0xbc, 0x26, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
+  0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xff, 0xff, 0xff, 0xff, 0x86,
+  0x06, 0x31, 0xd7, 0x0e, 0xff, 0xff, 0xff, 0xff, 0x95, 0xff, 0xff, 0xff,
+  0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x38, 0xff, 0xff, 0xff, 0xff,
+  0xdb, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0x67, 0xff,
+  0xff, 0xff, 0xff, 0x13, 0x31, 0xd0, 0x11, 0x26, 0xc2, 0xff, 0xff, 0xff,
+  0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xc4,
+  0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x31, 0xd5,
+  0x21, 0x26, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x31, 0xd2, 0x21, 0x26,
+  0xc9, 0xff, 0xff, 0xff, 0xff, 0x34, 0x31, 0xd3, 0x2a, 0xff, 0xff, 0xff,
+  0xff, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xe4,
+  0x24, 0x3f, 0x21, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff,
+  0x4b, 0xff, 0xff, 0xff, 0xff, 0x06, 0x31, 0xd0, 0x11, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xa8, 0x31, 0xc5, 0x35, 0x26, 0x05, 0x31, 0xd1, 0xff,
+  0xff, 0xff, 0xff, 0x40, 0x26, 0xc9, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x26, 0xc5,
+  0x0d, 0x31, 0xd1, 0x11, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x31,
+  0xc5, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x38, 0x26, 0x3d, 0xff, 0xff, 0xff,
+  0xff, 0x22, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x10, 0x26, 0xc0, 0x19,
+  0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x26, 0xc0, 0x24, 0xff, 0xff,
+  0xff, 0xff, 0x11, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x39, 0x26, 0xc1,
+  0x29, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x18, 0x26, 0xc1, 0xff, 0xff,
+  0xff, 0xff, 0x9d, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xf4, 0x31, 0xd3, 0x07, 0xff, 0xff, 0xff, 0xff, 0x61,
+  0xff, 0xff, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0xff,
+  0xff, 0xff, 0xf9, 0x08, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x16, 0x31, 0xd7,
+  0xff, 0xff, 0xff, 0xff, 0x0d, 0xff, 0xff, 0xff, 0xff, 0x65, 0xff, 0xff,
+  0xff, 0xff, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
+  0xf6, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x09, 0xff, 0xff, 0xff, 0xff, 0x72,
+  0xff, 0xff, 0xff, 0xff, 0x08, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xb9,
+  0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x93, 0x31, 0xd5, 0x05, 0x26, 0xc7,
+  0x03, 0xff, 0xff, 0xff, 0xff, 0x5d, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff,
+  0x07, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x26, 0xc6, 0xff, 0xff, 0xff, 0xff,
+  0xac, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x20, 0x26, 0xc7, 0x15, 0x21,
+  0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x50, 0x26, 0xc9, 0xff, 0xff, 0xff,
+  0xff, 0xd0, 0x31, 0xd2, 0x21, 0x26, 0xc9, 0xff, 0xff, 0xff, 0xff, 0x34,
+  0x31, 0xd2, 0x12, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x26, 0xc6, 0xff, 0xff,
+  0xff, 0xff, 0x64, 0x31, 0xd0, 0x11, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0xa8, 0x31, 0xc5, 0x35, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x31, 0xd1,
+  0xff, 0xff, 0xff, 0xff, 0x40, 0x26, 0xc9, 0xff, 0xff, 0xff, 0xff, 0x14,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x26,
+  0xc5, 0x0d, 0x31, 0xd1, 0x11, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa8,
+  0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x39, 0xff, 0xff, 0xff, 0xff, 0xf3,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x27, 0x31,
+  0xd0, 0xff, 0xff, 0xff, 0xff, 0x10, 0x26, 0xc0, 0x19, 0x31, 0xd9, 0xff,
+  0xff, 0xff, 0xff, 0xd4, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x63, 0x31,
+  0xc3, 0xff, 0xff, 0xff, 0xff, 0x91, 0x26, 0xc1, 0x29, 0x31, 0xcf, 0x39,
+  0x26, 0xc1, 0x03, 0xff, 0xff, 0xff, 0xff, 0x11, 0x31, 0xc3, 0xff, 0xff,
+  0xff, 0xff, 0xb4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x31, 0xd2, 0xff,
+  0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x26, 0xc5, 0xff,
+  0xff, 0xff, 0xff, 0xa5, 0xff, 0xff, 0xff, 0xff, 0x03, 0x31, 0xd4, 0xff,
+  0xff, 0xff, 0xff, 0x55, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x26, 0xc5, 0xff,
+  0xff, 0xff, 0xff, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x1d, 0x31, 0xd4, 0xff,
+  0xff, 0xff, 0xff, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x26, 0x23, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xe2, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xbc,
+  0x26, 0xc0, 0x35, 0x31, 0xc0, 0x12, 0xff, 0xff, 0xff, 0xff, 0x17, 0xff,
+  0xff, 0xff, 0xff, 0x59, 0x13, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
+  0xff, 0xff, 0xff, 0x34, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x04, 0x3a,
+  0x26, 0xc0, 0x38, 0xff, 0xff, 0xff, 0xff, 0x43, 0x2c, 0xff, 0xff, 0xff,
+  0xff, 0x0a, 0xff, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0xff, 0x8d,
+  0x0e, 0x15, 0x31, 0xd0, 0x11, 0x26, 0xc0, 0x29, 0x31, 0xff, 0xff, 0xff,
+  0xff, 0x09, 0x3b, 0xff, 0xff, 0xff, 0xff, 0x54, 0x19, 0x26, 0xc0, 0x23,
+  0x21, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x50, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x74, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xf8, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x47, 0x19,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xef, 0x17, 0xff, 0xff, 0xff, 0xff, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff,
+  0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x26, 0x3d, 0x31, 0xd0,
+  0x11, 0x26, 0xc0, 0x29, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x26,
+  0x05, 0x31, 0xd6, 0x19, 0x26, 0x35, 0x31, 0xde, 0x01, 0x26, 0xc0, 0x0d,
+  0x31, 0xd1, 0x11, 0x26, 0xc0, 0x29, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff,
+  0x34, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x26, 0x0a, 0xff, 0xff, 0xff, 0xff,
+  0x2b, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x10, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0xb8, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x26, 0x2b,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xba, 0x31, 0xc2, 0x07, 0xff, 0xff, 0xff,
+  0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xf3,
+  0x26, 0x29, 0x31, 0xcf, 0x39, 0x26, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x73,
+  0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xf4, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x99, 0xff, 0xff, 0xff, 0xff, 0x24, 0x3e, 0xff, 0xff, 0xff,
+  0xff, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x8b, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x70, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xc9, 0x1c, 0xff, 0xff, 0xff, 0xff, 0x21, 0x09, 0xff,
+  0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff, 0xff, 0xff,
+  0xff, 0xe1, 0x26, 0xff, 0xff, 0xff, 0xff, 0xce, 0x33, 0x31, 0xd3, 0xff,
+  0xff, 0xff, 0xff, 0x59, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
+  0xff, 0xff, 0x47, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x33, 0x31, 0xd4,
+  0xff, 0xff, 0xff, 0xff, 0xbc, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x0c,
+  0x31, 0xc3, 0x28, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x31, 0xd2,
+  0x10, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x31, 0xc4, 0x27, 0x10,
+  0x31, 0xd0, 0x11, 0x26, 0xc0, 0x29, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff,
+  0x71, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x31, 0xd2, 0xff, 0xff,
+  0xff, 0xff, 0x50, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x74, 0x31, 0xdb,
+  0xff, 0xff, 0xff, 0xff, 0xd0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x31,
+  0xda, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0x24, 0x31, 0xc4,
+  0xff, 0xff, 0xff, 0xff, 0x4d, 0xff, 0xff, 0xff, 0xff, 0x54, 0x31, 0xd0,
+  0x11, 0x26, 0xc0, 0x29, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xfc, 0x31, 0xd6, 0x19, 0x26, 0x35, 0x31, 0xde,
+  0xff, 0xff, 0xff, 0xff, 0xb0, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x14,
+  0x31, 0xd1, 0x11, 0x26, 0xc0, 0x29, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff,
+  0x2f, 0xff, 0xff, 0xff, 0xff, 0xee, 0x26, 0x2b, 0x36, 0x31, 0xd2, 0xff,
+  0xff, 0xff, 0xff, 0x10, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31,
+  0xd9, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb9,
+  0xff, 0xff, 0xff, 0xff, 0xe2, 0x05, 0xff, 0xff, 0xff, 0xff, 0x15, 0x31,
+  0xc1, 0x12, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xff,
+  0xe8, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x31, 0xcf, 0x39, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xf4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff,
+  0xff, 0xff, 0xff, 0x01, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xf4, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x40,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0xc2, 0x07, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x26, 0x2f, 0xff, 0xff, 0xff,
+  0xff, 0x22, 0x31, 0xd1, 0x37, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x76,
+  0x07, 0x31, 0xc3, 0x39, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0x67, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff,
+  0xff, 0xe8, 0x26, 0xff, 0xff, 0xff, 0xff, 0x83, 0x31, 0xd4, 0xff, 0xff,
+  0xff, 0xff, 0xbc, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x31, 0xc3,
+  0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x26, 0x14,
+  0x31, 0xd1, 0x2c, 0x0e, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff,
+  0xff, 0xff, 0x03, 0x31, 0xd8, 0x11, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0xa8, 0x31, 0xc4, 0x05, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0x26, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x50, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x74, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xd0,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x31, 0xda, 0xff, 0xff, 0xff, 0xff,
+  0x8a, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x31, 0xd9, 0x11, 0x26,
+  0xc0, 0x29, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xfc, 0x31, 0xd6, 0x19, 0x26, 0x35, 0x31, 0xde, 0x01, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x14, 0x31, 0xd1, 0x11, 0x26, 0xc0, 0x29,
+  0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xea,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x34, 0x31,
+  0xd3, 0xff, 0xff, 0xff, 0xff, 0x10, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0xb8, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x26, 0x19, 0xff, 0xff,
+  0xff, 0xff, 0x8c, 0x26, 0xff, 0xff, 0xff, 0xff, 0x69, 0x31, 0xc1, 0xff,
+  0xff, 0xff, 0xff, 0x9b, 0x26, 0x25, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xa8, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x18,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xf6,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0x49, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff,
+  0xb4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x31, 0xd1, 0xff, 0xff, 0xff,
+  0xff, 0xa6, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x31, 0xc3, 0xff,
+  0xff, 0xff, 0xff, 0x4f, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x81, 0x31,
+  0xd0, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0x78, 0x31, 0xc6, 0xff, 0xff, 0xff, 0xff, 0x5b,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff,
+  0x06, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x26, 0xff, 0xff, 0xff, 0xff, 0x74,
+  0x31, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd3,
+  0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x0c, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xbd, 0x31, 0xd1, 0x20, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x6b, 0x31, 0xd9, 0x11, 0x26, 0xc0, 0x29, 0x31, 0xc4, 0x04, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x87, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff,
+  0x50, 0x26, 0xc0, 0x2d, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xf8, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x05,
+  0xff, 0xff, 0xff, 0xff, 0xea, 0x26, 0x34, 0x07, 0x31, 0xd9, 0x11, 0x26,
+  0xc0, 0x29, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xfc, 0x31, 0xd6, 0x19, 0x26, 0x35, 0x31, 0xde, 0xff, 0xff,
+  0xff, 0xff, 0xb0, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x14, 0x31, 0xd1,
+  0x11, 0x26, 0xc0, 0x29, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xe7, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
+  0xff, 0xff, 0x39, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x10, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xd4,
+  0x26, 0x19, 0xff, 0xff, 0xff, 0xff, 0x34, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xc1, 0x31, 0xc0, 0x28, 0x2b, 0x0e, 0xff, 0xff, 0xff, 0xff, 0x0d, 0xff,
+  0xff, 0xff, 0xff, 0xe8, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x31, 0xcf,
+  0x39, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x90, 0x30, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xb4, 0x31, 0xc2, 0x2d, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf4,
+  0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xef,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff,
+  0x0a, 0x05, 0x26, 0x35, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x7a, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xc8, 0x07, 0x31, 0xc6, 0xff, 0xff, 0xff, 0xff,
+  0x0b, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x07, 0x31, 0xd1, 0x14, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x28, 0x31, 0xff, 0xff, 0xff, 0xff, 0x51,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x23, 0x31, 0xd3, 0xff, 0xff, 0xff,
+  0xff, 0xbc, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x31, 0xc3, 0xff,
+  0xff, 0xff, 0xff, 0x5a, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x89, 0x31,
+  0xd1, 0x17, 0x26, 0xc0, 0x27, 0x31, 0xd9, 0x11, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0xa8, 0x31, 0xc4, 0x39, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0xc2, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x50, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x74, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xf8, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x35, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x31, 0xda, 0x11, 0x26, 0xc0, 0x29,
+  0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xfc, 0x31, 0xd6, 0x19, 0x26, 0x35, 0x31, 0xde, 0x01, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x14, 0x31, 0xd1, 0x11, 0x26, 0xc0, 0x29, 0x31, 0xff,
+  0xff, 0xff, 0xff, 0x22, 0x3d, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff,
+  0xff, 0xff, 0xff, 0x3e, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x10, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff,
+  0xd4, 0x26, 0x19, 0x31, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff,
+  0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x1a, 0x31, 0xff, 0xff, 0xff, 0xff,
+  0x4d, 0x26, 0xff, 0xff, 0xff, 0xff, 0xae, 0x31, 0xff, 0xff, 0xff, 0xff,
+  0xe8, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x31, 0xcf, 0x39, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0xff, 0x32, 0x26, 0x10,
+  0x27, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xf4, 0x31, 0xd0, 0x11, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb3,
+  0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xf8, 0xff, 0xff, 0xff, 0xff, 0x02, 0x31, 0xce, 0x3c, 0xff, 0xff, 0xff,
+  0xff, 0xe0, 0x26, 0x00, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x09, 0xff,
+  0xff, 0xff, 0xff, 0x7b, 0x23, 0x19, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xff,
+  0xff, 0xff, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0x14, 0x3d, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x13, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x99, 0x26,
+  0x1a, 0x31, 0xc0, 0x2a, 0x19, 0x26, 0xff, 0xff, 0xff, 0xff, 0x73, 0x31,
+  0xd3, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x0c, 0x31, 0xc0, 0x12, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x63, 0xff, 0xff,
+  0xff, 0xff, 0xee, 0x26, 0x08, 0x0d, 0x31, 0xd1, 0x13, 0x26, 0x2d, 0x3c,
+  0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x20, 0x26, 0xc0, 0x29, 0x31, 0xc5,
+  0x0c, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x31, 0xd1, 0xff, 0xff, 0xff,
+  0xff, 0x50, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x74, 0x31, 0xdb, 0xff,
+  0xff, 0xff, 0xff, 0xd0, 0x26, 0x19, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff,
+  0x69, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x75, 0x31, 0xda, 0x11, 0x26,
+  0xc0, 0x29, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xfc, 0x31, 0xd6, 0x19, 0x26, 0x35, 0x31, 0xde, 0x01, 0x26,
+  0xc0, 0x0d, 0x31, 0xd1, 0x11, 0x26, 0xc0, 0x29, 0xff, 0xff, 0xff, 0xff,
+  0x1e, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x26, 0x0e, 0xff, 0xff, 0xff, 0xff,
+  0x43, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x10, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0xb8, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x26, 0x19,
+  0x31, 0xff, 0xff, 0xff, 0xff, 0x84, 0x26, 0xff, 0xff, 0xff, 0xff, 0x70,
+  0x31, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x26, 0xff, 0xff, 0xff, 0xff, 0x57,
+  0x31, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa8,
+  0x31, 0xcf, 0x39, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x90, 0x31, 0xff,
+  0xff, 0xff, 0xff, 0xc7, 0x26, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x31, 0xc1,
+  0xff, 0xff, 0xff, 0xff, 0xb4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x31,
+  0xd0, 0xff, 0xff, 0xff, 0xff, 0x45, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x97, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x21, 0x31, 0xce, 0xff, 0xff, 0xff, 0xff, 0x26, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0x04, 0x31, 0xc0, 0x2a,
+  0x09, 0x26, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xff,
+  0xe6, 0x26, 0xff, 0xff, 0xff, 0xff, 0x1c, 0x31, 0xd0, 0x3c, 0x13, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0x8f, 0x31, 0xc1, 0x19, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xc3, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x26, 0xc6, 0xff,
+  0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0x95, 0xff, 0xff, 0xff,
+  0xff, 0x16, 0x31, 0xd1, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x26, 0x39,
+  0x31, 0xda, 0xff, 0xff, 0xff, 0xff, 0x20, 0x26, 0xc0, 0x29, 0x31, 0xc5,
+  0xff, 0xff, 0xff, 0xff, 0xdc, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x08,
+  0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x50, 0x26, 0xc9, 0xff, 0xff, 0xff,
+  0xff, 0x64, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x26, 0xc8, 0xff,
+  0xff, 0xff, 0xff, 0x58, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x85, 0x26,
+  0xc0, 0x39, 0x31, 0xda, 0x11, 0x26, 0xca, 0xff, 0xff, 0xff, 0xff, 0xfc,
+  0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x26, 0x35, 0x31, 0xde, 0xff,
+  0xff, 0xff, 0xff, 0xb0, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x14, 0x31,
+  0xd1, 0x11, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x25, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xcf, 0x1d, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff,
+  0x10, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xd9, 0xff, 0xff,
+  0xff, 0xff, 0xd4, 0x26, 0x19, 0x31, 0xff, 0xff, 0xff, 0xff, 0x2c, 0x26,
+  0x3e, 0xff, 0xff, 0xff, 0xff, 0x0a, 0x22, 0xff, 0xff, 0xff, 0xff, 0xf5,
+  0x2a, 0x31, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xa8, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x18, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x90, 0x31, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xed, 0x14, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xf4, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x57,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x86, 0x31, 0xc5, 0xff, 0xff, 0xff,
+  0xff, 0xab, 0x26, 0xc0, 0x17, 0x31, 0xce, 0xff, 0xff, 0xff, 0xff, 0x5d,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff,
+  0x97, 0x26, 0x2b, 0xff, 0xff, 0xff, 0xff, 0x60, 0x23, 0xff, 0xff, 0xff,
+  0xff, 0x19, 0xff, 0xff, 0xff, 0xff, 0x68, 0x22, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x1c, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x39, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x42, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x6b,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x23, 0x31, 0xd2, 0xff, 0xff, 0xff,
+  0xff, 0xbc, 0x26, 0xc6, 0x03, 0xff, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff,
+  0xff, 0xff, 0x2d, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x10, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xcd, 0x31, 0xda, 0xff, 0xff, 0xff, 0xff, 0x20,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x31, 0xc5, 0xff, 0xff, 0xff,
+  0xff, 0xd2, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x17, 0x31, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0x50, 0x26, 0xc9, 0x3d, 0x31, 0xd2, 0xff, 0xff, 0xff,
+  0xff, 0xd0, 0x26, 0xc8, 0xff, 0xff, 0xff, 0xff, 0x58, 0x31, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0x94, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x31,
+  0xc2, 0xff, 0xff, 0xff, 0xff, 0x84, 0x26, 0xc3, 0xff, 0xff, 0xff, 0xff,
+  0x18, 0x31, 0xcf, 0x11, 0x26, 0xca, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x31,
+  0xd6, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x26, 0x35, 0x31, 0xde, 0x01, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x14, 0x31, 0xd1, 0x11, 0x26, 0xc5, 0xff,
+  0xff, 0xff, 0xff, 0x7e, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x10, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff,
+  0xd4, 0x26, 0x19, 0x31, 0xc0, 0x0d, 0x26, 0xff, 0xff, 0xff, 0xff, 0x77,
+  0x26, 0x29, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xa8, 0x31, 0xcf, 0x39, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x90, 0x31, 0xff, 0xff, 0xff, 0xff, 0x07, 0x3f, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0x61, 0x31, 0xc0, 0x2d, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x31,
+  0xd0, 0xff, 0xff, 0xff, 0xff, 0x62, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x7f, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x31, 0xce, 0xff, 0xff, 0xff,
+  0xff, 0x80, 0x26, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfa,
+  0x26, 0x00, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x5e, 0x26, 0xc0, 0x25,
+  0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x89, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xf1, 0xff, 0xff, 0xff, 0xff, 0x05, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff,
+  0x1f, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x63, 0x31, 0xd2, 0xff, 0xff,
+  0xff, 0xff, 0xbc, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x31, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0x04, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff,
+  0xff, 0xff, 0xff, 0xd5, 0x26, 0x03, 0x1b, 0x31, 0xd0, 0xff, 0xff, 0xff,
+  0xff, 0x11, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x31, 0xda, 0x11,
+  0x26, 0xc0, 0x29, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x26, 0xc0,
+  0x39, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x50, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x74, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xf8, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x95, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x31, 0xc2, 0x1d, 0x26, 0xc3, 0x39,
+  0x31, 0xcf, 0x11, 0x26, 0xc0, 0x29, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff,
+  0xcc, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x31, 0xd6, 0x19, 0x26, 0x35,
+  0x31, 0xde, 0x01, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x14, 0x31, 0xd1,
+  0x11, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff,
+  0x54, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfb,
+  0xff, 0xff, 0xff, 0xff, 0x34, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x10,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xd9, 0xff, 0xff, 0xff,
+  0xff, 0xd4, 0x26, 0x19, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x26,
+  0x24, 0x26, 0xff, 0xff, 0xff, 0xff, 0x51, 0x31, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xe8, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x31, 0xcf, 0x39, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x90, 0x31, 0xc0, 0x33, 0x26, 0x35, 0x31,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf4,
+  0x31, 0xd0, 0x32, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x31, 0xc5,
+  0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x3d,
+  0x31, 0xce, 0xff, 0xff, 0xff, 0xff, 0x91, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0x75, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x45, 0x26, 0x1e, 0x31, 0xc3,
+  0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x26, 0x25,
+  0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xaa, 0x31, 0xc3, 0x37, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x31, 0xd2,
+  0xff, 0xff, 0xff, 0xff, 0xbc, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x0c,
+  0x31, 0xc3, 0x16, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x26, 0x11, 0xff, 0xff,
+  0xff, 0xff, 0x05, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0x26, 0x39, 0x31, 0xda, 0xff, 0xff, 0xff, 0xff, 0x20,
+  0x26, 0xc0, 0x29, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x09, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x50,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x74, 0x31, 0xdb, 0xff, 0xff, 0xff,
+  0xff, 0xd0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x31, 0xd9, 0xff, 0xff,
+  0xff, 0xff, 0x85, 0x26, 0xc0, 0x2e, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff,
+  0x8c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x18, 0x31, 0xcf, 0x11, 0x26,
+  0xc0, 0x29, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xfc, 0x31, 0xd6, 0x19, 0x26, 0x35, 0x31, 0xde, 0x01, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x14, 0x31, 0xd1, 0x11, 0x26, 0xc0, 0x05,
+  0xff, 0xff, 0xff, 0xff, 0x52, 0x31, 0xff, 0xff, 0xff, 0xff, 0x40, 0x1b,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x14, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0xd4, 0xff, 0xff, 0xff, 0xff, 0x10, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0xb8, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x26, 0x19, 0x31, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x24, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xf2,
+  0x09, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xa8, 0x31, 0xcf, 0x39, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x90,
+  0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x1e, 0x05, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0x37, 0x31, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xf4, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x58, 0x26, 0xc0, 0x33,
+  0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xab, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x32, 0x31, 0xce, 0xff, 0xff, 0xff, 0xff, 0x9b, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0x6b, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x57, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xc9, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xda, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0x1c, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x28,
+  0x26, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x2a, 0x31, 0xd1, 0xff, 0xff,
+  0xff, 0xff, 0xbc, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x31, 0xc4,
+  0xff, 0xff, 0xff, 0xff, 0x76, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x4a,
+  0x31, 0xd0, 0x1e, 0x26, 0x2d, 0x3c, 0x31, 0xd9, 0x11, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xa8, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xf3, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x50,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x74, 0x31, 0xdb, 0xff, 0xff, 0xff,
+  0xff, 0xd0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x31, 0xd9, 0x0a, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x72, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff,
+  0x8c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x18, 0x31, 0xcf, 0x11, 0x26,
+  0xc0, 0x29, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xfc, 0x31, 0xd6, 0x19, 0x26, 0x35, 0x31, 0xde, 0xff, 0xff,
+  0xff, 0xff, 0xb0, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x14, 0x31, 0xd1,
+  0x11, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xac, 0x31, 0xc1, 0xff, 0xff,
+  0xff, 0xff, 0x94, 0x26, 0xc0, 0x2c, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff,
+  0x10, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xd9, 0xff, 0xff,
+  0xff, 0xff, 0xd4, 0x26, 0x19, 0x31, 0xc1, 0x35, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xa3, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xa8, 0x31, 0xcf, 0x39, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x90, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xa2, 0x31, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xf4, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x47, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x97, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x21, 0x31, 0xce, 0xff, 0xff, 0xff, 0xff,
+  0x8d, 0x26, 0xff, 0xff, 0xff, 0xff, 0x7a, 0x31, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x45, 0x26, 0x1e, 0x31, 0xc3, 0x3c, 0x38, 0x26, 0x25, 0x31, 0xcf,
+  0xff, 0xff, 0xff, 0xff, 0x79, 0x26, 0xc9, 0xff, 0xff, 0xff, 0xff, 0x53,
+  0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x0c, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x48, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x7b, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x26,
+  0xc0, 0x1c, 0x31, 0xd9, 0x11, 0x26, 0xc0, 0x29, 0x31, 0xc4, 0xff, 0xff,
+  0xff, 0xff, 0x17, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x31, 0xd1,
+  0xff, 0xff, 0xff, 0xff, 0x50, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x74,
+  0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xf8, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x38, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x9c, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x26, 0xc0,
+  0x39, 0x31, 0xcf, 0x11, 0x26, 0xc0, 0x29, 0x31, 0xc5, 0xff, 0xff, 0xff,
+  0xff, 0xcc, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x31, 0xd6, 0xff, 0xff,
+  0xff, 0xff, 0xf8, 0x26, 0x35, 0x31, 0xde, 0xff, 0xff, 0xff, 0xff, 0xb2,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x11, 0x31, 0xd1, 0x11, 0x26, 0xc0,
+  0x29, 0x31, 0xc1, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xde, 0x26, 0x1b, 0xff,
+  0xff, 0xff, 0xff, 0x43, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x10, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xd9, 0x0d, 0x26, 0x19, 0x31,
+  0xc7, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa8,
+  0x31, 0xcf, 0x39, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x90, 0x31, 0xc1,
+  0xff, 0xff, 0xff, 0xff, 0x44, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+  0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xf4, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x22, 0x26, 0xc0,
+  0x17, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x26, 0x19, 0x07, 0x31,
+  0xce, 0x3a, 0x26, 0x21, 0x31, 0xc0, 0x16, 0xff, 0xff, 0xff, 0xff, 0xfa,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff,
+  0x5e, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x1c, 0x31, 0xcf, 0x14, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xb7, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xe3,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff,
+  0xbc, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x31, 0xc4, 0x12, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x85, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff,
+  0x71, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x31, 0xd9, 0x11, 0x26,
+  0xc0, 0x29, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x58, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x89, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x50, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x74, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff,
+  0xd0, 0x26, 0x19, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff,
+  0xff, 0xff, 0xed, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x31, 0xc5, 0xff,
+  0xff, 0xff, 0xff, 0x8c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x18, 0x31,
+  0xcf, 0x11, 0x26, 0xc0, 0x29, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xcc,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x31, 0xd6, 0x19, 0x26, 0x35, 0x31,
+  0xde, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x04, 0x31, 0xd1, 0x11, 0x26, 0xc0, 0x29, 0x31, 0xc2, 0xff, 0xff, 0xff,
+  0xff, 0x41, 0x1b, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x16, 0x31, 0xd2,
+  0xff, 0xff, 0xff, 0xff, 0x10, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb8,
+  0x31, 0xd9, 0x0d, 0x26, 0x19, 0x31, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xe8,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x31, 0xcf, 0x39, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x90, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff,
+  0xff, 0xff, 0xff, 0xd8, 0x26, 0xff, 0xff, 0xff, 0xff, 0x78, 0xff, 0xff,
+  0xff, 0xff, 0xb4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x31, 0xd0, 0x07,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0x26, 0x1c, 0x31, 0xc4, 0xff, 0xff, 0xff,
+  0xff, 0x0a, 0x05, 0x26, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x31, 0xcf, 0x37,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff,
+  0x98, 0x26, 0x2b, 0xff, 0xff, 0xff, 0xff, 0x60, 0x18, 0xff, 0xff, 0xff,
+  0xff, 0x18, 0xff, 0xff, 0xff, 0xff, 0x68, 0x22, 0x26, 0xc0, 0x25, 0x31,
+  0xce, 0x04, 0x1b, 0x26, 0x19, 0x31, 0xc5, 0x32, 0x26, 0x2b, 0x1d, 0x31,
+  0xd0, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x0c, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x65, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x6d, 0x31, 0xd0, 0x18, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x26,
+  0x2e, 0xff, 0xff, 0xff, 0xff, 0x03, 0x31, 0xd8, 0xff, 0xff, 0xff, 0xff,
+  0x20, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x31, 0xc4, 0xff, 0xff,
+  0xff, 0xff, 0xba, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x28, 0x31, 0xd1,
+  0xff, 0xff, 0xff, 0xff, 0x50, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x74,
+  0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xf8, 0x31, 0xda, 0xff, 0xff, 0xff, 0xff, 0x91, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x4b, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x26, 0xc0,
+  0x39, 0x31, 0xcf, 0x11, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x31,
+  0xc5, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfc,
+  0x31, 0xd6, 0x19, 0x26, 0x35, 0x31, 0xde, 0xff, 0xff, 0xff, 0xff, 0xdf,
+  0x26, 0x13, 0x31, 0xd2, 0x11, 0x26, 0xc0, 0x29, 0x31, 0xc3, 0xff, 0xff,
+  0xff, 0xff, 0x96, 0x26, 0xc0, 0x32, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff,
+  0x10, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xd9, 0x0d, 0x26,
+  0x19, 0x31, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xa8, 0x31, 0xcf, 0x39, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x90,
+  0x31, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xe0, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf4,
+  0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x28, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x82, 0x31, 0xcf, 0x18, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xf8, 0xff, 0xff, 0xff, 0xff, 0x11, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x0c, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x26, 0xc3, 0xff, 0xff, 0xff, 0xff,
+  0xdb, 0x1e, 0x26, 0x25, 0x31, 0xce, 0xff, 0xff, 0xff, 0xff, 0x69, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x39, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff,
+  0x63, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x43, 0x31, 0xd0, 0xff, 0xff,
+  0xff, 0xff, 0xbc, 0x26, 0xc0, 0x35, 0x31, 0xc3, 0x1d, 0xff, 0xff, 0xff,
+  0xff, 0xca, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x2c, 0x31, 0xd1, 0xff,
+  0xff, 0xff, 0xff, 0x85, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x31,
+  0xc4, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x31,
+  0xd0, 0x11, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x31, 0xc3, 0x2b,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x31, 0xd2, 0xff, 0xff, 0xff,
+  0xff, 0x50, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x74, 0x31, 0xdb, 0xff,
+  0xff, 0xff, 0xff, 0xd0, 0x26, 0x19, 0x31, 0xda, 0x39, 0xff, 0xff, 0xff,
+  0xff, 0xee, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x39, 0x31, 0xc3, 0x35,
+  0x26, 0xc0, 0x39, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x20, 0x26, 0xc0,
+  0x29, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xfc, 0x31, 0xd6, 0x19, 0x26, 0x35, 0x31, 0xd5, 0xff, 0xff, 0xff,
+  0xff, 0x6c, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x31, 0xc4, 0xff, 0xff, 0xff,
+  0xff, 0x30, 0x26, 0xc0, 0x36, 0x31, 0xd2, 0x11, 0x26, 0xc0, 0x29, 0x31,
+  0xc3, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x06, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x54, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x10, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xb8, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x26,
+  0x19, 0x31, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xa8, 0x31, 0xcf, 0x39, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x90,
+  0x31, 0xc2, 0x16, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x26, 0x2d, 0x26, 0x2d,
+  0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x46, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xa2, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff,
+  0xff, 0xc4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
+  0x23, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0x74, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x09, 0xff, 0xff, 0xff,
+  0xff, 0x7c, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff,
+  0xe9, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0x17, 0xff,
+  0xff, 0xff, 0xff, 0xdc, 0x26, 0xff, 0xff, 0xff, 0xff, 0x1c, 0x31, 0xce,
+  0xff, 0xff, 0xff, 0xff, 0xb9, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff,
+  0xff, 0xff, 0xff, 0x05, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0x22, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x93, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff,
+  0xbc, 0x26, 0xc0, 0x35, 0x31, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0x14,
+  0xff, 0xff, 0xff, 0xff, 0x48, 0x10, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0xaa, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x07, 0x1d, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xb4, 0xff, 0xff, 0xff, 0xff, 0x41, 0x16, 0x14, 0xff,
+  0xff, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0xff, 0x89, 0xff, 0xff, 0xff,
+  0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xac, 0x31, 0xd0, 0x11, 0x26, 0xc0,
+  0x29, 0x31, 0xff, 0xff, 0xff, 0xff, 0x08, 0xff, 0xff, 0xff, 0xff, 0x1d,
+  0xff, 0xff, 0xff, 0xff, 0x53, 0x03, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0xd9, 0x2c, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x50, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x74, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xf8, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x50,
+  0x3a, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x68,
+  0x30, 0x3e, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0xff, 0x61,
+  0x34, 0x26, 0xc0, 0x39, 0x31, 0xcf, 0x11, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xa8, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xfc, 0x31, 0xd6, 0x19, 0x26, 0x35, 0x31, 0xd5, 0xff, 0xff,
+  0xff, 0xff, 0x84, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xff, 0xff, 0xff,
+  0xff, 0x60, 0xff, 0xff, 0xff, 0xff, 0x21, 0x3e, 0xff, 0xff, 0xff, 0xff,
+  0x0d, 0xff, 0xff, 0xff, 0xff, 0x48, 0x0f, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x4a, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x20, 0x26, 0xc0, 0x29,
+  0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x42, 0x1b, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xec, 0x39, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x10, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xd4,
+  0x26, 0x19, 0x31, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xa8, 0x31, 0xcf, 0x39, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x90, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x98, 0x26, 0xc1, 0xff, 0xff,
+  0xff, 0xff, 0xf4, 0x31, 0xd2, 0x03, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x97, 0x27, 0x3e, 0xff, 0xff, 0xff, 0xff, 0x2d, 0xff, 0xff, 0xff, 0xff,
+  0xb0, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x31, 0xd1, 0x02, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0x19, 0x31, 0xd9,
+  0xff, 0xff, 0xff, 0xff, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x26, 0x2f,
+  0x31, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xe2, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x26, 0xc8, 0x17, 0xff,
+  0xff, 0xff, 0xff, 0x0a, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xff,
+  0xff, 0xff, 0xff, 0xa9, 0x26, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xac, 0x31,
+  0xd0, 0x11, 0x26, 0xc7, 0x36, 0x2c, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff,
+  0x50, 0x26, 0xca, 0xff, 0xff, 0xff, 0xff, 0x10, 0x31, 0xd1, 0xff, 0xff,
+  0xff, 0xff, 0xd0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x31, 0xdc, 0xff,
+  0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x26, 0xc5, 0xff,
+  0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff,
+  0xff, 0x04, 0x31, 0xcf, 0x11, 0x26, 0xc0, 0x29, 0x31, 0xc5, 0xff, 0xff,
+  0xff, 0xff, 0xcc, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x31, 0xd1, 0xff,
+  0xff, 0xff, 0xff, 0x40, 0x26, 0xc9, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x84, 0x26, 0xc7,
+  0xff, 0xff, 0xff, 0xff, 0x91, 0x31, 0xd3, 0x11, 0x26, 0xc0, 0x29, 0x31,
+  0xc5, 0x39, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x31, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0x10, 0x26, 0xca, 0xff, 0xff, 0xff, 0xff, 0x94, 0x31,
+  0xcf, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb8,
+  0x31, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xa8, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x18, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x90, 0x31, 0xc3, 0x20, 0x26, 0xc1, 0x2d, 0x31, 0xd2, 0x16,
+  0xff, 0xff, 0xff, 0xff, 0xc6, 0x26, 0xc5, 0x29, 0xff, 0xff, 0xff, 0xff,
+  0x03, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff,
+  0xc4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x1f, 0x31, 0xd8, 0xff, 0xff,
+  0xff, 0xff, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x7b, 0x31, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x33, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x26,
+  0xc3, 0x10, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xd2,
+  0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0x43, 0x31, 0xd7,
+  0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0x99, 0xff, 0xff,
+  0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff,
+  0xf6, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xff,
+  0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff, 0xff, 0x14, 0x31, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0x20, 0x26, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x13,
+  0x33, 0x14, 0xff, 0xff, 0xff, 0xff, 0x30, 0x31, 0xd5, 0xff, 0xff, 0xff,
+  0xff, 0x50, 0x26, 0xca, 0xff, 0xff, 0xff, 0xff, 0x10, 0x31, 0xd1, 0xff,
+  0xff, 0xff, 0xff, 0xd0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x31, 0xdd,
+  0x0b, 0xff, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1e,
+  0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
+  0xff, 0xff, 0xcb, 0x14, 0x3d, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd1, 0x11,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x31, 0xc5, 0x35, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xfc, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x40, 0x26,
+  0xc9, 0x0d, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xff,
+  0x0b, 0xff, 0xff, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xff,
+  0xff, 0xff, 0xff, 0xca, 0x27, 0x19, 0x03, 0x06, 0xff, 0xff, 0xff, 0xff,
+  0xa9, 0x09, 0x31, 0xd4, 0x11, 0x26, 0xc0, 0x29, 0x31, 0xc5, 0xff, 0xff,
+  0xff, 0xff, 0x0d, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x67, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x10, 0x26, 0xca,
+  0xff, 0xff, 0xff, 0xff, 0x94, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xd4,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xc7, 0xff, 0xff, 0xff, 0xff,
+  0xe8, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x31, 0xcf, 0xff, 0xff, 0xff,
+  0xff, 0x18, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x90, 0x31, 0xc4, 0xff,
+  0xff, 0xff, 0xff, 0xc2, 0x26, 0xc0, 0x2d, 0x31, 0xd3, 0xff, 0xff, 0xff,
+  0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x64, 0xff, 0xff, 0xff, 0xff, 0xbe,
+  0xff, 0xff, 0xff, 0xff, 0xea, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff,
+  0xff, 0xff, 0xff, 0xb2, 0xff, 0xff, 0xff, 0xff, 0x50, 0x31, 0xd4, 0x30,
+  0xff, 0xff, 0xff, 0xff, 0xec, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xff,
+  0xff, 0xff, 0xff, 0x21, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xca, 0xff, 0xff, 0xff, 0xff, 0x2c, 0x27, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0x47,
+  0xff, 0xff, 0xff, 0xff, 0x1a, 0xff, 0xff, 0xff, 0xff, 0x07, 0x1c, 0xff,
+  0xff, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0xab, 0x31, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x18,
+  0xff, 0xff, 0xff, 0xff, 0xa1, 0x10, 0x26, 0xc4, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0x16, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xc5, 0xff, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff,
+  0xff, 0x79, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x11, 0xff, 0xff, 0xff, 0xff,
+  0xf5, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xff,
+  0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x19, 0x31, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe3, 0xff, 0xff,
+  0xff, 0xff, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff,
+  0xff, 0x20, 0x31, 0xf5, 0xff, 0xff, 0xff, 0xff, 0x44, 0x26, 0xc3, 0xff,
+  0xff, 0xff, 0xff, 0x88, 0x31, 0xfd, 0xd7, 0x21, 0x26, 0xc3, 0x1b, 0x17,
+  0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xff,
+  0xff, 0xff, 0x45, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff,
+  0xff, 0xff, 0x61, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xff, 0xff,
+  0xe8, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xff,
+  0xff, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0xff, 0x4f, 0x31, 0xd3, 0xff,
+  0xff, 0xff, 0xff, 0x0c, 0x26, 0xc3, 0x1b, 0x17, 0xff, 0xff, 0xff, 0xff,
+  0xd6, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0xff, 0xff, 0xff, 0x3d, 0x31,
+  0xd6, 0x00, 0xff, 0xff, 0xff, 0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xbe,
+  0x3f, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xcf,
+  0xff, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xff, 0xff, 0x5e, 0x39, 0x31,
+  0xd0, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x26, 0xcd, 0xff, 0xff, 0xff, 0xff,
+  0x38, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xc8, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xec, 0x26, 0x0d, 0x31,
+  0xcf, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x26,
+  0x33, 0x31, 0xc6, 0xff, 0xff, 0xff, 0xff, 0x01, 0x34, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xeb, 0x07, 0x31, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xed, 0x26,
+  0x1b, 0x31, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xc7, 0x31, 0xce, 0xff, 0xff, 0xff, 0xff, 0x84, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x6f, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff,
+  0xff, 0xff, 0xff, 0xf8, 0x26, 0x16, 0xff, 0xff, 0xff, 0xff, 0x04, 0x31,
+  0xcd, 0xff, 0xff, 0xff, 0xff, 0x36, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xbb, 0x31, 0xc6, 0xff, 0xff, 0xff, 0xff, 0x06,
+  0xff, 0xff, 0xff, 0xff, 0xdd, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff,
+  0xff, 0xff, 0xff, 0x1b, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x90, 0x26,
+  0xca, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff,
+  0xac, 0x26, 0xc3, 0x11, 0x31, 0xd2, 0x1c, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x3b, 0x31, 0xdd, 0xff, 0xff, 0xff, 0xff, 0x44, 0x26, 0xc3, 0xff,
+  0xff, 0xff, 0xff, 0x88, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x33, 0x19,
+  0x26, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x1c, 0x31, 0xf5, 0xff, 0xff, 0xff,
+  0xff, 0x50, 0x26, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff,
+  0xff, 0x08, 0x31, 0xd2, 0x35, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x26, 0xc5,
+  0xff, 0xff, 0xff, 0xff, 0xa5, 0x12, 0x31, 0xd1, 0x35, 0x26, 0xc8, 0xff,
+  0xff, 0xff, 0xff, 0xa1, 0xff, 0xff, 0xff, 0xff, 0x05, 0x31, 0xd3, 0xff,
+  0xff, 0xff, 0xff, 0x38, 0x27, 0x26, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xd8,
+  0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x26, 0xcd, 0x19, 0x31, 0xcf,
+  0x05, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x31, 0xc5, 0xff, 0xff, 0xff,
+  0xff, 0xec, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xd0, 0xff, 0xff,
+  0xff, 0xff, 0xc6, 0x26, 0x05, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x31, 0xc5,
+  0xff, 0xff, 0xff, 0xff, 0x30, 0x26, 0xc0, 0x1c, 0x31, 0xce, 0x33, 0x26,
+  0x30, 0x31, 0xc8, 0x28, 0x10, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x31,
+  0xce, 0xff, 0xff, 0xff, 0xff, 0x08, 0xff, 0xff, 0xff, 0xff, 0xda, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x17, 0x31, 0xc4,
+  0xff, 0xff, 0xff, 0xff, 0xb8, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
+  0xff, 0xff, 0xff, 0x32, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff,
+  0x75, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x77, 0x31, 0xd0, 0xff, 0xff,
+  0xff, 0xff, 0x90, 0x26, 0xca, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x31, 0xd4,
+  0xff, 0xff, 0xff, 0xff, 0xac, 0x26, 0x39, 0x31, 0xd6, 0x28, 0xff, 0xff,
+  0xff, 0xff, 0xe3, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x31, 0xe1, 0x05,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0x88, 0x31, 0xd8, 0xff, 0xff, 0xff, 0xff,
+  0x13, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff,
+  0xc8, 0xff, 0xff, 0xff, 0xff, 0x06, 0x31, 0xf4, 0xff, 0xff, 0xff, 0xff,
+  0x50, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x74, 0x31, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff,
+  0x57, 0xff, 0xff, 0xff, 0xff, 0xde, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0xa2, 0x31, 0xd2, 0x36, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x99, 0x3d,
+  0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0x2e, 0xff, 0xff,
+  0xff, 0xff, 0xb2, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x31, 0xd1,
+  0xff, 0xff, 0xff, 0xff, 0x0c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xbc,
+  0x31, 0xc0, 0x3c, 0x0d, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0xff, 0xff,
+  0xff, 0xdc, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x95, 0x31, 0xd2, 0xff,
+  0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x26, 0x01, 0xff,
+  0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff,
+  0xff, 0x0a, 0x02, 0xff, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0xff,
+  0x9c, 0x24, 0x39, 0x31, 0xd7, 0x01, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4,
+  0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x26, 0x09, 0x31, 0xc5, 0xff,
+  0xff, 0xff, 0xff, 0xec, 0x26, 0x0d, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff,
+  0x79, 0x26, 0xc0, 0x21, 0x31, 0xc5, 0x38, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x54, 0x31, 0xce, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x26, 0x2f, 0x07,
+  0x31, 0xc7, 0xff, 0xff, 0xff, 0xff, 0x21, 0x26, 0xc0, 0x24, 0x31, 0xcf,
+  0x12, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x31, 0xc3, 0xff, 0xff,
+  0xff, 0xff, 0x53, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x88, 0x31, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0xff, 0xef, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x04, 0x31, 0xc3, 0xff,
+  0xff, 0xff, 0xff, 0x14, 0x01, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x33,
+  0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xcc,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x69, 0x31, 0xd4, 0xff, 0xff, 0xff,
+  0xff, 0xac, 0x26, 0x39, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x71, 0x26,
+  0x1b, 0xff, 0xff, 0xff, 0xff, 0x2b, 0x31, 0xe0, 0x05, 0x26, 0x09, 0x31,
+  0xd7, 0x07, 0x19, 0x26, 0x3a, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x96, 0x31, 0xf4, 0x21, 0x26, 0xc0, 0x2d, 0x31,
+  0xc3, 0xff, 0xff, 0xff, 0xff, 0x19, 0xff, 0xff, 0xff, 0xff, 0xea, 0x26,
+  0x1b, 0xff, 0xff, 0xff, 0xff, 0x28, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff,
+  0x40, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0xc2, 0x07, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x26, 0x2f, 0x1c, 0x31,
+  0xd0, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0xbc, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0xff,
+  0xec, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1c, 0x31, 0xd1, 0x08, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x2c, 0x31, 0xc4,
+  0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0x99, 0x31, 0xd7,
+  0x01, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xd6, 0x05, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xc8, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xec, 0x26,
+  0x0d, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x2d, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x95, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x26, 0x2f,
+  0x0b, 0x31, 0xce, 0xff, 0xff, 0xff, 0xff, 0x78, 0x26, 0xc0, 0x1a, 0x31,
+  0xc7, 0xff, 0xff, 0xff, 0xff, 0x40, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x52, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xa2,
+  0x26, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x39, 0x31, 0xc1, 0xff, 0xff, 0xff,
+  0xff, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xd9, 0xff, 0xff, 0xff, 0xff, 0x08, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff,
+  0x6e, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x31, 0xc3, 0x18, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x47, 0x31, 0xda, 0xff, 0xff, 0xff, 0xff,
+  0x76, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x3c, 0x31, 0xd4, 0xff,
+  0xff, 0xff, 0xff, 0xac, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x31, 0xd7,
+  0x2a, 0xff, 0xff, 0xff, 0xff, 0xed, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa2,
+  0x31, 0xe0, 0x05, 0x26, 0xff, 0xff, 0xff, 0xff, 0x88, 0x31, 0xd7, 0xff,
+  0xff, 0xff, 0xff, 0x83, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x63, 0x31,
+  0xff, 0xff, 0xff, 0xff, 0x8b, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x5d,
+  0x31, 0xf3, 0x21, 0x26, 0xc0, 0x2d, 0x31, 0xc4, 0x12, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x6f, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff,
+  0x4f, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0xd0, 0x35, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x31, 0xc4,
+  0xff, 0xff, 0xff, 0xff, 0x8c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x6a,
+  0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xab, 0x31, 0xe0, 0x01, 0x26, 0x0d, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff,
+  0xfc, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x31, 0xc5, 0xff, 0xff, 0xff,
+  0xff, 0xec, 0x26, 0x0d, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x26,
+  0x0f, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x08, 0xff, 0xff, 0xff, 0xff,
+  0xf7, 0x26, 0x3a, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x51, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x3a, 0x31, 0xc7, 0xff, 0xff, 0xff, 0xff, 0x5e,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x2b, 0x31, 0xd0, 0xff, 0xff, 0xff,
+  0xff, 0x14, 0x15, 0x26, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x07, 0x31, 0xc0,
+  0x14, 0x26, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x3d, 0x31, 0xd2, 0xff, 0xff,
+  0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0x10, 0x31, 0xc1, 0x29, 0xff, 0xff,
+  0xff, 0xff, 0xfb, 0x26, 0xff, 0xff, 0xff, 0xff, 0xae, 0x31, 0xda, 0xff,
+  0xff, 0xff, 0xff, 0x26, 0x0e, 0x26, 0x17, 0xff, 0xff, 0xff, 0xff, 0x1f,
+  0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xac, 0x26, 0x39, 0x31, 0xd8, 0xff,
+  0xff, 0xff, 0xff, 0x81, 0x26, 0x3a, 0xff, 0xff, 0xff, 0xff, 0x1e, 0x31,
+  0xdf, 0x05, 0x26, 0xff, 0xff, 0xff, 0xff, 0x88, 0x31, 0xd6, 0xff, 0xff,
+  0xff, 0xff, 0x4b, 0x1b, 0x26, 0x3c, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf6,
+  0xff, 0xff, 0xff, 0xff, 0x2f, 0x31, 0xf2, 0xff, 0xff, 0xff, 0xff, 0x50,
+  0x26, 0xc0, 0x2d, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x52, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x8d, 0x31, 0xcf, 0x3c, 0xff, 0xff, 0xff, 0xff,
+  0xef, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x31, 0xc4, 0x1f, 0x05, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xcb, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x0c,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x31, 0xc4, 0xff, 0xff, 0xff,
+  0xff, 0x5e, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x31, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0x11, 0x26, 0xc0, 0x23, 0x31, 0xe0, 0x01, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xd4, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xc8, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xec,
+  0x26, 0x0d, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x94, 0x26, 0xc0, 0x06,
+  0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x45, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x6f, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x58, 0x31, 0xc7, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x07, 0x31, 0xd1,
+  0xff, 0xff, 0xff, 0xff, 0x60, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x68,
+  0x31, 0xff, 0xff, 0xff, 0xff, 0x29, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x26,
+  0x18, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x31, 0xc1, 0xff, 0xff, 0xff,
+  0xff, 0xb5, 0x26, 0x03, 0x06, 0x31, 0xd9, 0x3c, 0xff, 0xff, 0xff, 0xff,
+  0xc2, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x66, 0x31, 0xd6, 0xff, 0xff,
+  0xff, 0xff, 0xac, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x31, 0xd8, 0xff,
+  0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0x91, 0x31, 0xdf, 0x05, 0x26, 0xff, 0xff, 0xff, 0xff, 0x88,
+  0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xef,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff,
+  0x06, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0x10, 0x31, 0xf1, 0xff,
+  0xff, 0xff, 0xff, 0x50, 0x26, 0xc0, 0x2d, 0x31, 0xc4, 0x37, 0x26, 0xc0,
+  0x00, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x20, 0x26, 0xc0, 0x22, 0x31,
+  0xc5, 0x2e, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
+  0x02, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0xbc, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x90, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x08,
+  0x1b, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x31, 0xe0, 0x01, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xd4, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x26,
+  0x09, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xec, 0x26, 0x0d, 0x31, 0xd1,
+  0xff, 0xff, 0xff, 0xff, 0x48, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x64,
+  0x31, 0xc3, 0x2a, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x23, 0x31, 0xcf,
+  0x33, 0x05, 0x26, 0xff, 0xff, 0xff, 0xff, 0x77, 0x31, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x25, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x12, 0x31,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x26, 0xff, 0xff, 0xff, 0xff, 0xdd,
+  0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x26, 0x20, 0x02, 0xff, 0xff,
+  0xff, 0xff, 0xbd, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xff, 0xff, 0xff,
+  0xff, 0x0d, 0x31, 0xd5, 0x1e, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff,
+  0xff, 0xff, 0xff, 0x22, 0x31, 0xff, 0xff, 0xff, 0xff, 0x44, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x7d, 0x31, 0xda, 0xff, 0xff, 0xff, 0xff, 0x6b,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xba, 0x31, 0xd7, 0xff, 0xff, 0xff,
+  0xff, 0xac, 0x26, 0x39, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x92, 0x26,
+  0x38, 0x02, 0x31, 0xde, 0x05, 0x26, 0xff, 0xff, 0xff, 0xff, 0x88, 0x31,
+  0xd4, 0xff, 0xff, 0xff, 0xff, 0x09, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xb9, 0xff, 0xff, 0xff, 0xff, 0x04, 0x31, 0xc3,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xb2, 0x3c, 0x31, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x50,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x74, 0x31, 0xc4, 0xff, 0xff, 0xff,
+  0xff, 0x84, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x31, 0xcf, 0x28,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x97, 0x31, 0xc5, 0xff, 0xff, 0xff,
+  0xff, 0xbd, 0x26, 0xc0, 0x11, 0x31, 0xcf, 0x35, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0xbc, 0x31, 0xc4, 0x1d, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x6d, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xcb, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x7c, 0xff, 0xff, 0xff, 0xff, 0x04, 0x31, 0xde, 0x01, 0x26,
+  0x0d, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xc8, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xec, 0x26, 0x0d, 0x31,
+  0xd1, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xa9, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xd6, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0x96, 0x31, 0xc0, 0x3b, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff,
+  0x32, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xb6, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x26, 0x19, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xd2, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x49, 0x31,
+  0xd6, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xac, 0x07, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x26, 0x30, 0xff, 0xff, 0xff,
+  0xff, 0x08, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x22, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x1d, 0x31, 0xd7, 0x15,
+  0x26, 0x39, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xff, 0xff, 0xff,
+  0xff, 0xfb, 0x26, 0xff, 0xff, 0xff, 0xff, 0x81, 0x31, 0xde, 0x05, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0x88, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xa0,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x00, 0x31, 0xc5, 0x30, 0xff, 0xff,
+  0xff, 0xff, 0xe4, 0x26, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x31, 0xf0, 0xff,
+  0xff, 0xff, 0xff, 0x50, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x74, 0x31,
+  0xc3, 0xff, 0xff, 0xff, 0xff, 0x19, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x29, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff,
+  0x57, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x86, 0x31, 0xc5, 0xff, 0xff,
+  0xff, 0xff, 0xab, 0x26, 0xc0, 0x17, 0x31, 0xcf, 0x35, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xbc, 0x31, 0xc3, 0x00, 0xff, 0xff, 0xff, 0xff, 0xe2,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0x1c, 0x31,
+  0xd1, 0x14, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xe6, 0x18, 0xff, 0xff, 0xff, 0xff, 0x58, 0xff, 0xff, 0xff, 0xff,
+  0x22, 0x31, 0xdb, 0x01, 0x26, 0x0d, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff,
+  0xfc, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x31, 0xc5, 0xff, 0xff, 0xff,
+  0xff, 0xec, 0x26, 0x0d, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x26,
+  0x15, 0x07, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x16, 0x1b, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x8a, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x26,
+  0x38, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x97, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xf2, 0x26, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x31, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0xd9, 0x26, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x31, 0xd4, 0xff,
+  0xff, 0xff, 0xff, 0x7e, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x31,
+  0xd8, 0xff, 0xff, 0xff, 0xff, 0x78, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x9d, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x31, 0xda, 0xff, 0xff,
+  0xff, 0xff, 0xb8, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x63, 0x31, 0xd8,
+  0xff, 0xff, 0xff, 0xff, 0xac, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x31,
+  0xda, 0x27, 0x26, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xff, 0xff, 0xff,
+  0x0b, 0x31, 0xdd, 0x05, 0x26, 0xff, 0xff, 0xff, 0xff, 0x88, 0x31, 0xfd,
+  0xd7, 0x21, 0x26, 0xc0, 0x2d, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x01,
+  0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0x56, 0xff, 0xff,
+  0xff, 0xff, 0xde, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x31, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0x62, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x7f,
+  0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x3d, 0x31, 0xcf, 0x35, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xbc, 0x31, 0xc1, 0x0b, 0xff, 0xff, 0xff, 0xff, 0x47,
+  0xff, 0xff, 0xff, 0xff, 0xcc, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x71,
+  0x31, 0xd3, 0x23, 0xff, 0xff, 0xff, 0xff, 0xec, 0x26, 0xc3, 0xff, 0xff,
+  0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff,
+  0x19, 0x31, 0xd8, 0x01, 0x26, 0x0d, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff,
+  0xfc, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x31, 0xc5, 0x15, 0x26, 0x0d,
+  0x31, 0xd2, 0x32, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x33, 0x31, 0xc1,
+  0xff, 0xff, 0xff, 0xff, 0x5b, 0x26, 0xc0, 0x10, 0x31, 0xd1, 0xff, 0xff,
+  0xff, 0xff, 0x8e, 0x26, 0x0d, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xd0,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0x88, 0x26, 0x08, 0x31, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0xf7, 0x26, 0x29, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x18,
+  0xff, 0xff, 0xff, 0xff, 0xfd, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x35,
+  0x31, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x06, 0x0f, 0x26, 0xc1, 0xff, 0xff,
+  0xff, 0xff, 0xb5, 0x31, 0xda, 0xff, 0xff, 0xff, 0xff, 0x60, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xb7, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xac,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x31, 0xda, 0xff, 0xff, 0xff, 0xff,
+  0x2b, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x26, 0xff, 0xff, 0xff, 0xff, 0x70,
+  0x31, 0xdd, 0x05, 0x26, 0x09, 0x31, 0xfd, 0xd7, 0xff, 0xff, 0xff, 0xff,
+  0x50, 0x26, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xff, 0xff, 0xff, 0xff,
+  0x0a, 0x31, 0xd0, 0x32, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x31,
+  0xc5, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x3f, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xc7, 0x37, 0xff, 0xff, 0xff, 0xff, 0x55, 0x31, 0xd5, 0xff, 0xff,
+  0xff, 0xff, 0x0e, 0xff, 0xff, 0xff, 0xff, 0x69, 0xff, 0xff, 0xff, 0xff,
+  0xba, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x26, 0xc2, 0xff, 0xff, 0xff, 0xff,
+  0xf3, 0x23, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x26, 0x0d, 0x31,
+  0xd6, 0x05, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x31, 0xc5, 0xff, 0xff,
+  0xff, 0xff, 0xec, 0x26, 0x0d, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x18,
+  0x1b, 0x26, 0xff, 0xff, 0xff, 0xff, 0x78, 0x31, 0xc1, 0xff, 0xff, 0xff,
+  0xff, 0xa0, 0x26, 0x20, 0x12, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x67,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x31, 0x35, 0x05, 0xff, 0xff, 0xff,
+  0xff, 0xef, 0x25, 0x26, 0x06, 0x31, 0xff, 0xff, 0xff, 0xff, 0x17, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x41, 0x31, 0xd4, 0x11, 0x26, 0xc1, 0xff,
+  0xff, 0xff, 0xff, 0xb8, 0x31, 0xd9, 0x14, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x24, 0x31, 0xd9, 0x39, 0xff, 0xff,
+  0xff, 0xff, 0xee, 0x26, 0x01, 0x25, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff,
+  0xac, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x31, 0xdb, 0xff, 0xff, 0xff,
+  0xff, 0xb2, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xff, 0xff, 0xff, 0xff,
+  0x05, 0x31, 0xdc, 0x05, 0x26, 0xff, 0xff, 0xff, 0xff, 0x88, 0x31, 0xfd,
+  0xd7, 0x21, 0x26, 0xc4, 0x22, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xff,
+  0xff, 0xff, 0xff, 0x48, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x57, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x86, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff,
+  0xab, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x37, 0x31, 0xcf, 0x35, 0x26,
+  0xc6, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x34, 0xff, 0xff, 0xff, 0xff, 0x01,
+  0x31, 0xd8, 0x1d, 0xff, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xff,
+  0x6d, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x26, 0xc0, 0x3a, 0xff, 0xff, 0xff,
+  0xff, 0x38, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x26, 0x0d, 0x31,
+  0xd6, 0x05, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x31, 0xc5, 0xff, 0xff,
+  0xff, 0xff, 0xec, 0x26, 0x0d, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xca,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x31, 0xc1, 0x3d, 0x26, 0x08, 0x31,
+  0xd2, 0xff, 0xff, 0xff, 0xff, 0x40, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x11, 0xff, 0xff, 0xff, 0xff, 0x42, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb4,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x26, 0x04,
+  0xff, 0xff, 0xff, 0xff, 0x36, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x1a,
+  0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x45, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xc6, 0x26, 0xc0, 0x2e, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xf8,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x31, 0xda, 0xff, 0xff, 0xff, 0xff,
+  0xae, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x60, 0x31, 0xda, 0xff, 0xff,
+  0xff, 0xff, 0xac, 0x26, 0x39, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x3a,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x31, 0xdc, 0x05, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x88, 0x31, 0xfd, 0xd7, 0x21, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x74, 0x31, 0xd9, 0x28, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x97, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x22, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xbc, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x06,
+  0x3f, 0xff, 0xff, 0xff, 0xff, 0x9b, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x94, 0x31, 0xdc, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0xb1, 0x31, 0xd6, 0x01, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4,
+  0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xc8, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xec, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xd1, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x26, 0x19, 0xff,
+  0xff, 0xff, 0xff, 0x0a, 0x31, 0x3f, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x58, 0x31, 0xd2, 0x04, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x30, 0xff,
+  0xff, 0xff, 0xff, 0x7b, 0x26, 0xff, 0xff, 0xff, 0xff, 0x76, 0x31, 0xff,
+  0xff, 0xff, 0xff, 0x9e, 0x26, 0xff, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff,
+  0xff, 0xff, 0x54, 0x26, 0x22, 0x31, 0xd3, 0x2a, 0xff, 0xff, 0xff, 0xff,
+  0xdf, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x35, 0xff, 0xff, 0xff, 0xff,
+  0xbb, 0x26, 0x13, 0x0b, 0x31, 0xd8, 0x19, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xcc, 0x31, 0xd9, 0x18, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x31,
+  0xdb, 0xff, 0xff, 0xff, 0xff, 0xac, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd8,
+  0x31, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xd5, 0x3c, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0x88, 0x31, 0xfd, 0xd7, 0x21, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x74, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x20, 0x26, 0xc0, 0x17,
+  0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xfb, 0xff, 0xff, 0xff, 0xff, 0x07, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff,
+  0x0c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x31, 0xc3, 0xff, 0xff,
+  0xff, 0xff, 0x98, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x31, 0xdc,
+  0x18, 0x26, 0xff, 0xff, 0xff, 0xff, 0xee, 0x31, 0xd6, 0xff, 0xff, 0xff,
+  0xff, 0xf0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xd6, 0x38, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xc8, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xec,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff,
+  0x31, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x48, 0x31, 0xff, 0xff, 0xff,
+  0xff, 0x70, 0x26, 0x3a, 0xff, 0xff, 0xff, 0xff, 0x10, 0x31, 0xd3, 0xff,
+  0xff, 0xff, 0xff, 0xf1, 0x26, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff,
+  0xff, 0xff, 0xb4, 0x26, 0xff, 0xff, 0xff, 0xff, 0x39, 0x31, 0xff, 0xff,
+  0xff, 0xff, 0x60, 0x26, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff,
+  0xff, 0x73, 0x26, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x31, 0xd3, 0xff, 0xff,
+  0xff, 0xff, 0x8f, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x4e, 0x31, 0xff,
+  0xff, 0xff, 0xff, 0x2b, 0x3a, 0x26, 0xff, 0xff, 0xff, 0xff, 0x93, 0x31,
+  0xd8, 0x19, 0x26, 0x35, 0x31, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff,
+  0xff, 0xff, 0xff, 0xe9, 0x26, 0x2b, 0x0f, 0x31, 0xdb, 0xff, 0xff, 0xff,
+  0xff, 0xac, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x31, 0xdc, 0xff, 0xff,
+  0xff, 0xff, 0x4b, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x4f, 0x31, 0xdb,
+  0xff, 0xff, 0xff, 0xff, 0xfc, 0x26, 0xff, 0xff, 0xff, 0xff, 0x88, 0x31,
+  0xfd, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x50, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x74, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff,
+  0xff, 0xef, 0x26, 0x1c, 0x31, 0xc4, 0x1f, 0x05, 0x26, 0x2c, 0x31, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0x0c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xbc,
+  0x31, 0xc3, 0x35, 0x13, 0x26, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x33, 0x31,
+  0xdb, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfd,
+  0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x26, 0x0d, 0x31, 0xd6, 0xff,
+  0xff, 0xff, 0xff, 0xe5, 0x26, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x31, 0xc5,
+  0xff, 0xff, 0xff, 0xff, 0xf2, 0x26, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x31,
+  0xd4, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x26, 0xff, 0xff, 0xff, 0xff, 0x8d,
+  0x31, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x26, 0xff, 0xff, 0xff, 0xff, 0xbf,
+  0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff,
+  0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0x05, 0x31, 0xff, 0xff, 0xff,
+  0xff, 0x22, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xff, 0xff, 0xff, 0xff,
+  0x92, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x31, 0xd2, 0x0e, 0xff, 0xff,
+  0xff, 0xff, 0xfd, 0x26, 0xff, 0xff, 0xff, 0xff, 0xad, 0x31, 0xc1, 0x37,
+  0x26, 0x10, 0xff, 0xff, 0xff, 0xff, 0x34, 0x31, 0xd7, 0x19, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xcc, 0x31, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x5d, 0x31, 0xdc, 0xff, 0xff, 0xff, 0xff,
+  0xac, 0x26, 0x39, 0x31, 0xdd, 0x2c, 0x26, 0x33, 0x31, 0xdb, 0xff, 0xff,
+  0xff, 0xff, 0xfc, 0x26, 0x09, 0x31, 0xfd, 0xd7, 0x21, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x74, 0x31, 0xda, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x28, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff,
+  0x4d, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x31, 0xd0, 0xff, 0xff,
+  0xff, 0xff, 0x0c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x31, 0xc4,
+  0xff, 0xff, 0xff, 0xff, 0x67, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x70,
+  0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x26, 0x34, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x26, 0x0d, 0x31, 0xd6,
+  0xff, 0xff, 0xff, 0xff, 0xc8, 0x26, 0x1c, 0x31, 0xc4, 0xff, 0xff, 0xff,
+  0xff, 0x09, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x31, 0xd4, 0xff,
+  0xff, 0xff, 0xff, 0x98, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xff, 0xff,
+  0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x26, 0x22, 0x31, 0xd4,
+  0xff, 0xff, 0xff, 0xff, 0xa4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xbd, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xe3,
+  0x19, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x26, 0xff, 0xff, 0xff, 0xff, 0x7e,
+  0x31, 0xd1, 0x28, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x26, 0x17, 0xff, 0xff,
+  0xff, 0xff, 0x1b, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff,
+  0xff, 0xff, 0xeb, 0x26, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff,
+  0xff, 0x03, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x26, 0x35, 0x31,
+  0xd7, 0xff, 0xff, 0xff, 0xff, 0x4a, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0xb1, 0x31, 0xdd, 0x15, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x31, 0xdd,
+  0xff, 0xff, 0xff, 0xff, 0x5b, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x3e,
+  0x31, 0xda, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0x88, 0x31, 0xfd, 0xd7, 0x21, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x74,
+  0x31, 0xda, 0xff, 0xff, 0xff, 0xff, 0x42, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xa2, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff,
+  0xff, 0xc4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff,
+  0x2a, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0xbc, 0x31, 0xc4, 0x28, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x26,
+  0x0a, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x31, 0xd0, 0x27, 0xff, 0xff, 0xff,
+  0xff, 0x38, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x10, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xa9, 0x31, 0xd6, 0x01, 0x26, 0x0d, 0x31, 0xd6, 0x09,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x31, 0xc3, 0xff, 0xff, 0xff,
+  0xff, 0x64, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x5f, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x58, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x27, 0x31, 0xd4,
+  0xff, 0xff, 0xff, 0xff, 0x7d, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0x7f, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xa6,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x26, 0xff, 0xff, 0xff, 0xff, 0x57,
+  0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x6c, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x69, 0x26, 0xc0, 0x2b,
+  0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xcc, 0x31, 0xd6, 0x0b, 0x32, 0x26, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff,
+  0xff, 0xff, 0xff, 0x18, 0x31, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xac, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xd8, 0x31, 0xdd, 0x12, 0xff, 0xff, 0xff, 0xff,
+  0xde, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x31, 0xda, 0xff, 0xff, 0xff,
+  0xff, 0xfc, 0x26, 0x09, 0x31, 0xfd, 0xd7, 0x21, 0x26, 0xc0, 0x2d, 0x31,
+  0xdb, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x97, 0xff, 0xff, 0xff, 0xff, 0x22, 0x3e, 0xff, 0xff, 0xff, 0xff, 0x2d,
+  0xff, 0xff, 0xff, 0xff, 0xb0, 0x26, 0xc0, 0x2e, 0x31, 0xd1, 0xff, 0xff,
+  0xff, 0xff, 0x0c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x31, 0xc5,
+  0xff, 0xff, 0xff, 0xff, 0x63, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x83,
+  0x31, 0xd0, 0x39, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x32, 0xff, 0xff,
+  0xff, 0xff, 0x25, 0x14, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff,
+  0xff, 0x2f, 0xff, 0xff, 0xff, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xf4,
+  0x26, 0x24, 0xff, 0xff, 0xff, 0xff, 0x2e, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0xd6, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x26, 0x0d, 0x31, 0xd6, 0x0f, 0x01,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xff, 0xff, 0xff, 0x65, 0xff,
+  0xff, 0xff, 0xff, 0x18, 0x28, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff,
+  0xff, 0xff, 0x79, 0x19, 0x26, 0x25, 0x3e, 0x31, 0xd4, 0x14, 0xff, 0xff,
+  0xff, 0xff, 0xf6, 0x26, 0x25, 0x26, 0xff, 0xff, 0xff, 0xff, 0xda, 0x31,
+  0xd5, 0x23, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x42, 0x31, 0xc1, 0xff,
+  0xff, 0xff, 0xff, 0x68, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x30, 0x31,
+  0xd0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xca, 0xff, 0xff, 0xff, 0xff, 0x02, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff,
+  0x03, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf1,
+  0xff, 0xff, 0xff, 0xff, 0x1a, 0x31, 0xd5, 0x19, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xcc, 0x31, 0xd6, 0x2e, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x59,
+  0x31, 0xde, 0x15, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x31, 0xde, 0xff,
+  0xff, 0xff, 0xff, 0x6b, 0x26, 0xc0, 0x2b, 0x31, 0xd9, 0xff, 0xff, 0xff,
+  0xff, 0xfc, 0x26, 0x09, 0x31, 0xfd, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x50,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x74, 0x31, 0xdb, 0xff, 0xff, 0xff,
+  0xff, 0x0d, 0x1d, 0x26, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xff, 0xff,
+  0xff, 0xff, 0x08, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xbc, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0x04,
+  0xff, 0xff, 0xff, 0xff, 0xdb, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff,
+  0xff, 0xff, 0xff, 0x18, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x26,
+  0xc7, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x31,
+  0xd7, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x26, 0x0d, 0x31, 0xd7, 0xff, 0xff,
+  0xff, 0xff, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x26, 0xc5, 0xff, 0xff,
+  0xff, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0x26, 0x31, 0xd6, 0x22, 0x26,
+  0xc1, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x31, 0xd5, 0x36, 0x26, 0xc0, 0x2f,
+  0xff, 0xff, 0xff, 0xff, 0x0a, 0x31, 0xc1, 0x3f, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x31, 0xcf, 0x07, 0xff,
+  0xff, 0xff, 0xff, 0xc6, 0x26, 0x3a, 0xff, 0xff, 0xff, 0xff, 0x30, 0x31,
+  0xc5, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xaa, 0x31, 0xd5, 0x19, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xcc, 0x31, 0xd6, 0x25, 0x26, 0xca, 0xff, 0xff, 0xff, 0xff, 0xfc,
+  0x31, 0xd4, 0x15, 0x26, 0x39, 0x31, 0xde, 0x14, 0xff, 0xff, 0xff, 0xff,
+  0xea, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x31, 0xd9, 0x05, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x88, 0x31, 0xfd, 0xd7, 0x21, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x74, 0x31, 0xdc, 0x07, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xbf,
+  0xff, 0xff, 0xff, 0xff, 0xeb, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+  0x33, 0x3c, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xbc, 0x31, 0xc6, 0x30, 0x26, 0xc0, 0x2e, 0x31, 0xcf,
+  0xff, 0xff, 0xff, 0xff, 0x17, 0x04, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff,
+  0xff, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x38, 0x24, 0xff,
+  0xff, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xff,
+  0xff, 0x76, 0xff, 0xff, 0xff, 0xff, 0x14, 0x31, 0xd8, 0xff, 0xff, 0xff,
+  0xff, 0xf0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xd8, 0xff, 0xff,
+  0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0xff,
+  0xc8, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
+  0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff,
+  0xff, 0x6c, 0x1f, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x66, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x42, 0x31, 0xd5, 0xff,
+  0xff, 0xff, 0xff, 0x09, 0x1b, 0x26, 0x33, 0x31, 0xc3, 0x3f, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xe3, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x31, 0xc7, 0xff, 0xff, 0xff, 0xff,
+  0xaa, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x48, 0x31, 0xd4, 0x19, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xcc, 0x31, 0xd6, 0x25, 0x26, 0xca, 0xff, 0xff,
+  0xff, 0xff, 0xfc, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xac, 0x26, 0x39,
+  0x31, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xfc, 0xff, 0xff, 0xff, 0xff, 0x21, 0x31, 0xd8, 0x05, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0x88, 0x31, 0xfd, 0xfd, 0xc0, 0x08, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xc1, 0x15, 0x26, 0x39, 0x31, 0xdf, 0x2c, 0xff, 0xff, 0xff, 0xff,
+  0xf2, 0x26, 0xff, 0xff, 0xff, 0xff, 0x94, 0x31, 0xd8, 0x05, 0x26, 0x09,
+  0x31, 0xfd, 0xfd, 0xc0, 0x14, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x6e, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc0,
+  0x15, 0x26, 0x39, 0x31, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x15, 0x31, 0xd7, 0x05,
+  0x26, 0x09, 0x31, 0xfd, 0xfd, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff,
+  0xff, 0xff, 0xff, 0xec, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x2a, 0x31,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xac, 0x26, 0xc3,
+  0x11, 0x31, 0xdc, 0xff, 0xff, 0xff, 0xff, 0x1a, 0x24, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0x84, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x44, 0x26, 0xc3,
+  0x09, 0x31, 0xfd, 0xfd, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x43, 0x22, 0xff,
+  0xff, 0xff, 0xff, 0x10, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc0, 0x15,
+  0x26, 0xc3, 0x11, 0x31, 0xf5, 0x1d, 0x26, 0xc3, 0x09, 0x31, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xd5, 0x26, 0xce, 0x25, 0x31, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfb, 0x26, 0xce, 0x25, 0x31, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc2, 0x28, 0xff,
+  0xff, 0xff, 0xff, 0xb9, 0x26, 0x39, 0x00, 0x31, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0x00, 0xff, 0xff, 0xff, 0xff, 0xce, 0x26,
+  0x3f, 0x31, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x28, 0x31, 0xfd, 0xc5, 0x1d, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xf7, 0x07, 0xff, 0xff, 0xff,
+  0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xfd,
+  0x26, 0xc0, 0x09, 0x31, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x54, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x30, 0x31, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x94,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x31, 0xdc, 0xff, 0xff, 0xff, 0xff,
+  0xcc, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xd6, 0xff, 0xff, 0xff,
+  0xff, 0xc4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xda, 0xff, 0xff,
+  0xff, 0xff, 0xd0, 0x26, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x31, 0xfd,
+  0xfc, 0xff, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0x6f, 0x31, 0xf7, 0x25, 0x26, 0xc0, 0x29, 0x31,
+  0xfd, 0xc5, 0xff, 0xff, 0xff, 0xff, 0x44, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff,
+  0x52, 0x10, 0x26, 0xc3, 0x09, 0x31, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x54,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x30, 0x31, 0xdf, 0xff, 0xff, 0xff,
+  0xff, 0x94, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x31, 0xdc, 0x35, 0x26,
+  0x19, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xd4, 0x31, 0xda, 0x21, 0x26, 0xc3, 0x05, 0x31, 0xfd, 0xfd, 0x29,
+  0xff, 0xff, 0xff, 0xff, 0xed, 0x2f, 0xff, 0xff, 0xff, 0xff, 0x39, 0x31,
+  0xf6, 0x25, 0x26, 0xc0, 0x29, 0x31, 0xfd, 0xc5, 0xff, 0xff, 0xff, 0xff,
+  0x44, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x26, 0x04, 0xff, 0xff, 0xff,
+  0xff, 0x35, 0x3e, 0x31, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x54, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x30, 0x31, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x94,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x31, 0xdc, 0x35, 0x26, 0x19, 0x31,
+  0xd6, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4,
+  0x31, 0xde, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x26, 0x05, 0x31, 0xfd, 0xfd,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x32,
+  0x18, 0x31, 0xf5, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x26, 0xc0, 0x29, 0x31,
+  0xfd, 0xc5, 0xff, 0xff, 0xff, 0xff, 0x44, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xf5, 0x11, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x67, 0x31, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x54, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x30, 0x31, 0xfd, 0xdd, 0xff, 0xff, 0xff,
+  0xff, 0xc4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xde, 0x09, 0x26,
+  0x05, 0x31, 0xfd, 0xfd, 0xfb, 0x25, 0x26, 0xc0, 0x29, 0x31, 0xfd, 0xc5,
+  0xff, 0xff, 0xff, 0xff, 0x44, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x40,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xf5, 0x2f, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x48, 0x31, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x54, 0x26, 0xc0, 0x01,
+  0x31, 0xfd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xd4, 0x31, 0xde, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x26, 0x05, 0x31,
+  0xfd, 0xfd, 0xfb, 0x25, 0x26, 0xc0, 0x29, 0x31, 0xfd, 0xc5, 0xff, 0xff,
+  0xff, 0xff, 0x44, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0xf5, 0xff, 0xff, 0xff, 0xff, 0x40, 0x26, 0xc0, 0x1d,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x54, 0x26,
+  0xc0, 0x01, 0x31, 0xfd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xd4, 0x31, 0xde, 0x09, 0x26, 0x05, 0x31, 0xfd, 0xfd,
+  0xdc, 0x29, 0xff, 0xff, 0xff, 0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xb4,
+  0xff, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+  0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xff, 0xff,
+  0xb8, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x14, 0x31, 0xd3, 0x25, 0x26, 0xc0,
+  0x29, 0xff, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xff,
+  0xff, 0xff, 0xff, 0xea, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
+  0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0x91, 0x39, 0x31, 0xd7, 0x2f, 0xff,
+  0xff, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x0c, 0xff, 0xff,
+  0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xff,
+  0x69, 0xff, 0xff, 0xff, 0xff, 0x04, 0x31, 0xd4, 0x11, 0xff, 0xff, 0xff,
+  0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xf9,
+  0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xa6, 0xff, 0xff,
+  0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0xff, 0x44, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd4, 0xff, 0xff, 0xff,
+  0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x3b, 0x03, 0x0c, 0xff, 0xff,
+  0xff, 0xff, 0xca, 0xff, 0xff, 0xff, 0xff, 0x73, 0x3e, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x54, 0x26, 0xc9, 0xff, 0xff,
+  0xff, 0xff, 0x88, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xff, 0xff,
+  0xff, 0xff, 0x99, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x24, 0xff, 0xff, 0xff,
+  0xff, 0xe6, 0x08, 0xff, 0xff, 0xff, 0xff, 0x27, 0x1d, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd1, 0x0d, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x30, 0x2e, 0xff, 0xff, 0xff, 0xff, 0x8f,
+  0xff, 0xff, 0xff, 0xff, 0xdc, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xee, 0x2d,
+  0x38, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x80, 0x26, 0xc3, 0xff, 0xff,
+  0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xff, 0xff,
+  0xff, 0x20, 0x26, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xd6, 0xff,
+  0xff, 0xff, 0xff, 0xc4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xc3,
+  0xff, 0xff, 0xff, 0xff, 0x30, 0x3f, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd7,
+  0xff, 0xff, 0xff, 0xff, 0x1c, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xc8,
+  0x26, 0x05, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x84, 0x26, 0x09, 0xff,
+  0xff, 0xff, 0xff, 0x4b, 0x02, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x21, 0xff,
+  0xff, 0xff, 0xff, 0x44, 0x28, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x3f, 0x03,
+  0xff, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x31, 0xd1,
+  0xff, 0xff, 0xff, 0xff, 0x54, 0x26, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xff,
+  0x17, 0x16, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x0e, 0x2b, 0x2d, 0x38, 0x31,
+  0xd5, 0xff, 0xff, 0xff, 0xff, 0x08, 0x36, 0xff, 0xff, 0xff, 0xff, 0xc2,
+  0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff,
+  0xff, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x30, 0xff, 0xff, 0xff,
+  0xff, 0x02, 0x31, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x10, 0x26, 0xc7, 0xff,
+  0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x31, 0xd2, 0xff,
+  0xff, 0xff, 0xff, 0x5c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff,
+  0xff, 0xff, 0xff, 0xfb, 0x26, 0xc3, 0x20, 0xff, 0xff, 0xff, 0xff, 0x31,
+  0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xa7,
+  0x26, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xca, 0xff, 0xff, 0xff, 0xff, 0x1a,
+  0x31, 0xd2, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x26, 0xc3, 0xff, 0xff,
+  0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x80, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd2, 0x09, 0x08, 0x26,
+  0xc5, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x2e, 0x31, 0xd2, 0x0d, 0x26, 0xc9,
+  0xff, 0xff, 0xff, 0xff, 0x88, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x3b,
+  0x17, 0x26, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff,
+  0x76, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0xd1, 0x0d, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0xff,
+  0xff, 0xff, 0xe7, 0x26, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3a, 0x31,
+  0xd3, 0xff, 0xff, 0xff, 0xff, 0x80, 0x26, 0xc3, 0xff, 0xff, 0xff, 0xff,
+  0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x20,
+  0x26, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xd6, 0xff, 0xff, 0xff,
+  0xff, 0xc4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xc2, 0xff, 0xff,
+  0xff, 0xff, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xef, 0x26, 0x0b, 0xff, 0xff,
+  0xff, 0xff, 0x15, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x26, 0x05,
+  0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x84, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xea, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff,
+  0xf6, 0x08, 0x26, 0xc2, 0x33, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x54,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x55, 0x1e, 0x26, 0xc3, 0xff, 0xff,
+  0xff, 0xff, 0xf8, 0x3a, 0x31, 0xd3, 0x06, 0xff, 0xff, 0xff, 0xff, 0xd7,
+  0x26, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x0f,
+  0x31, 0xf2, 0x16, 0x2e, 0xff, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff,
+  0xff, 0x48, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xff, 0xff, 0xff, 0x08,
+  0x28, 0x30, 0xff, 0xff, 0xff, 0xff, 0x65, 0x01, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x28, 0x31, 0xd1, 0x25, 0x26, 0xc0,
+  0x10, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x47, 0xff,
+  0xff, 0xff, 0xff, 0x0a, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff,
+  0xff, 0x69, 0x38, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xff, 0xff, 0xff,
+  0xff, 0x0d, 0x31, 0xd2, 0x07, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x26, 0xc0,
+  0x2d, 0xff, 0xff, 0xff, 0xff, 0x42, 0x16, 0x09, 0xff, 0xff, 0xff, 0xff,
+  0x29, 0xff, 0xff, 0xff, 0xff, 0x81, 0x38, 0xff, 0xff, 0xff, 0xff, 0x80,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xff,
+  0xff, 0xff, 0xff, 0xf1, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0xff,
+  0xff, 0xff, 0x58, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x18, 0x1e, 0x10,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0xd1, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xff, 0xff, 0xff, 0xff, 0x38, 0x09,
+  0xff, 0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0x63, 0x36, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0x02, 0x31, 0xd5,
+  0xff, 0xff, 0xff, 0xff, 0x40, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x44,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x15, 0x15,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x32, 0xff, 0xff, 0xff, 0xff, 0x12,
+  0xff, 0xff, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xff,
+  0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0xff,
+  0xff, 0x54, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff,
+  0xff, 0xce, 0xff, 0xff, 0xff, 0xff, 0x40, 0x14, 0x30, 0xff, 0xff, 0xff,
+  0xff, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xcb, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x94,
+  0x26, 0x01, 0x31, 0xdc, 0x35, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31,
+  0xd6, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4,
+  0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0xf4,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x16, 0x31, 0xd6, 0xff, 0xff, 0xff,
+  0xff, 0xc8, 0x26, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x31, 0xd6, 0xff, 0xff,
+  0xff, 0xff, 0x84, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x16, 0x39,
+  0x26, 0xc1, 0x3d, 0xff, 0xff, 0xff, 0xff, 0x0e, 0xff, 0xff, 0xff, 0xff,
+  0x6c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x23, 0x31, 0xd0, 0xff, 0xff,
+  0xff, 0xff, 0x54, 0x26, 0xc0, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xce, 0xff,
+  0xff, 0xff, 0xff, 0x40, 0x14, 0x30, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xff,
+  0xff, 0xff, 0xff, 0xfc, 0x26, 0x2a, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd2,
+  0xff, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x26, 0x1b,
+  0xff, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x33, 0xff,
+  0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xaf, 0x31, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x45, 0x31, 0xd1, 0x25, 0x26, 0xc0, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0x1c, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x5c,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x78, 0x31, 0xd2, 0xff, 0xff, 0xff,
+  0xff, 0x67, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x92, 0x31, 0xc4, 0xff,
+  0xff, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xff, 0xff, 0x63, 0x31, 0xd1, 0xff,
+  0xff, 0xff, 0xff, 0x95, 0x26, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x39, 0x31,
+  0xc2, 0xff, 0xff, 0xff, 0xff, 0x32, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd1,
+  0xff, 0xff, 0xff, 0xff, 0x5f, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xae,
+  0x07, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0x26, 0x25, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x40, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd6, 0xff,
+  0xff, 0xff, 0xff, 0x8d, 0x26, 0xc0, 0x28, 0x31, 0xc2, 0xff, 0xff, 0xff,
+  0xff, 0x2e, 0x05, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0xd1, 0x0d, 0x26, 0xc0, 0x13, 0xff, 0xff, 0xff, 0xff,
+  0x10, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x97, 0x26, 0xc0, 0x3b, 0x31,
+  0xd6, 0xff, 0xff, 0xff, 0xff, 0x94, 0x26, 0x01, 0x31, 0xdc, 0x35, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xc4,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x4f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb8,
+  0x1f, 0x31, 0xd7, 0x09, 0x26, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x31, 0xd6,
+  0xff, 0xff, 0xff, 0xff, 0x84, 0x26, 0x0e, 0xff, 0xff, 0xff, 0xff, 0x04,
+  0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xda, 0x31, 0xc0, 0x3c, 0x22, 0x26, 0xff, 0xff, 0xff, 0xff, 0x55, 0x31,
+  0xd0, 0xff, 0xff, 0xff, 0xff, 0x54, 0x26, 0xc0, 0x13, 0x21, 0x31, 0xc2,
+  0x2e, 0x26, 0xc0, 0x3b, 0x31, 0xd1, 0x32, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x7f, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x31, 0xfa, 0xff, 0xff,
+  0xff, 0xff, 0x17, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x31, 0xd1,
+  0x25, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x95, 0x31, 0xc3, 0x3c, 0xff,
+  0xff, 0xff, 0xff, 0xe0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x31, 0xd2,
+  0x04, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x33, 0x31, 0xd8, 0x3c, 0x20,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff,
+  0xb4, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x26, 0x0e, 0xff, 0xff, 0xff,
+  0xff, 0x18, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x26, 0x1b, 0x31,
+  0xd5, 0xff, 0xff, 0xff, 0xff, 0x40, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x44, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd6, 0x34, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xc5, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd1, 0x0d, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff,
+  0x47, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x49,
+  0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x94, 0x26, 0x01, 0x31, 0xdc, 0x35,
+  0x26, 0x19, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xd4, 0x31, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xff, 0xff, 0xff,
+  0xff, 0xfb, 0x26, 0xff, 0xff, 0xff, 0xff, 0xac, 0x33, 0x31, 0xd8, 0x09,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff,
+  0x84, 0x26, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x31, 0xc1, 0xff, 0xff, 0xff,
+  0xff, 0xba, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x31, 0xc1, 0x04, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0x6f, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x54,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x31, 0xc3, 0x3e, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xc0, 0x14, 0x31, 0xd1, 0x1b, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xf4, 0x1f, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x23, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x99, 0x31, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x3a,
+  0xff, 0xff, 0xff, 0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x01, 0x10,
+  0x26, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x77, 0x31, 0xd1, 0x25, 0x26, 0xc0,
+  0x0d, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x26, 0x10, 0xff, 0xff,
+  0xff, 0xff, 0x0b, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x1d, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x8e, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x26,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x31, 0xc4, 0xff, 0xff, 0xff,
+  0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd0, 0x39, 0x26, 0xc0, 0x0c, 0x31,
+  0xc5, 0xff, 0xff, 0xff, 0xff, 0x78, 0x26, 0x03, 0xff, 0xff, 0xff, 0xff,
+  0x04, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x40, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd5, 0xff, 0xff, 0xff,
+  0xff, 0x22, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x81, 0x31, 0xc4, 0xff,
+  0xff, 0xff, 0xff, 0x70, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0xd1, 0x0d, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x46, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x2d, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x5a, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x94, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xf0, 0x31, 0xdc, 0x35, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xb8, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xd4, 0x1e, 0x10, 0x26, 0xff, 0xff, 0xff, 0xff, 0xba, 0xff, 0xff,
+  0xff, 0xff, 0x03, 0x31, 0xd9, 0x09, 0x26, 0x05, 0x31, 0xd6, 0xff, 0xff,
+  0xff, 0xff, 0x84, 0x26, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x31, 0xc1, 0xff,
+  0xff, 0xff, 0xff, 0xae, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x31, 0xc1,
+  0x00, 0x26, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x31, 0xd0, 0xff, 0xff, 0xff,
+  0xff, 0x54, 0x26, 0xc0, 0x33, 0x31, 0xc3, 0x20, 0x26, 0xc0, 0x0f, 0x31,
+  0xd0, 0x07, 0x22, 0x26, 0x2f, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xdf,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x31, 0xf1, 0x12, 0x04, 0x26, 0xc8,
+  0x05, 0x31, 0xd1, 0x25, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x34, 0x31,
+  0xc4, 0xff, 0xff, 0xff, 0xff, 0x80, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x24, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x41,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x61, 0x31, 0xd9, 0xff, 0xff, 0xff,
+  0xff, 0x42, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x31, 0xc4, 0xff,
+  0xff, 0xff, 0xff, 0x51, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x3d, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x7b, 0x31, 0xc5, 0x0f, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x20, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x40, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd5, 0x3c,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x60, 0x31, 0xc4, 0xff, 0xff, 0xff,
+  0xff, 0x50, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xd1, 0x0d, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x32, 0x31,
+  0xc3, 0x29, 0x26, 0xc0, 0x11, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x94,
+  0x26, 0x01, 0x31, 0xdc, 0x35, 0x26, 0x19, 0x31, 0xd6, 0xff, 0xff, 0xff,
+  0xff, 0xc4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x26, 0xc1, 0xff, 0xff,
+  0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0x25, 0x31, 0xd9, 0x09, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xbc, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x84,
+  0x26, 0x09, 0x31, 0xc1, 0x34, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x31,
+  0xc1, 0x09, 0x26, 0xff, 0xff, 0xff, 0xff, 0x83, 0x31, 0xd0, 0xff, 0xff,
+  0xff, 0xff, 0x54, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x32, 0x31, 0xc3,
+  0x29, 0x26, 0xc0, 0x11, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x11, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x98, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff,
+  0xbd, 0x26, 0xff, 0xff, 0xff, 0xff, 0xec, 0x31, 0xf1, 0xff, 0xff, 0xff,
+  0xff, 0x7c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff,
+  0xff, 0x4e, 0x2e, 0xff, 0xff, 0xff, 0xff, 0x03, 0x31, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x0d, 0x26, 0xc0, 0x05, 0x31, 0xd1, 0x25, 0x26, 0xc0, 0x3f,
+  0x31, 0xc4, 0x0e, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x31, 0xd0,
+  0x16, 0x26, 0xc0, 0x0d, 0x31, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x56, 0x31, 0xc4, 0x3e, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff,
+  0xff, 0xff, 0x4b, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
+  0xff, 0xff, 0xfc, 0xc0, 0x10, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc0,
+  0x26, 0xc2, 0x36, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x40, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd5, 0x35,
+  0x26, 0xc0, 0x23, 0x31, 0xc4, 0x3e, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd1, 0x0d, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x30, 0x31, 0xc3, 0x29, 0x26, 0xc0, 0x11, 0x31, 0xd6, 0xff,
+  0xff, 0xff, 0xff, 0x94, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x31, 0xdc,
+  0xff, 0xff, 0xff, 0xff, 0xcc, 0x26, 0x19, 0x31, 0xd6, 0xff, 0xff, 0xff,
+  0xff, 0xc4, 0x26, 0xc0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x38, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x07, 0x31, 0xd8,
+  0x09, 0x26, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x31, 0xd6, 0xff, 0xff, 0xff,
+  0xff, 0x84, 0x26, 0x09, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x26,
+  0x3d, 0x31, 0xc1, 0x09, 0x26, 0x1d, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff,
+  0x54, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x30, 0x31, 0xc3, 0xff, 0xff,
+  0xff, 0xff, 0x28, 0x26, 0xc0, 0x11, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff,
+  0x1c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x31, 0xc5, 0xff, 0xff,
+  0xff, 0xff, 0xb3, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x31, 0xf0, 0x12,
+  0xff, 0xff, 0xff, 0xff, 0xeb, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xff,
+  0xff, 0xff, 0xff, 0x04, 0x31, 0xc3, 0x30, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x7c, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x26, 0xc0, 0x2d,
+  0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x80, 0x26, 0xc0, 0x32, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0xd0, 0x3c, 0x26, 0xc0, 0x1c, 0x31, 0xd9, 0xff, 0xff,
+  0xff, 0xff, 0x40, 0x26, 0xc0, 0x06, 0xff, 0xff, 0xff, 0xff, 0x00, 0xc4,
+  0xff, 0xff, 0xff, 0xff, 0x51, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x40,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x3d, 0x26,
+  0xcb, 0x2d, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x40, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd5, 0x3c, 0x26,
+  0xc0, 0x11, 0x31, 0xc4, 0x2c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x40,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0xd1, 0x0d, 0x26, 0xc0, 0x01, 0x31, 0xc3,
+  0x29, 0x26, 0xc0, 0x11, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x94, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0x31, 0xdc, 0x35, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xb8, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xfb, 0x06, 0x31, 0xff, 0xff, 0xff, 0xff, 0x65, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x96, 0x31, 0xd8, 0x09, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xbc, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x84, 0x26, 0x09, 0x31,
+  0xc1, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x26, 0x3d, 0x31, 0xc1, 0x09, 0x26,
+  0x1d, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x54, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x30, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x28, 0x26, 0xc0,
+  0x11, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x11, 0x26, 0xc0, 0x39, 0x31,
+  0xc5, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x26, 0x15, 0x31, 0xf0, 0xff, 0xff,
+  0xff, 0xff, 0x21, 0x26, 0xc0, 0x08, 0x31, 0xc4, 0x14, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x7c, 0x31, 0xd1, 0x25, 0x26, 0xc0, 0x0d, 0x31, 0xc4,
+  0xff, 0xff, 0xff, 0xff, 0xa0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
+  0xff, 0xff, 0xff, 0x09, 0x31, 0xd0, 0x30, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x8f, 0x31, 0xd9, 0x32, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x7f,
+  0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0x19, 0x26, 0xc0, 0x0f, 0x31, 0xdf, 0xff, 0xff,
+  0xff, 0xff, 0x40, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0xd5, 0x32, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x82,
+  0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x71, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd1, 0x0d, 0x26, 0xc0, 0x01,
+  0x31, 0xc3, 0x29, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x60, 0x31, 0xd6,
+  0xff, 0xff, 0xff, 0xff, 0x94, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x31,
+  0xdc, 0x35, 0x26, 0x19, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xc1, 0x34, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x55, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x26, 0x10,
+  0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x84, 0x26, 0x09, 0x31, 0xc1, 0xff,
+  0xff, 0xff, 0xff, 0xa8, 0x26, 0x3d, 0x31, 0xc1, 0x09, 0x26, 0x1d, 0x31,
+  0xd0, 0xff, 0xff, 0xff, 0xff, 0x54, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x30, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x28, 0x26, 0xc0, 0x11, 0x31,
+  0xd0, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x26,
+  0x2f, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xd1, 0x31, 0xf0, 0x29, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x66,
+  0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x7c, 0x31, 0xd1, 0x25, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x95,
+  0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xe0,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff,
+  0xd9, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0x06,
+  0x31, 0xd9, 0x0a, 0x26, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x31, 0xc4, 0xff,
+  0xff, 0xff, 0xff, 0xb4, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x93, 0x31, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x40, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd6,
+  0xff, 0xff, 0xff, 0xff, 0xe9, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x31,
+  0xc4, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x54,
+  0x26, 0xc0, 0x01, 0x31, 0xc3, 0x29, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x60, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x94, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xf0, 0x31, 0xdc, 0x35, 0x26, 0x19, 0x31, 0xd6, 0xff, 0xff, 0xff,
+  0xff, 0xc4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xc1, 0xff, 0xff,
+  0xff, 0xff, 0x0f, 0x06, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x32, 0x31,
+  0xd6, 0x2f, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x31, 0xd6, 0xff, 0xff,
+  0xff, 0xff, 0x84, 0x26, 0x09, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xa8,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x31, 0xc1, 0x09, 0x26, 0x1d, 0x31,
+  0xd0, 0xff, 0xff, 0xff, 0xff, 0x54, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x30, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x28, 0x26, 0xc0, 0x11, 0x31,
+  0xd1, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xf4, 0x14, 0x31, 0xc3, 0x32, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x99, 0x31, 0xf0, 0x1f, 0x24, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xaf, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x41, 0xff, 0xff, 0xff, 0xff,
+  0xfd, 0x26, 0xc0, 0x05, 0x31, 0xd1, 0x25, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x1c, 0x31, 0xc2, 0xff, 0xff, 0xff,
+  0xff, 0x5b, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x74, 0x31, 0xd2, 0xff,
+  0xff, 0xff, 0xff, 0x68, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x92, 0x31,
+  0xc4, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x61, 0x31,
+  0xd1, 0x37, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
+  0x38, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x32, 0x10, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff,
+  0xff, 0xff, 0x62, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+  0xff, 0x34, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0x51, 0xff, 0xff, 0xff,
+  0xff, 0x7e, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x40, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd6, 0x0b, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x46, 0x31, 0xc2, 0x20, 0xff, 0xff, 0xff,
+  0xff, 0xfc, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xd1, 0x0d, 0x26, 0xc0, 0x01, 0x31, 0xc3, 0xff, 0xff, 0xff,
+  0xff, 0x28, 0x26, 0xc0, 0x11, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x94,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x31, 0xdc, 0x35, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xb8, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xd4, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x38, 0x3a,
+  0x26, 0x35, 0xff, 0xff, 0xff, 0xff, 0x06, 0x31, 0xd5, 0xff, 0xff, 0xff,
+  0xff, 0x90, 0x26, 0x24, 0x2e, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x84,
+  0x26, 0x09, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xa4, 0x31, 0xc1, 0x09, 0x26, 0x1d, 0x31, 0xd0, 0xff, 0xff,
+  0xff, 0xff, 0x54, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x30, 0x31, 0xc3,
+  0xff, 0xff, 0xff, 0xff, 0x28, 0x26, 0xc0, 0x11, 0x31, 0xd1, 0x08, 0x26,
+  0xc0, 0x1b, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x3e, 0x31, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x94, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff,
+  0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
+  0xff, 0x78, 0x38, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x7c, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x26, 0xc0,
+  0x10, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0x46, 0x14,
+  0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0x68, 0x38, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x31, 0xd2,
+  0x12, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0xb4, 0xff, 0xff, 0xff, 0xff, 0x42, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x3e,
+  0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x22, 0xff,
+  0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff,
+  0xff, 0xff, 0x19, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x26, 0x34, 0xff, 0xff,
+  0xff, 0xff, 0x57, 0xff, 0xff, 0xff, 0xff, 0x0d, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x54, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xfc,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0xd1, 0xff, 0xff, 0xff, 0xff, 0x02, 0x2d, 0x26, 0x03, 0xff, 0xff, 0xff,
+  0xff, 0x87, 0x17, 0x2a, 0xff, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff,
+  0xff, 0x23, 0x13, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0x9c, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x40, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff,
+  0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0xff, 0xed, 0x26, 0x01, 0xff, 0xff,
+  0xff, 0xff, 0x64, 0x37, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff,
+  0xff, 0xff, 0xe3, 0x01, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0xd1, 0x0d, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x30, 0x31, 0xc3, 0x29, 0x26, 0xc0, 0x11, 0x31, 0xd6, 0xff, 0xff, 0xff,
+  0xff, 0x94, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x31, 0xdc, 0xff, 0xff,
+  0xff, 0xff, 0xcc, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xd6, 0xff,
+  0xff, 0xff, 0xff, 0xc4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xc3,
+  0xff, 0xff, 0xff, 0xff, 0x78, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x92,
+  0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x39, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xb9, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x01,
+  0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x84, 0x26, 0x09, 0x31, 0xc1, 0xff,
+  0xff, 0xff, 0xff, 0xa8, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x31, 0xc1,
+  0x09, 0x26, 0x1d, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x54, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x30, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x28,
+  0x26, 0xc0, 0x11, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff,
+  0xff, 0xff, 0xd2, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x1d, 0x3b, 0x33,
+  0xff, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xb2, 0x31, 0xf2, 0x23, 0xff, 0xff, 0xff, 0xff,
+  0xd9, 0x26, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff,
+  0x34, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x31, 0xd1, 0xff, 0xff,
+  0xff, 0xff, 0x5c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xff, 0xff,
+  0xff, 0xff, 0xfc, 0x26, 0xc3, 0x0a, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x31,
+  0xd4, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x26,
+  0xc5, 0x00, 0xff, 0xff, 0xff, 0xff, 0x1b, 0x31, 0xd2, 0xff, 0xff, 0xff,
+  0xff, 0x43, 0x38, 0x26, 0xc3, 0x03, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd2,
+  0x1f, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x26, 0xc6, 0xff, 0xff, 0xff, 0xff,
+  0xaf, 0xff, 0xff, 0xff, 0xff, 0x1d, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff,
+  0x40, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x44, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x22, 0x26, 0xc3, 0xff, 0xff,
+  0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x3f, 0x31, 0xd1, 0x0d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+  0x01, 0x31, 0xc3, 0x29, 0x26, 0xc0, 0x11, 0x31, 0xd1, 0x21, 0x26, 0xc9,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xcc,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff,
+  0xc4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xc3, 0x3c, 0x3a, 0x26,
+  0xc0, 0x2c, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x97, 0x26, 0xc4, 0xff,
+  0xff, 0xff, 0xff, 0x24, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x84, 0x26,
+  0x09, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xa4, 0x31, 0xc1, 0x09, 0x26, 0x1d, 0x31, 0xd0, 0xff, 0xff, 0xff,
+  0xff, 0x54, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x30, 0x31, 0xc3, 0xff,
+  0xff, 0xff, 0xff, 0x28, 0x26, 0xc0, 0x11, 0x31, 0xd2, 0xff, 0xff, 0xff,
+  0xff, 0x21, 0x04, 0x26, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xff, 0xff,
+  0xff, 0xff, 0x10, 0x31, 0xf3, 0x0b, 0xff, 0xff, 0xff, 0xff, 0x82, 0xff,
+  0xff, 0xff, 0xff, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
+  0xff, 0xf2, 0x02, 0xff, 0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff,
+  0x12, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x7c, 0x31, 0xd1, 0x25, 0x26, 0xc0, 0x29, 0xff, 0xff, 0xff, 0xff, 0x39,
+  0xff, 0xff, 0xff, 0xff, 0xb2, 0x15, 0x19, 0xff, 0xff, 0xff, 0xff, 0xdb,
+  0xff, 0xff, 0xff, 0xff, 0x8f, 0x23, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff,
+  0x3d, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x04, 0x22, 0x03, 0x00, 0xff, 0xff,
+  0xff, 0xff, 0x6d, 0xff, 0xff, 0xff, 0xff, 0x04, 0x31, 0xd4, 0x1c, 0xff,
+  0xff, 0xff, 0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff,
+  0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xa8,
+  0xff, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xff, 0xff, 0x44, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd4, 0xff,
+  0xff, 0xff, 0xff, 0x37, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff,
+  0xff, 0xff, 0xf2, 0x19, 0x1a, 0x39, 0xff, 0xff, 0xff, 0xff, 0x32, 0x31,
+  0xd7, 0xff, 0xff, 0xff, 0xff, 0x40, 0x26, 0xc0, 0x1d, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0xe2, 0x24, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x32, 0xff, 0xff, 0xff,
+  0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x47, 0x26, 0xc0, 0x0e, 0x31, 0xd1,
+  0x0d, 0x26, 0xc0, 0x01, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x28, 0x26,
+  0xc0, 0x11, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x90, 0x26, 0xc9, 0xff,
+  0xff, 0xff, 0xff, 0xf0, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xb8, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xc4,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff,
+  0x18, 0x34, 0x26, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
+  0x20, 0x31, 0xd4, 0x3c, 0xff, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff, 0xff,
+  0xff, 0xce, 0x03, 0x26, 0xc1, 0x3d, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff,
+  0x84, 0x26, 0x09, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xa4, 0x31, 0xc1, 0x09, 0x26, 0x1d, 0x31, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0x54, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x30, 0x31,
+  0xc3, 0xff, 0xff, 0xff, 0xff, 0x28, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x60, 0x31, 0xd3, 0x14, 0xff, 0xff, 0xff, 0xff, 0x71, 0xff, 0xff, 0xff,
+  0xff, 0xc4, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
+  0xea, 0xff, 0xff, 0xff, 0xff, 0xba, 0x11, 0xff, 0xff, 0xff, 0xff, 0x03,
+  0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x59, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x23, 0x31, 0xfd, 0xd9, 0x0b, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xb6, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xea,
+  0xff, 0xff, 0xff, 0xff, 0x8b, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
+  0xff, 0xff, 0xff, 0x02, 0x31, 0xfd, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xe4,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xe9, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xe8,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x31, 0xfd, 0xd9, 0xff, 0xff, 0xff,
+  0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0x7d, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xe2, 0x2a, 0x30, 0xff,
+  0xff, 0xff, 0xff, 0x53, 0x1e, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x0d, 0xff,
+  0xff, 0xff, 0xff, 0x46, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x29, 0x31, 0xfd, 0xd7, 0x3c,
+  0x1e, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x28, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xe2, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x26, 0xc5, 0x0e, 0xff, 0xff, 0xff,
+  0xff, 0x52, 0x31, 0xfd, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x74, 0x26, 0xc4,
+  0xff, 0xff, 0xff, 0xff, 0x84, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xe3, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff,
+  0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x38, 0x22, 0x18,
+  0xff, 0xff, 0xff, 0xff, 0x91, 0xff, 0xff, 0xff, 0xff, 0x21, 0x31, 0xfd,
+  0xd6, 0x2d, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff,
+  0xff, 0xcb, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x31, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xc1, 0xff,
+  0xff, 0xff, 0xff, 0x19, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x35, 0xff, 0xff,
+  0xff, 0xff, 0xed, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff,
+  0xd8, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd7, 0x3a, 0xff, 0xff, 0xff,
+  0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xc4,
+  0xff, 0xff, 0xff, 0xff, 0x7a, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x31, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xca, 0x21, 0xff, 0xff, 0xff, 0xff,
+  0xe3, 0x26, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x31, 0xd7, 0xff, 0xff,
+  0xff, 0xff, 0xc0, 0x26, 0xff, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x26, 0xc2, 0xff, 0xff,
+  0xff, 0xff, 0xc6, 0xff, 0xff, 0xff, 0xff, 0x01, 0x31, 0xfd, 0xfd, 0xfd,
+  0xdf, 0xff, 0xff, 0xff, 0xff, 0x20, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x64, 0x31, 0xfd, 0xfd, 0xfd, 0xe2, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x26,
+  0xc0, 0x2c, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x04,
+  0x31, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x26, 0x39, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0xff,
+  0x2a, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x3f, 0x31, 0xfd, 0xfd, 0xfd, 0xdf, 0x11, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xc0, 0x3d, 0x31, 0xfd, 0xfd, 0xfd, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xa3,
+  0x26, 0x22, 0xff, 0xff, 0xff, 0xff, 0x05, 0x31, 0xda, 0xff, 0xff, 0xff,
+  0xff, 0xc0, 0x26, 0x39, 0xff, 0xff, 0xff, 0xff, 0x00, 0xda, 0x06, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x75, 0x31, 0xfd, 0xfd, 0xfd, 0xdf, 0x11,
+  0x26, 0xc0, 0x3d, 0x31, 0xfd, 0xfd, 0xfd, 0xe2, 0xff, 0xff, 0xff, 0xff,
+  0xb8, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x31, 0xdb, 0xff, 0xff, 0xff,
+  0xff, 0xc0, 0x26, 0x39, 0xff, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff,
+  0xff, 0xff, 0xf8, 0x26, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x31, 0xfd, 0xfd,
+  0xfd, 0xdf, 0x11, 0x26, 0xc0, 0x3d, 0x31, 0xfd, 0xfd, 0xfd, 0xe2, 0xff,
+  0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xcc, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x26, 0x39, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x93, 0x31, 0xfd, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x68,
+  0x26, 0xc0, 0x11, 0xff, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0xff,
+  0xb2, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xda,
+  0xff, 0xff, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x14, 0x31, 0xd5,
+  0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff,
+  0xff, 0xff, 0xd8, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff,
+  0xff, 0xb4, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0x1c,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x31, 0xd3, 0xff, 0xff, 0xff,
+  0xff, 0x0c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x31, 0xff, 0xff,
+  0xff, 0xff, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x94, 0xff, 0xff, 0xff, 0xff,
+  0xd9, 0x03, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xa5,
+  0xff, 0xff, 0xff, 0xff, 0x2f, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x07,
+  0x15, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xfa,
+  0x34, 0x0b, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0x44,
+  0x12, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x34,
+  0x26, 0xca, 0x25, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x54, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x30, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x28,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x60, 0x31, 0xd0, 0xff, 0xff, 0xff,
+  0xff, 0x72, 0x26, 0xc0, 0x29, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0x4e,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x31, 0xce, 0xff, 0xff, 0xff,
+  0xff, 0xe1, 0x26, 0xff, 0xff, 0xff, 0xff, 0x97, 0x31, 0xc9, 0xff, 0xff,
+  0xff, 0xff, 0xbd, 0x26, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x31, 0xce, 0xff,
+  0xff, 0xff, 0xff, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xec, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xb9, 0x3c, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x0e, 0xff,
+  0xff, 0xff, 0xff, 0xdc, 0x26, 0x04, 0xff, 0xff, 0xff, 0xff, 0x0d, 0x31,
+  0xcf, 0xff, 0xff, 0xff, 0xff, 0x62, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x48, 0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xff, 0xff, 0xff, 0xff,
+  0xfd, 0x26, 0xff, 0xff, 0xff, 0xff, 0x91, 0x31, 0xd1, 0xff, 0xff, 0xff,
+  0xff, 0xe4, 0x26, 0xc8, 0xff, 0xff, 0xff, 0xff, 0x38, 0x31, 0xd6, 0xff,
+  0xff, 0xff, 0xff, 0xc0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0xff,
+  0xff, 0xf0, 0x26, 0xff, 0xff, 0xff, 0xff, 0x94, 0x31, 0xfd, 0xd8, 0xff,
+  0xff, 0xff, 0xff, 0x68, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x78, 0xff,
+  0xff, 0xff, 0xff, 0xfc, 0x26, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff,
+  0xff, 0xff, 0xff, 0x2b, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xe5, 0x26, 0xc3, 0x10, 0xff, 0xff, 0xff, 0xff, 0x77,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x31, 0xd3, 0xff, 0xff, 0xff,
+  0xff, 0x0c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff,
+  0xff, 0x2e, 0x20, 0x26, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x31, 0xd1,
+  0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x26, 0xc6,
+  0xff, 0xff, 0xff, 0xff, 0x4c, 0x31, 0xd1, 0x2d, 0x26, 0xca, 0xff, 0xff,
+  0xff, 0xff, 0x1c, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x54, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x30, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x28,
+  0x26, 0xc0, 0x11, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff,
+  0xff, 0xff, 0xfc, 0x26, 0xff, 0xff, 0xff, 0xff, 0x83, 0x31, 0xc5, 0xff,
+  0xff, 0xff, 0xff, 0xa8, 0x26, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x28, 0x31,
+  0xce, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd0,
+  0x31, 0xc8, 0x07, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0x7f, 0x31, 0xcf, 0x09, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x7b, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0x2c, 0x31, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0x0b, 0x17, 0x26, 0xff, 0xff, 0xff, 0xff, 0xab,
+  0x31, 0xc5, 0xff, 0xff, 0xff, 0xff, 0x7a, 0x26, 0xc0, 0x2b, 0x31, 0xd1,
+  0xff, 0xff, 0xff, 0xff, 0xe4, 0x26, 0xc8, 0xff, 0xff, 0xff, 0xff, 0x38,
+  0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xcc, 0xff, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xc0,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0x00, 0xdb,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0x26, 0xff, 0xff, 0xff, 0xff, 0x94, 0x31,
+  0xfd, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x68, 0x26, 0xc0, 0x10, 0xff, 0xff,
+  0xff, 0xff, 0xd5, 0x1d, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xff, 0xff, 0xff,
+  0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x03, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x08, 0x31, 0xd1, 0x33, 0xff, 0xff,
+  0xff, 0xff, 0xd6, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff,
+  0xff, 0x74, 0xff, 0xff, 0xff, 0xff, 0x17, 0x14, 0xff, 0xff, 0xff, 0xff,
+  0x40, 0x37, 0x05, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x6c, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff,
+  0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x53, 0x0d, 0x09, 0xff, 0xff, 0xff,
+  0xff, 0x39, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xcc,
+  0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x26, 0x1b, 0xff, 0xff, 0xff,
+  0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x24, 0x14, 0xff, 0xff, 0xff, 0xff,
+  0x11, 0x2b, 0xff, 0xff, 0xff, 0xff, 0x61, 0xff, 0xff, 0xff, 0xff, 0xba,
+  0xff, 0xff, 0xff, 0xff, 0x48, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x20,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x64, 0x31,
+  0xd7, 0xff, 0xff, 0xff, 0xff, 0x54, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x30, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x28, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x60, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xdc, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x38,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0x93, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff,
+  0x67, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x35, 0x31, 0xc7, 0x2b, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x42, 0x31, 0xd0, 0x12, 0x26, 0x05, 0xff,
+  0xff, 0xff, 0xff, 0x3e, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x68, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x5e, 0x31, 0xd2, 0x39, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x14, 0x31, 0xc4, 0xff, 0xff,
+  0xff, 0xff, 0xda, 0x26, 0xff, 0xff, 0xff, 0xff, 0xcb, 0x31, 0xd9, 0x1f,
+  0xff, 0xff, 0xff, 0xff, 0xce, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff,
+  0xff, 0xff, 0xff, 0x15, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xca, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xc0,
+  0x26, 0x39, 0xff, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0xff, 0xff,
+  0xef, 0x26, 0xff, 0xff, 0xff, 0xff, 0x96, 0x31, 0xfd, 0xd8, 0x29, 0x26,
+  0xc0, 0x36, 0xff, 0xff, 0xff, 0xff, 0x18, 0x31, 0xc2, 0x11, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x6a, 0x31, 0xd1, 0x3d, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x6f, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x16, 0xff, 0xff,
+  0xff, 0xff, 0xee, 0x26, 0xc0, 0x15, 0x31, 0xd3, 0x35, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xff, 0xff, 0xff,
+  0xff, 0x0b, 0x31, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff,
+  0xff, 0x72, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xef, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xa8, 0x31, 0xdd, 0xff, 0xff, 0xff, 0xff, 0x20, 0x26, 0xc0,
+  0x3d, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x54, 0x26, 0xc0, 0x01, 0x31,
+  0xc3, 0xff, 0xff, 0xff, 0xff, 0x28, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x60, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x5b, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x37, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x5d, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x36, 0x31, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x2a,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x42, 0x31, 0xc7, 0xff, 0xff, 0xff,
+  0xff, 0x67, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff,
+  0x0a, 0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff,
+  0xbc, 0x26, 0x08, 0x18, 0x31, 0xff, 0xff, 0xff, 0xff, 0x2e, 0xff, 0xff,
+  0xff, 0xff, 0xf7, 0x26, 0xff, 0xff, 0xff, 0xff, 0x9a, 0x31, 0xd3, 0xff,
+  0xff, 0xff, 0xff, 0x33, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x71, 0x31,
+  0xc3, 0xff, 0xff, 0xff, 0xff, 0x3d, 0x26, 0xc0, 0x1e, 0x31, 0xd9, 0x34,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x39, 0x31,
+  0xd7, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x26, 0xff, 0xff, 0xff, 0xff, 0xbf,
+  0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0x00, 0xdb, 0x08,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x31, 0xfd, 0xd8, 0xff, 0xff, 0xff,
+  0xff, 0x68, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x31, 0xc3, 0x07,
+  0xff, 0xff, 0xff, 0xff, 0xe6, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x31,
+  0xd1, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf0,
+  0x33, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x26, 0xc0, 0x15, 0x31,
+  0xd3, 0x35, 0x26, 0xc1, 0x2b, 0x31, 0xd7, 0x07, 0x3a, 0x26, 0x39, 0x31,
+  0xdd, 0xff, 0xff, 0xff, 0xff, 0x20, 0x26, 0xc0, 0x3d, 0x31, 0xd7, 0x0d,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x30, 0x31, 0xc3, 0xff, 0xff, 0xff,
+  0xff, 0x28, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x60, 0x31, 0xd1, 0xff,
+  0xff, 0xff, 0xff, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0x91, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x26, 0x04,
+  0x31, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xec,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0x7b, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff,
+  0xcb, 0x26, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x31, 0xc1, 0xff, 0xff, 0xff,
+  0xff, 0xa0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x31, 0xd2, 0x23, 0x08,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xb9, 0xff, 0xff, 0xff, 0xff, 0x0d, 0xff,
+  0xff, 0xff, 0xff, 0xd8, 0x26, 0x0b, 0xff, 0xff, 0xff, 0xff, 0x08, 0x31,
+  0xd4, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x26, 0xff, 0xff, 0xff, 0xff, 0xd4,
+  0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x26, 0x38, 0xff, 0xff, 0xff,
+  0xff, 0x0e, 0x31, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x60, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x19, 0xff,
+  0xff, 0xff, 0xff, 0xfc, 0x26, 0x0f, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff,
+  0xc0, 0x26, 0xff, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0xdb, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe4,
+  0xff, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xd7,
+  0xff, 0xff, 0xff, 0xff, 0x68, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x4c,
+  0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xf6, 0xff, 0xff, 0xff, 0xff, 0x03, 0x31, 0xcf, 0x3c, 0xff, 0xff, 0xff,
+  0xff, 0xf2, 0x26, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x31, 0xc4, 0xff, 0xff,
+  0xff, 0xff, 0x49, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x31, 0xd3,
+  0xff, 0xff, 0xff, 0xff, 0x0c, 0x26, 0xc0, 0x16, 0x31, 0xd9, 0x0d, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x50, 0x12, 0x31,
+  0xdb, 0xff, 0xff, 0xff, 0xff, 0x20, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x64, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x54, 0x26, 0xc0, 0x01, 0x31,
+  0xc3, 0xff, 0xff, 0xff, 0xff, 0x28, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x60, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xe8, 0x12, 0x31, 0xc1, 0x23, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0x7d, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xb0,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x13, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x26, 0x08, 0x31, 0xc1, 0xff, 0xff,
+  0xff, 0xff, 0xd9, 0x26, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x31, 0xd3, 0xff,
+  0xff, 0xff, 0xff, 0x3c, 0x3a, 0x26, 0xff, 0xff, 0xff, 0xff, 0xde, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x23, 0x31, 0xd5,
+  0xff, 0xff, 0xff, 0xff, 0x6a, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x37,
+  0x31, 0xc1, 0x35, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xa0, 0x31, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xff, 0xff,
+  0xff, 0xfe, 0x26, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x31, 0xd6, 0xff, 0xff,
+  0xff, 0xff, 0x09, 0xff, 0xff, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0xff,
+  0xc4, 0x26, 0x10, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x31, 0xdb, 0xff, 0xff,
+  0xff, 0xff, 0xc0, 0x26, 0x39, 0xff, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xff,
+  0xff, 0xff, 0xff, 0x63, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xa8, 0xff,
+  0xff, 0xff, 0xff, 0x2d, 0x33, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x26,
+  0x11, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x04,
+  0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0x25, 0x31, 0xc3,
+  0xff, 0xff, 0xff, 0xff, 0x19, 0xff, 0xff, 0xff, 0xff, 0x77, 0x31, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0x68, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x2c,
+  0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x88, 0x26, 0xc0, 0x2e, 0x31, 0xcf,
+  0xff, 0xff, 0xff, 0xff, 0x10, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x97,
+  0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x28, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x6c, 0x31, 0xd3, 0x35, 0x26, 0xc0, 0x0f, 0x31, 0xd9, 0xff, 0xff,
+  0xff, 0xff, 0x55, 0x26, 0xc1, 0x01, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff,
+  0xff, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x1f, 0x31, 0xd7,
+  0xff, 0xff, 0xff, 0xff, 0x20, 0x26, 0xc0, 0x3d, 0x31, 0xd7, 0x0d, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x30, 0x31, 0xc3, 0x29, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x60, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x45, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x46, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff,
+  0x6d, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x21,
+  0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x73, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xec, 0x31, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x57, 0x26, 0x15, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x2c, 0x31, 0x02, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x4e, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x74, 0x26, 0xc1, 0xff, 0xff,
+  0xff, 0xff, 0x50, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x38, 0x26,
+  0x0f, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x62, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x3d, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x2b, 0x17, 0x26,
+  0x24, 0x12, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x26, 0xc1, 0xff,
+  0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x52, 0x31, 0xdc, 0xff,
+  0xff, 0xff, 0xff, 0xc0, 0x26, 0x39, 0xff, 0xff, 0xff, 0xff, 0x00, 0xdc,
+  0xff, 0xff, 0xff, 0xff, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x26, 0xc1,
+  0xff, 0xff, 0xff, 0xff, 0xd8, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x5e,
+  0xff, 0xff, 0xff, 0xff, 0xf8, 0x26, 0xc3, 0x3a, 0xff, 0xff, 0xff, 0xff,
+  0xa5, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xff, 0xff, 0x0e, 0xff,
+  0xff, 0xff, 0xff, 0x18, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff,
+  0xff, 0xff, 0xa8, 0x31, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x68, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x22, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x7f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x23, 0x31,
+  0xcf, 0xff, 0xff, 0xff, 0xff, 0x1c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x8e, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x6c, 0x31, 0xd3, 0x35, 0x26, 0xc0, 0x1d, 0x31, 0xda, 0x2e,
+  0xff, 0xff, 0xff, 0xff, 0xd9, 0x26, 0xc3, 0x03, 0xff, 0xff, 0xff, 0xff,
+  0x79, 0x07, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x20, 0x26, 0xc0, 0x3d,
+  0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x54, 0x26, 0xc0, 0x01, 0x31, 0xc3,
+  0xff, 0xff, 0xff, 0xff, 0x28, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x60,
+  0x31, 0xd2, 0x07, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xa0, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xc3, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x36, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x26, 0x31, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0x6b, 0x26, 0x22, 0x31, 0xff, 0xff, 0xff, 0xff,
+  0x4b, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x02, 0x31, 0xd4, 0xff, 0xff,
+  0xff, 0xff, 0x37, 0x1b, 0x26, 0x17, 0xff, 0xff, 0xff, 0xff, 0x1e, 0x31,
+  0xd7, 0x11, 0x26, 0x17, 0x1f, 0x31, 0xc0, 0x12, 0x26, 0x04, 0x31, 0xd7,
+  0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xda, 0xff, 0xff, 0xff, 0xff, 0x11, 0x31, 0xd6, 0x05,
+  0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x00, 0x31, 0xdc, 0xff, 0xff,
+  0xff, 0xff, 0xc0, 0x26, 0xff, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xdc, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xde, 0x26, 0xc1, 0xff,
+  0xff, 0xff, 0xff, 0xd8, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x30,
+  0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff,
+  0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x34, 0xff, 0xff, 0xff, 0xff,
+  0x89, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x26, 0xc3, 0xff, 0xff, 0xff, 0xff,
+  0xee, 0xff, 0xff, 0xff, 0xff, 0x42, 0x31, 0xf0, 0xff, 0xff, 0xff, 0xff,
+  0x68, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x2c, 0x31, 0xc4, 0x09, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x18, 0x31, 0xcf, 0x37, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x97, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x28, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x31, 0xd3, 0x35, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x7c, 0x31, 0xdc, 0xff, 0xff, 0xff, 0xff, 0x2a, 0xff,
+  0xff, 0xff, 0xff, 0x62, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xff, 0xff,
+  0xff, 0xdc, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x75, 0x31, 0xd5, 0xff,
+  0xff, 0xff, 0xff, 0x20, 0x26, 0xc0, 0x3d, 0x31, 0xd7, 0x0d, 0x26, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x30, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x2b,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x60, 0x31, 0xd3, 0xff, 0xff, 0xff,
+  0xff, 0x8b, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff,
+  0x08, 0x31, 0xff, 0xff, 0xff, 0xff, 0x22, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x66, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff,
+  0xff, 0xf4, 0x26, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x31, 0xff, 0xff, 0xff,
+  0xff, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x09,
+  0xff, 0xff, 0xff, 0xff, 0xf6, 0x2f, 0x31, 0xff, 0xff, 0xff, 0xff, 0x84,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x31, 0xd4, 0x02, 0xff, 0xff, 0xff,
+  0xff, 0xe1, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xca, 0xff, 0xff, 0xff,
+  0xff, 0x06, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x26, 0xc0, 0x06,
+  0x31, 0xff, 0xff, 0xff, 0xff, 0x25, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x76, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0xff,
+  0xbd, 0x26, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x29, 0x31, 0xd8, 0x14, 0x0e,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
+  0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff,
+  0xff, 0xff, 0xc0, 0x26, 0xff, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x5c, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0xa3, 0x0a, 0x33, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x82,
+  0xff, 0xff, 0xff, 0xff, 0x0b, 0x31, 0xc3, 0x16, 0xff, 0xff, 0xff, 0xff,
+  0x74, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff,
+  0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0x94, 0xff, 0xff, 0xff,
+  0xff, 0x18, 0x31, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x68, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x4c, 0x31, 0xc4, 0x1e, 0x26, 0x19, 0x1d, 0x31, 0xcf,
+  0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xb7, 0x31, 0xc4, 0xff, 0xff, 0xff, 0xff, 0x48, 0x26,
+  0xc0, 0x15, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x26, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x7c, 0x31, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x4c, 0xff,
+  0xff, 0xff, 0xff, 0xf0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x31, 0xd5,
+  0xff, 0xff, 0xff, 0xff, 0x20, 0x26, 0xc0, 0x3d, 0x31, 0xd7, 0xff, 0xff,
+  0xff, 0xff, 0x4f, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x34, 0x31, 0xc3,
+  0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0x60, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x54, 0x31, 0x05, 0x26, 0x19, 0xff, 0xff,
+  0xff, 0xff, 0x11, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x98, 0x34, 0x26, 0x0b, 0x31, 0xff, 0xff, 0xff, 0xff,
+  0xb6, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x14, 0x10, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0x97, 0x31, 0xd3, 0x07, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xec, 0x0d, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x95, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xc2, 0x31, 0xff, 0xff, 0xff, 0xff, 0x86, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x17, 0x31, 0xd6,
+  0xff, 0xff, 0xff, 0xff, 0x93, 0x26, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff,
+  0xff, 0xff, 0xff, 0x4b, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x15, 0x2f,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0x99, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff,
+  0xc0, 0x26, 0x39, 0xff, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0xff,
+  0xff, 0xbe, 0x26, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
+  0x03, 0x31, 0xfd, 0xd7, 0x29, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x8d,
+  0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xe5,
+  0x26, 0x3e, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0x06, 0x31, 0xc3, 0xff, 0xff,
+  0xff, 0xff, 0x89, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x31, 0xd3,
+  0xff, 0xff, 0xff, 0xff, 0x0c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x7c,
+  0x31, 0xe1, 0x14, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x31, 0xd4,
+  0xff, 0xff, 0xff, 0xff, 0x19, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x70,
+  0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0x4e, 0x31, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x78, 0x26, 0xc0, 0x11,
+  0x31, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xaf, 0x31, 0x23, 0x26, 0xff, 0xff, 0xff, 0xff, 0xad, 0x31, 0xd4, 0xff,
+  0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x26, 0x28, 0x31, 0x15, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x5a, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x31, 0xff,
+  0xff, 0xff, 0xff, 0x73, 0x26, 0xc0, 0x0f, 0x31, 0xd6, 0xff, 0xff, 0xff,
+  0xff, 0x72, 0x26, 0xc0, 0x34, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xaf, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x64, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x77, 0x31, 0xdd, 0x37, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xbf, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x39, 0xff, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff,
+  0xff, 0xff, 0xe4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x31, 0xfd, 0xd8,
+  0x29, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
+  0x18, 0x31, 0xc2, 0x11, 0x26, 0xc0, 0x15, 0x31, 0xd1, 0xff, 0xff, 0xff,
+  0xff, 0x65, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x31, 0xc2, 0xff,
+  0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0xff, 0xed, 0x26, 0xc0, 0x15,
+  0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x26, 0xc0, 0x05, 0x31, 0xe1,
+  0xff, 0xff, 0xff, 0xff, 0xaf, 0x26, 0x0c, 0x31, 0xd5, 0xff, 0xff, 0xff,
+  0xff, 0x07, 0x3a, 0x26, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x31, 0xd7, 0xff,
+  0xff, 0xff, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x26, 0x30, 0x31,
+  0xc2, 0xff, 0xff, 0xff, 0xff, 0x0d, 0x1c, 0x26, 0xc0, 0x11, 0x31, 0xd4,
+  0x38, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x41,
+  0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x50, 0x31, 0xd4, 0xff, 0xff, 0xff,
+  0xff, 0x42, 0x26, 0x10, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff,
+  0xff, 0xf4, 0x3e, 0x31, 0xff, 0xff, 0xff, 0xff, 0x22, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xbe, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x1d, 0x31, 0xd2,
+  0x28, 0x10, 0x26, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x31, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x26, 0x2d, 0x3f, 0x31,
+  0xd5, 0x0d, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xcb, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x4b, 0x31, 0xd5, 0xff, 0xff,
+  0xff, 0xff, 0x3b, 0x24, 0x26, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x31, 0xde,
+  0xff, 0xff, 0xff, 0xff, 0xc1, 0x26, 0x1f, 0x31, 0xdb, 0xff, 0xff, 0xff,
+  0xff, 0xc0, 0x26, 0xff, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xef, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0x95, 0x31, 0xfd, 0xd8, 0x29, 0x26, 0xc0, 0x10, 0xff, 0xff, 0xff, 0xff,
+  0xd5, 0xff, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff, 0xff, 0x09, 0xff,
+  0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0x6a, 0xff, 0xff, 0xff,
+  0xff, 0xf6, 0x26, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x14, 0x31, 0xd1, 0x33,
+  0xff, 0xff, 0xff, 0xff, 0xd6, 0x26, 0x24, 0xff, 0xff, 0xff, 0xff, 0x73,
+  0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0xff, 0x08, 0xff, 0xff,
+  0xff, 0xff, 0x3f, 0x37, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xc0, 0x15, 0x31, 0xd3, 0x35, 0x26, 0xc0, 0x05, 0x31, 0xd8,
+  0x2e, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x00, 0xff, 0xff, 0xff, 0xff, 0x4a,
+  0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0x0e, 0xff, 0xff,
+  0xff, 0xff, 0x0b, 0xff, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xff,
+  0x9a, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x93, 0x31, 0xd6, 0xff, 0xff,
+  0xff, 0xff, 0xc5, 0x26, 0x24, 0xff, 0xff, 0xff, 0xff, 0x63, 0x2e, 0xff,
+  0xff, 0xff, 0xff, 0x01, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x26,
+  0x10, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x1e, 0x09,
+  0xff, 0xff, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xff, 0xff,
+  0xff, 0xff, 0xe9, 0x26, 0xc0, 0x11, 0x31, 0xd4, 0xff, 0xff, 0xff, 0xff,
+  0x1b, 0x10, 0x26, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x26, 0x20, 0x33, 0x31,
+  0xd4, 0xff, 0xff, 0xff, 0xff, 0x0a, 0x2f, 0x26, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xb2, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x26, 0xc0, 0x11,
+  0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xeb,
+  0x26, 0x14, 0xff, 0xff, 0xff, 0xff, 0x05, 0x31, 0xc1, 0xff, 0xff, 0xff,
+  0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xd7, 0x35, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x26, 0xc1, 0xff,
+  0xff, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0x03, 0x31, 0xd4, 0xff,
+  0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xff, 0x09, 0x31, 0xde, 0xff, 0xff,
+  0xff, 0xff, 0xc0, 0x26, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x26, 0x39, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0x94, 0x31, 0xfd, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x68, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x7a, 0x10, 0x26, 0xc3, 0xff, 0xff, 0xff,
+  0xff, 0xe8, 0xff, 0xff, 0xff, 0xff, 0x2b, 0x31, 0xd3, 0xff, 0xff, 0xff,
+  0xff, 0x26, 0x08, 0x26, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff,
+  0xff, 0xff, 0x74, 0x26, 0xc0, 0x15, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff,
+  0x0c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x31, 0xd8, 0xff, 0xff,
+  0xff, 0xff, 0x18, 0x26, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x35, 0x31,
+  0xd6, 0xff, 0xff, 0xff, 0xff, 0x45, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x26,
+  0xc4, 0x25, 0x31, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x36, 0xff, 0xff, 0xff,
+  0xff, 0xf6, 0x26, 0xc3, 0x29, 0x21, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x60, 0x31, 0xd5, 0x3a, 0x26, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x96, 0x31,
+  0xd6, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x69, 0x31, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0xa3, 0x31, 0xd1, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff,
+  0xff, 0xff, 0xc7, 0x26, 0x01, 0xff, 0xff, 0xff, 0xff, 0x21, 0x31, 0xc3,
+  0xff, 0xff, 0xff, 0xff, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xa8, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff, 0x44, 0x26,
+  0xc1, 0xff, 0xff, 0xff, 0xff, 0x87, 0x31, 0xd5, 0xff, 0xff, 0xff, 0xff,
+  0x38, 0x26, 0xc9, 0x19, 0x31, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0x00, 0xdb, 0xff,
+  0xff, 0xff, 0xff, 0xc0, 0x26, 0xff, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0xdb, 0x01, 0x26, 0x0d, 0x31, 0xfd, 0xd8, 0xff, 0xff,
+  0xff, 0xff, 0x68, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff,
+  0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x20, 0xff, 0xff, 0xff,
+  0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x14, 0x31, 0xd5, 0x37, 0xff, 0xff, 0xff, 0xff, 0x89, 0x04, 0xff, 0xff,
+  0xff, 0xff, 0xf7, 0x20, 0x03, 0xff, 0xff, 0xff, 0xff, 0x3d, 0x25, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0x15, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff,
+  0x0c, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x31, 0xd9, 0x0a, 0xff,
+  0xff, 0xff, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xff, 0xff, 0xff,
+  0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x24, 0xff, 0xff, 0xff, 0xff,
+  0xe3, 0xff, 0xff, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0xff, 0x56, 0xff,
+  0xff, 0xff, 0xff, 0x01, 0x31, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x39, 0xff,
+  0xff, 0xff, 0xff, 0xaa, 0x27, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x26, 0xc1,
+  0x25, 0x31, 0xd3, 0xff, 0xff, 0xff, 0xff, 0x32, 0xff, 0xff, 0xff, 0xff,
+  0xb2, 0xff, 0xff, 0xff, 0xff, 0xee, 0x19, 0xff, 0xff, 0xff, 0xff, 0xdd,
+  0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0x19, 0xff, 0xff,
+  0xff, 0xff, 0x28, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x60, 0x31, 0xd5,
+  0xff, 0xff, 0xff, 0xff, 0x5e, 0x26, 0xc1, 0x2f, 0x31, 0xd6, 0xff, 0xff,
+  0xff, 0xff, 0x8b, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x20, 0x31, 0xc1,
+  0xff, 0xff, 0xff, 0xff, 0x45, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x66,
+  0x31, 0xd1, 0x37, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x53, 0x31, 0xc5,
+  0xff, 0xff, 0xff, 0xff, 0x77, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x6d,
+  0x31, 0xd4, 0x3c, 0x30, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x27, 0x31,
+  0xd5, 0xff, 0xff, 0xff, 0xff, 0x38, 0x26, 0xc9, 0x19, 0x31, 0xd6, 0xff,
+  0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xcc, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0x00, 0xdb, 0x01, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0x93, 0x31, 0xfd, 0xd8, 0xff, 0xff, 0xff, 0xff, 0x68,
+  0x26, 0xc0, 0x11, 0x31, 0xe3, 0x25, 0x26, 0xc0, 0x15, 0x31, 0xfd, 0xfd,
+  0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xc3, 0x31, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xb9, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xd2, 0x31, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x26, 0x39, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x26, 0x2a,
+  0x31, 0xfd, 0xd8, 0x29, 0x26, 0xc0, 0x11, 0x31, 0xe3, 0x25, 0x26, 0xc0,
+  0x15, 0x31, 0xfd, 0xfd, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x3b, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x31, 0xfb, 0xff, 0xff, 0xff, 0xff,
+  0xa3, 0x26, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0x04,
+  0x31, 0xda, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x26, 0x39, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xda, 0xff, 0xff, 0xff, 0xff, 0x1e, 0x26, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x76, 0x31, 0xfd, 0xd8, 0x29, 0x26, 0xc0, 0x11, 0x31, 0xe3,
+  0x25, 0x26, 0xc0, 0x15, 0x31, 0xfd, 0xfd, 0xfd, 0xfb, 0xff, 0xff, 0xff,
+  0xff, 0xb4, 0x26, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff,
+  0x09, 0x31, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x26, 0xc0, 0x00, 0x3b,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0x31, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xc0,
+  0x26, 0x39, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd8, 0xff, 0xff, 0xff, 0xff,
+  0x05, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xad, 0x26,
+  0xc0, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x31, 0xfd, 0xd8, 0xff, 0xff, 0xff,
+  0xff, 0x68, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x11, 0x31, 0xe3, 0x25,
+  0x26, 0xc0, 0x15, 0x31, 0xfd, 0xfd, 0xfd, 0xf9, 0xff, 0xff, 0xff, 0xff,
+  0x14, 0xff, 0xff, 0xff, 0xff, 0x83, 0x26, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x81, 0x31, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0xff,
+  0xe4, 0x26, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x31, 0xd7, 0xff, 0xff,
+  0xff, 0xff, 0xc0, 0x26, 0xff, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x26, 0xc2, 0xff, 0xff,
+  0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0x01, 0x31, 0xfd, 0xd8, 0x29,
+  0x26, 0xc0, 0x11, 0x31, 0xe3, 0x25, 0x26, 0xc0, 0x15, 0x31, 0xfd, 0xfd,
+  0xfd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x7c, 0x26, 0xc2, 0xff, 0xff, 0xff,
+  0xff, 0xce, 0xff, 0xff, 0xff, 0xff, 0x08, 0x31, 0xfd, 0x04, 0x2a, 0xff,
+  0xff, 0xff, 0xff, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
+  0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x31, 0xd7, 0xff, 0xff, 0xff,
+  0xff, 0xc0, 0x26, 0xff, 0xff, 0xff, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0xd7, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff,
+  0xeb, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff,
+  0xff, 0xff, 0xff, 0x0c, 0x31, 0xfd, 0xd9, 0x29, 0x26, 0xc0, 0x11, 0x31,
+  0xe3, 0x25, 0x26, 0xc0, 0x15, 0x31, 0xfd, 0xfd, 0xfd, 0xf7, 0x05, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xfd, 0x27, 0x16, 0xff, 0xff, 0xff, 0xff, 0x0d,
+  0x31, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x26, 0x39, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xcb,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0x26, 0x39, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01,
+};
+
+} // namespace
+
+constinit const EmbeddedImage Images::Squares{squares_qoi};
+constinit const EmbeddedImage Images::Ascii{ascii_qoi};
+
+} // namespace sdl
@@ -5,6 +5,8 @@
 
 #include "key_code.hpp"
 
+#include "bee/time.hpp"
+
 namespace sdl {
 
 enum class KeyAction {
@@ -40,6 +42,8 @@ struct EventKind {
     MouseScroll,
   };
 
+  static constexpr int num_values = MouseScroll + 1;
+
   EventKind(Value v) : _v(v) {}
 
   operator Value() const { return _v; }
@@ -89,6 +93,8 @@ struct Event {
   struct MouseMotionEvent {
     int x;
     int y;
+    int xrel;
+    int yrel;
     EventKind kind() const { return EventKind::MouseMotion; }
   };
 
@@ -99,6 +105,7 @@ struct Event {
   };
 
   template <class T>
+    requires(!std::is_same_v<std::decay_t<T>, Event>)
   Event(T&& v)
       : _v(std::forward<T>(v)),
         _kind(std::visit([](const auto& e) { return e.kind(); }, _v))
@@ -109,8 +116,20 @@ struct Event {
     return std::visit(f, _v);
   }
 
+  template <class F> constexpr auto visit(F&& f) { return std::visit(f, _v); }
+
+  template <class T> const T* get_if() const { return std::get_if<T>(&_v); }
+
+  template <class T> T* get_if() { return std::get_if<T>(&_v); }
+
   EventKind kind() const { return _kind; }
 
+  // Monotonic time at which the event was taken off the SDL queue. When events
+  // get coalesced the merged event keeps the timestamp of the earliest one.
+  const bee::Time& timestamp() const { return _timestamp; }
+
+  void set_timestamp(const bee::Time& timestamp) { _timestamp = timestamp; }
+
  private:
   std::variant<
     QuitEvent,
@@ -121,6 +140,8 @@ struct Event {
     _v;
 
   EventKind _kind;
+
+  bee::Time _timestamp;
 };
 
 } // namespace sdl
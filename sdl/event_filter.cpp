@@ -0,0 +1,62 @@
+#include "event_filter.hpp"
+
+namespace sdl {
+
+EventFilter::EventFilter() { _modes.fill(FilterMode::Pass); }
+
+EventFilter::~EventFilter() {}
+
+void EventFilter::set_mode(EventKind kind, FilterMode mode)
+{
+  _modes.at(kind) = mode;
+}
+
+FilterMode EventFilter::mode(EventKind kind) const { return _modes.at(kind); }
+
+bool EventFilter::accept(const Event& event)
+{
+  if (mode(event.kind()) == FilterMode::Drop) {
+    _stats.dropped++;
+    return false;
+  }
+  return true;
+}
+
+bool EventFilter::merge(Event& acc, const Event& next)
+{
+  if (acc.kind() != next.kind()) { return false; }
+  if (mode(acc.kind()) != FilterMode::Coalesce) { return false; }
+
+  bool merged = false;
+  switch (acc.kind()) {
+  case EventKind::Quit:
+    merged = true;
+    break;
+  case EventKind::MouseMotion: {
+    auto a = acc.get_if<Event::MouseMotionEvent>();
+    auto n = next.get_if<Event::MouseMotionEvent>();
+    a->x = n->x;
+    a->y = n->y;
+    a->xrel += n->xrel;
+    a->yrel += n->yrel;
+    merged = true;
+  } break;
+  case EventKind::MouseScroll: {
+    auto a = acc.get_if<Event::MouseScrollEvent>();
+    auto n = next.get_if<Event::MouseScrollEvent>();
+    a->x += n->x;
+    a->y += n->y;
+    merged = true;
+  } break;
+  case EventKind::Keyboard:
+  case EventKind::MouseButton:
+    break;
+  }
+
+  if (merged) { _stats.merged++; }
+  return merged;
+}
+
+void EventFilter::reset_stats() { _stats = Stats{}; }
+
+} // namespace sdl
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "event.hpp"
+
+namespace sdl {
+
+enum class FilterMode {
+  Pass,
+  Coalesce,
+  Drop,
+};
+
+struct EventFilter {
+ public:
+  struct Stats {
+    int64_t merged = 0;
+    int64_t dropped = 0;
+  };
+
+  EventFilter();
+  ~EventFilter();
+
+  void set_mode(EventKind kind, FilterMode mode);
+  FilterMode mode(EventKind kind) const;
+
+  // Returns false if the event should be discarded, in which case it is
+  // counted as dropped.
+  bool accept(const Event& event);
+
+  // Folds `next` into `acc` if both are of the same kind and that kind is set
+  // to coalesce. Motion events keep the last absolute position and the summed
+  // relative delta, scroll events sum their deltas. Button and keyboard events
+  // are never merged since every transition matters.
+  bool merge(Event& acc, const Event& next);
+
+  const Stats& stats() const { return _stats; }
+
+  void reset_stats();
+
+ private:
+  std::array<FilterMode, EventKind::num_values> _modes;
+
+  Stats _stats;
+};
+
+} // namespace sdl
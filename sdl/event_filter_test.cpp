@@ -0,0 +1,85 @@
+#include "event_filter.hpp"
+
+#include <vector>
+
+#include "bee/testing.hpp"
+
+using std::vector;
+
+namespace sdl {
+namespace {
+
+void print_event(const Event& event)
+{
+  event.visit([]<class T>(const T& e) {
+    if constexpr (std::is_same_v<T, Event::MouseMotionEvent>) {
+      P("motion pos:($, $) rel:($, $)", e.x, e.y, e.xrel, e.yrel);
+    } else if constexpr (std::is_same_v<T, Event::MouseScrollEvent>) {
+      P("scroll ($, $)", e.x, e.y);
+    } else {
+      P("$", e.kind());
+    }
+  });
+}
+
+vector<Event> run_filter(EventFilter& filter, const vector<Event>& events)
+{
+  vector<Event> output;
+  for (const auto& event : events) {
+    if (!filter.accept(event)) { continue; }
+    if (!output.empty() && filter.merge(output.back(), event)) { continue; }
+    output.push_back(event);
+  }
+  return output;
+}
+
+vector<Event> sample_events()
+{
+  return {
+    Event::MouseMotionEvent{.x = 10, .y = 10, .xrel = 1, .yrel = 0},
+    Event::MouseMotionEvent{.x = 12, .y = 11, .xrel = 2, .yrel = 1},
+    Event::MouseMotionEvent{.x = 15, .y = 9, .xrel = 3, .yrel = -2},
+    Event::MouseScrollEvent{.x = 0, .y = 1},
+    Event::MouseScrollEvent{.x = 0, .y = 1},
+    Event::MouseButtonEvent{
+      .action = MouseButtonAction::ButtonDown,
+      .button = MouseButton::Left,
+      .x = 15,
+      .y = 9},
+    Event::MouseMotionEvent{.x = 16, .y = 9, .xrel = 1, .yrel = 0},
+    Event::MouseMotionEvent{.x = 20, .y = 5, .xrel = 4, .yrel = -4},
+  };
+}
+
+TEST(pass_through)
+{
+  EventFilter filter;
+  for (const auto& event : run_filter(filter, sample_events())) {
+    print_event(event);
+  }
+  P("merged:$ dropped:$", filter.stats().merged, filter.stats().dropped);
+}
+
+TEST(coalesce_motion)
+{
+  EventFilter filter;
+  filter.set_mode(EventKind::MouseMotion, FilterMode::Coalesce);
+  for (const auto& event : run_filter(filter, sample_events())) {
+    print_event(event);
+  }
+  P("merged:$ dropped:$", filter.stats().merged, filter.stats().dropped);
+}
+
+TEST(coalesce_and_drop)
+{
+  EventFilter filter;
+  filter.set_mode(EventKind::MouseMotion, FilterMode::Drop);
+  filter.set_mode(EventKind::MouseScroll, FilterMode::Coalesce);
+  for (const auto& event : run_filter(filter, sample_events())) {
+    print_event(event);
+  }
+  P("merged:$ dropped:$", filter.stats().merged, filter.stats().dropped);
+}
+
+} // namespace
+} // namespace sdl
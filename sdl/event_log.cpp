@@ -0,0 +1,193 @@
+#include "event_log.hpp"
+
+#include <string_view>
+
+using std::string;
+using std::string_view;
+using std::vector;
+
+namespace sdl {
+
+namespace {
+
+constexpr string_view magic = "SDLEVLOG";
+constexpr uint8_t version = 1;
+
+uint64_t zigzag(int64_t v) { return (uint64_t(v) << 1) ^ uint64_t(v >> 63); }
+
+int64_t unzigzag(uint64_t v) { return int64_t(v >> 1) ^ -int64_t(v & 1); }
+
+struct Encoder {
+ public:
+  Encoder(string& out) : _out(out) {}
+
+  void put_u8(uint8_t v) { _out.push_back(char(v)); }
+
+  void put_varint(uint64_t v)
+  {
+    while (v >= 0x80) {
+      _out.push_back(char(v | 0x80));
+      v >>= 7;
+    }
+    _out.push_back(char(v));
+  }
+
+  void put_int(int64_t v) { put_varint(zigzag(v)); }
+
+ private:
+  string& _out;
+};
+
+struct Decoder {
+ public:
+  Decoder(string_view data) : _data(data) {}
+
+  bool at_end() const { return _pos == _data.size(); }
+
+  bee::OrError<uint8_t> get_u8()
+  {
+    if (at_end()) { return EF("Event log truncated at offset $", _pos); }
+    return uint8_t(_data[_pos++]);
+  }
+
+  bee::OrError<uint64_t> get_varint()
+  {
+    uint64_t v = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      bail(byte, get_u8());
+      v |= uint64_t(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) { return v; }
+    }
+    return EF("Malformed varint in event log at offset $", _pos);
+  }
+
+  bee::OrError<int> get_int()
+  {
+    bail(v, get_varint());
+    return int(unzigzag(v));
+  }
+
+  template <class E> bee::OrError<E> get_enum(int num_values)
+  {
+    bail(v, get_u8());
+    if (v >= num_values) {
+      return EF("Invalid enum value $ in event log at offset $", v, _pos);
+    }
+    return E(v);
+  }
+
+ private:
+  string_view _data;
+  size_t _pos = 0;
+};
+
+void encode_event(Encoder& enc, const Event& event)
+{
+  enc.put_u8(uint8_t(event.kind()));
+  event.visit([&]<class T>(const T& e) {
+    if constexpr (std::is_same_v<T, Event::QuitEvent>) {
+    } else if constexpr (std::is_same_v<T, Event::KeyboardEvent>) {
+      enc.put_u8(uint8_t(e.action));
+      enc.put_u8(uint8_t(e.key));
+      enc.put_u8(e.repeat);
+    } else if constexpr (std::is_same_v<T, Event::MouseButtonEvent>) {
+      enc.put_u8(uint8_t(e.action));
+      enc.put_u8(uint8_t(e.button));
+      enc.put_int(e.x);
+      enc.put_int(e.y);
+    } else if constexpr (std::is_same_v<T, Event::MouseMotionEvent>) {
+      enc.put_int(e.x);
+      enc.put_int(e.y);
+      enc.put_int(e.xrel);
+      enc.put_int(e.yrel);
+    } else if constexpr (std::is_same_v<T, Event::MouseScrollEvent>) {
+      enc.put_int(e.x);
+      enc.put_int(e.y);
+    }
+  });
+}
+
+bee::OrError<Event> decode_event(Decoder& dec)
+{
+  bail(kind, dec.get_u8());
+  switch (kind) {
+  case EventKind::Quit:
+    return Event::QuitEvent{};
+  case EventKind::Keyboard: {
+    bail(action, dec.get_enum<KeyAction>(2));
+    bail(key, dec.get_enum<KeyCode>(int(KeyCode::Other) + 1));
+    bail(repeat, dec.get_u8());
+    return Event::KeyboardEvent{
+      .action = action, .key = key, .repeat = repeat != 0};
+  }
+  case EventKind::MouseButton: {
+    bail(action, dec.get_enum<MouseButtonAction>(2));
+    bail(button, dec.get_enum<MouseButton>(int(MouseButton::X2) + 1));
+    bail(x, dec.get_int());
+    bail(y, dec.get_int());
+    return Event::MouseButtonEvent{
+      .action = action, .button = button, .x = x, .y = y};
+  }
+  case EventKind::MouseMotion: {
+    bail(x, dec.get_int());
+    bail(y, dec.get_int());
+    bail(xrel, dec.get_int());
+    bail(yrel, dec.get_int());
+    return Event::MouseMotionEvent{.x = x, .y = y, .xrel = xrel, .yrel = yrel};
+  }
+  case EventKind::MouseScroll: {
+    bail(x, dec.get_int());
+    bail(y, dec.get_int());
+    return Event::MouseScrollEvent{.x = x, .y = y};
+  }
+  }
+  return EF("Invalid event kind $ in event log", kind);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+// EventLogWriter
+//
+
+EventLogWriter::EventLogWriter()
+{
+  _data.append(magic);
+  Encoder(_data).put_u8(version);
+}
+
+EventLogWriter::~EventLogWriter() {}
+
+void EventLogWriter::append(int64_t tick, const Event& event)
+{
+  assert(tick >= _last_tick);
+  Encoder enc(_data);
+  enc.put_varint(tick - _last_tick);
+  encode_event(enc, event);
+  _last_tick = tick;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// decode_event_log
+//
+
+bee::OrError<vector<EventLogEntry>> decode_event_log(const string& data)
+{
+  string_view view = data;
+  if (!view.starts_with(magic)) { return EF("Not an event log"); }
+  Decoder dec(view.substr(magic.size()));
+  bail(v, dec.get_u8());
+  if (v != version) { return EF("Unsupported event log version $", v); }
+
+  vector<EventLogEntry> entries;
+  int64_t tick = 0;
+  while (!dec.at_end()) {
+    bail(delta, dec.get_varint());
+    tick += delta;
+    bail(event, decode_event(dec));
+    entries.push_back({.tick = tick, .event = std::move(event)});
+  }
+  return entries;
+}
+
+} // namespace sdl
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "event.hpp"
+
+#include "bee/or_error.hpp"
+
+namespace sdl {
+
+// Compact binary encoding of an event stream tagged with tick indices. Every
+// entry is stored as a varint tick delta, a kind byte and the event fields as
+// zigzag varints, so a typical input event takes 2 to 8 bytes. Timestamps are
+// not stored, replayed events are stamped when they are polled.
+
+struct EventLogEntry {
+  int64_t tick;
+  Event event;
+};
+
+struct EventLogWriter {
+ public:
+  EventLogWriter();
+  ~EventLogWriter();
+
+  void append(int64_t tick, const Event& event);
+
+  const std::string& data() const { return _data; }
+
+ private:
+  std::string _data;
+  int64_t _last_tick = 0;
+};
+
+bee::OrError<std::vector<EventLogEntry>> decode_event_log(
+  const std::string& data);
+
+} // namespace sdl
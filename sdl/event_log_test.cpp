@@ -0,0 +1,82 @@
+#include "event_log.hpp"
+
+#include "bee/testing.hpp"
+
+namespace sdl {
+namespace {
+
+void print_entry(const EventLogEntry& entry)
+{
+  entry.event.visit([&]<class T>(const T& e) {
+    if constexpr (std::is_same_v<T, Event::KeyboardEvent>) {
+      P("tick:$ key:$ down:$ repeat:$",
+        entry.tick,
+        int(e.key),
+        e.action == KeyAction::KeyDown,
+        e.repeat);
+    } else if constexpr (std::is_same_v<T, Event::MouseButtonEvent>) {
+      P("tick:$ button:$ down:$ pos:($, $)",
+        entry.tick,
+        int(e.button),
+        e.action == MouseButtonAction::ButtonDown,
+        e.x,
+        e.y);
+    } else if constexpr (std::is_same_v<T, Event::MouseMotionEvent>) {
+      P("tick:$ motion pos:($, $) rel:($, $)",
+        entry.tick,
+        e.x,
+        e.y,
+        e.xrel,
+        e.yrel);
+    } else if constexpr (std::is_same_v<T, Event::MouseScrollEvent>) {
+      P("tick:$ scroll ($, $)", entry.tick, e.x, e.y);
+    } else {
+      P("tick:$ $", entry.tick, e.kind());
+    }
+  });
+}
+
+TEST(round_trip)
+{
+  EventLogWriter writer;
+  writer.append(
+    0,
+    Event::KeyboardEvent{
+      .action = KeyAction::KeyDown, .key = KeyCode::Enter, .repeat = false});
+  writer.append(
+    3,
+    Event::MouseMotionEvent{.x = 1200, .y = 900, .xrel = -3, .yrel = 40});
+  writer.append(
+    3,
+    Event::MouseButtonEvent{
+      .action = MouseButtonAction::ButtonUp,
+      .button = MouseButton::Right,
+      .x = 1200,
+      .y = 900});
+  writer.append(250, Event::MouseScrollEvent{.x = 0, .y = -1});
+  writer.append(
+    251,
+    Event::KeyboardEvent{
+      .action = KeyAction::KeyUp, .key = KeyCode::Z, .repeat = true});
+  writer.append(100000, Event::QuitEvent{});
+  P("encoded size: $", writer.data().size());
+
+  must(entries, decode_event_log(writer.data()));
+  for (const auto& entry : entries) { print_entry(entry); }
+}
+
+TEST(malformed)
+{
+  P("garbage: is_error:$", decode_event_log("garbage").is_error());
+  EventLogWriter writer;
+  writer.append(
+    10,
+    Event::MouseMotionEvent{.x = 1200, .y = 900, .xrel = -3, .yrel = 40});
+  auto data = writer.data();
+  auto truncated = data.substr(0, data.size() - 1);
+  P("truncated: is_error:$", decode_event_log(truncated).is_error());
+  P("complete: is_error:$", decode_event_log(data).is_error());
+}
+
+} // namespace
+} // namespace sdl
@@ -0,0 +1,68 @@
+#include "event_replay.hpp"
+
+#include "bee/file_reader.hpp"
+#include "bee/file_writer.hpp"
+#include "bee/time.hpp"
+
+using std::optional;
+
+namespace sdl {
+
+////////////////////////////////////////////////////////////////////////////////
+// EventRecorder
+//
+
+EventRecorder::EventRecorder(EventSource& source) : _source(source) {}
+
+EventRecorder::~EventRecorder() {}
+
+bee::OrError<optional<Event>> EventRecorder::poll_event(
+  const optional<bee::Span>& timeout)
+{
+  bail(event, _source.poll_event(timeout));
+  if (event.has_value()) { _writer.append(_tick, *event); }
+  return event;
+}
+
+void EventRecorder::begin_tick(int64_t tick)
+{
+  _tick = tick;
+  _source.begin_tick(tick);
+}
+
+void EventRecorder::wake() { _source.wake(); }
+
+bee::OrError<> EventRecorder::save(const bee::FilePath& path) const
+{
+  return bee::FileWriter::save_file(path, _writer.data());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// EventReplayer
+//
+
+EventReplayer::EventReplayer(std::vector<EventLogEntry>&& entries)
+    : _entries(std::move(entries))
+{}
+
+EventReplayer::~EventReplayer() {}
+
+bee::OrError<EventReplayer::ptr> EventReplayer::load(const bee::FilePath& path)
+{
+  bail(data, bee::FileReader::read_file(path));
+  bail(entries, decode_event_log(data));
+  return std::make_unique<EventReplayer>(std::move(entries));
+}
+
+bee::OrError<optional<Event>> EventReplayer::poll_event(
+  const optional<bee::Span>&)
+{
+  if (finished() || _entries[_next].tick > _tick) { return std::nullopt; }
+  auto event = _entries[_next++].event;
+  event.set_timestamp(bee::Time::monotonic());
+  return event;
+}
+
+void EventReplayer::begin_tick(int64_t tick) { _tick = tick; }
+
+} // namespace sdl
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "event_log.hpp"
+#include "event_source.hpp"
+
+#include "bee/file_path.hpp"
+#include "bee/or_error.hpp"
+
+namespace sdl {
+
+// Forwards events from another source and records them, tagged with the tick
+// they were polled in.
+struct EventRecorder final : public EventSource {
+ public:
+  using ptr = std::unique_ptr<EventRecorder>;
+
+  EventRecorder(EventSource& source);
+  virtual ~EventRecorder();
+
+  virtual bee::OrError<std::optional<Event>> poll_event(
+    const std::optional<bee::Span>& timeout = std::nullopt) override;
+
+  virtual void begin_tick(int64_t tick) override;
+
+  virtual void wake() override;
+
+  bee::OrError<> save(const bee::FilePath& path) const;
+
+ private:
+  EventSource& _source;
+  EventLogWriter _writer;
+  int64_t _tick = 0;
+};
+
+// Plays back a recorded event stream. Each tick only returns the events that
+// were recorded for it, and never waits, so a session can be replayed as fast
+// as the game loop runs.
+struct EventReplayer final : public EventSource {
+ public:
+  using ptr = std::unique_ptr<EventReplayer>;
+
+  EventReplayer(std::vector<EventLogEntry>&& entries);
+  virtual ~EventReplayer();
+
+  static bee::OrError<ptr> load(const bee::FilePath& path);
+
+  virtual bee::OrError<std::optional<Event>> poll_event(
+    const std::optional<bee::Span>& timeout = std::nullopt) override;
+
+  virtual void begin_tick(int64_t tick) override;
+
+  bool finished() const { return _next == _entries.size(); }
+
+ private:
+  std::vector<EventLogEntry> _entries;
+  size_t _next = 0;
+  int64_t _tick = 0;
+};
+
+} // namespace sdl
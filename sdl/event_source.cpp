@@ -0,0 +1,11 @@
+#include "event_source.hpp"
+
+namespace sdl {
+
+EventSource::~EventSource() {}
+
+void EventSource::begin_tick(int64_t) {}
+
+void EventSource::wake() {}
+
+} // namespace sdl
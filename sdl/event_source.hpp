@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "event.hpp"
+
+#include "bee/or_error.hpp"
+#include "bee/span.hpp"
+
+namespace sdl {
+
+struct EventSource {
+ public:
+  virtual ~EventSource();
+
+  // Returns the next pending event, or nullopt if there is none. When a
+  // timeout is given, waits up to that long for the first event.
+  virtual bee::OrError<std::optional<Event>> poll_event(
+    const std::optional<bee::Span>& timeout = std::nullopt) = 0;
+
+  // Called by the game loop before polling the events of each tick. Sources
+  // that record or replay input use it to line events up with ticks.
+  virtual void begin_tick(int64_t tick);
+
+  // Makes a poll_event waiting on another thread return early, without an
+  // event. Can be called from any thread.
+  virtual void wake();
+};
+
+} // namespace sdl
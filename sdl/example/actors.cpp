@@ -0,0 +1,100 @@
+#include "actors.hpp"
+
+#include <algorithm>
+#include <random>
+
+using std::vector;
+
+namespace sdl::example {
+
+namespace {
+
+constexpr double gravity_accel = 1.0;
+constexpr double max_fall_speed = 30.0;
+constexpr double hop_speed = -18.0;
+
+// Actors that fall off the level are removed once they get this far below
+// where they were spawned
+constexpr double fall_limit = 10000.0;
+
+// Actors moved by each job when the tick is split
+constexpr size_t actors_per_job = 1024;
+
+} // namespace
+
+Actors::Actors(const vec2d& center, int count)
+{
+  std::mt19937 rng(count);
+  std::uniform_real_distribution<double> offset_x(-800.0, 800.0);
+  std::uniform_real_distribution<double> offset_y(-600.0, -50.0);
+  std::uniform_real_distribution<double> speed_x(-6.0, 6.0);
+  std::uniform_int_distribution<int> size(4, 12);
+
+  _storage.reserve(count);
+  for (int i = 0; i < count; i++) {
+    _storage.spawn(
+      {center + vec2d{offset_x(rng), offset_y(rng)}},
+      {{speed_x(rng), 0}},
+      {{size(rng), size(rng)}});
+  }
+  _fall_limit_y = center.y + fall_limit;
+}
+
+Actors::~Actors() {}
+
+void Actors::tick(const LevelController& level, JobSystem* jobs)
+{
+  // Actors only read the level, so any split of them can move in parallel
+  if (jobs != nullptr) {
+    jobs->parallel_for(
+      0, _storage.size(), actors_per_job, [&](size_t begin, size_t end) {
+        _move(level, begin, end);
+      });
+  } else {
+    _move(level, 0, _storage.size());
+  }
+
+  _fallen.clear();
+  auto positions = _storage.column<Position>();
+  for (size_t i = 0; i < _storage.size(); i++) {
+    if (positions[i].value.y > _fall_limit_y) {
+      _fallen.push_back(_storage.entity_at(i));
+    }
+  }
+  for (auto entity : _fallen) { _storage.despawn(entity); }
+}
+
+void Actors::_move(const LevelController& level, size_t begin, size_t end)
+{
+  auto positions = _storage.column<Position>();
+  auto velocities = _storage.column<Velocity>();
+  auto sizes = _storage.column<BodySize>();
+
+  for (size_t i = begin; i < end; i++) {
+    auto& pos = positions[i].value;
+    auto& vel = velocities[i].value;
+    const auto& size = sizes[i].value;
+
+    vel.y = std::min(max_fall_speed, vel.y + gravity_accel);
+    if (level.move_rect(Axis::Y, vel.y, pos, size) == Dir::Down) {
+      vel.y = hop_speed;
+    }
+
+    // Turn around when running into a wall
+    double speed_x = vel.x;
+    if (level.move_rect(Axis::X, speed_x, pos, size).has_value()) {
+      vel.x = -vel.x;
+    }
+  }
+}
+
+void Actors::collect_visible(const Recti& view, vector<Recti>& rects) const
+{
+  _storage.each<Position, BodySize>(
+    [&](const Position& pos, const BodySize& size) {
+      Recti rect{pos.value.cast<int>(), size.value};
+      if (rect.intersect(view)) { rects.push_back(rect); }
+    });
+}
+
+} // namespace sdl::example
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <vector>
+
+#include "level_controller.hpp"
+
+#include "sdl/ecs.hpp"
+#include "sdl/job_system.hpp"
+#include "sdl/rect.hpp"
+#include "sdl/vec2.hpp"
+
+namespace sdl::example {
+
+struct Position {
+  vec2d value;
+};
+
+struct Velocity {
+  vec2d value;
+};
+
+struct BodySize {
+  vec2i value;
+};
+
+// Non player actors that hop around the level. They collide with the level
+// but not with each other or the player.
+struct Actors {
+ public:
+  using Storage = Archetype<Position, Velocity, BodySize>;
+
+  // Spawns `count` actors scattered above `center`
+  Actors(const vec2d& center, int count);
+  ~Actors();
+
+  // Physics system, split across `jobs` when given
+  void tick(const LevelController& level, JobSystem* jobs = nullptr);
+
+  // Render system, appends the rects of the actors overlapping `view`
+  void collect_visible(const Recti& view, std::vector<Recti>& rects) const;
+
+  size_t size() const { return _storage.size(); }
+
+ private:
+  void _move(const LevelController& level, size_t begin, size_t end);
+
+  Storage _storage;
+
+  double _fall_limit_y;
+
+  std::vector<Entity> _fallen;
+};
+
+} // namespace sdl::example
@@ -0,0 +1,117 @@
+#include "assets.hpp"
+
+#include <filesystem>
+#include <string>
+
+#include "bee/file_reader.hpp"
+#include "bee/print.hpp"
+#include "sdl/qoi.hpp"
+#include "sdl/raw_image.hpp"
+#include "yasf/cof.hpp"
+
+namespace sdl::example {
+
+namespace {
+
+const bee::FilePath level_filename("level.cof");
+
+constexpr char squares_name[] = "squares";
+
+constexpr char font_name[] = "font";
+
+bee::OrError<RawImage> read_qoi(const bee::FilePath& path)
+{
+  bail(data, bee::FileReader::read_file(path));
+  bail(
+    img,
+    qoi_decode({reinterpret_cast<const uint8_t*>(data.data()), data.size()}));
+  return RawImage(img.width, img.height, img.channels, std::move(img.pixels));
+}
+
+} // namespace
+
+bee::FilePath Assets::_loose_image(const char* name) const
+{
+  return bee::FilePath(_hot_reload->dir.to_string() + "/" + name + ".qoi");
+}
+
+TextureHandle Assets::load_block_texture(TextureLoader& textures) const
+{
+  if (_hot_reload.has_value()) {
+    auto path = _loose_image(squares_name);
+    if (std::filesystem::exists(path.to_string())) {
+      return textures.load([path]() { return read_qoi(path); });
+    }
+  }
+  if (_pack != nullptr && _pack->find(squares_name).has_value()) {
+    return textures.load(*_pack, squares_name);
+  }
+  return textures.load(Images::Squares);
+}
+
+FileWatcher::Watch Assets::watch_block_texture(
+  TextureLoader& textures, const TextureHandle& handle) const
+{
+  if (!_hot_reload.has_value()) { return {}; }
+  auto watch = _hot_reload->watcher->watch(
+    _loose_image(squares_name),
+    [&textures, handle](const bee::FilePath& path) {
+      P("Reloading $", path.to_string());
+      textures.reload(handle, [path]() { return read_qoi(path); });
+    });
+  if (watch.is_error()) {
+    PE("Not watching block texture: $", watch.error());
+    return {};
+  }
+  return std::move(watch.value());
+}
+
+bee::OrError<Font::ptr> Assets::load_font(int size) const
+{
+  if (_pack != nullptr && _pack->find(font_name).has_value()) {
+    bail(data, _pack->blob(font_name, AssetKind::Font));
+    return Font::create_from_memory(font_name, data, size);
+  }
+  return Font::create(size);
+}
+
+bee::OrError<Level> Assets::load_level() const
+{
+  auto level = yasf::Cof::deserialize_file<Level>(level_filename);
+  if (level.is_error() && _pack != nullptr &&
+      _pack->find(level_filename.to_string()).has_value()) {
+    bail(data, _pack->blob(level_filename.to_string(), AssetKind::Data));
+    return yasf::Cof::deserialize<Level>(
+      std::string(reinterpret_cast<const char*>(data.data()), data.size()));
+  }
+  return level;
+}
+
+bee::OrError<> Assets::save_level(const Level& level) const
+{
+  return yasf::Cof::serialize_file(level_filename, level);
+}
+
+FileWatcher::Watch Assets::watch_level(
+  std::function<void(Level&&)>&& on_reload) const
+{
+  if (!_hot_reload.has_value()) { return {}; }
+  auto watch = _hot_reload->watcher->watch(
+    level_filename,
+    [on_reload = std::move(on_reload)](const bee::FilePath& path) {
+      auto level = yasf::Cof::deserialize_file<Level>(path);
+      if (level.is_error()) {
+        PE("Failed to reload level: $", level.error());
+        return;
+      }
+      P("Reloading $", path.to_string());
+      on_reload(std::move(level.value()));
+    });
+  if (watch.is_error()) {
+    PE("Not watching level: $", watch.error());
+    return {};
+  }
+  return std::move(watch.value());
+}
+
+} // namespace sdl::example
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+
+#include "level.hpp"
+
+#include "bee/file_path.hpp"
+#include "bee/or_error.hpp"
+#include "sdl/asset_pack.hpp"
+#include "sdl/file_watcher.hpp"
+#include "sdl/font.hpp"
+#include "sdl/texture_loader.hpp"
+
+namespace sdl::example {
+
+// Where the game gets its assets from. With a pack, entries in it are used
+// in place. Without one, or for entries it lacks, the images compiled into
+// the binary, a system font and level.cof in the working directory are used
+// instead.
+struct Assets {
+ public:
+  // Images are read from loose files in `dir` before anything else, and
+  // those files and the level are reloaded when they change
+  struct HotReload {
+    bee::FilePath dir;
+    FileWatcher* watcher;
+  };
+
+  explicit Assets(
+    const AssetPack* pack,
+    const std::optional<HotReload>& hot_reload = std::nullopt)
+      : _pack(pack), _hot_reload(hot_reload)
+  {}
+
+  TextureHandle load_block_texture(TextureLoader& textures) const;
+
+  // Reloads the texture while the watch is alive. Without hot reloading the
+  // watch is empty.
+  FileWatcher::Watch watch_block_texture(
+    TextureLoader& textures, const TextureHandle& handle) const;
+
+  // Needs TTF::init, reads the pack's "font" entry in place
+  bee::OrError<Font::ptr> load_font(int size) const;
+
+  // A level saved by the editor takes precedence over the one in the pack
+  bee::OrError<Level> load_level() const;
+
+  bee::OrError<> save_level(const Level& level) const;
+
+  // Calls `on_reload` on the watcher thread with the parsed level whenever
+  // level.cof changes
+  FileWatcher::Watch watch_level(
+    std::function<void(Level&&)>&& on_reload) const;
+
+ private:
+  bee::FilePath _loose_image(const char* name) const;
+
+  const AssetPack* _pack;
+  std::optional<HotReload> _hot_reload;
+};
+
+} // namespace sdl::example
@@ -47,6 +47,11 @@ struct Controller {
 
   virtual void tick() = 0;
 
+  // When false, the game loop only ticks and renders again once an event
+  // arrives or it is woken up, so a screen that only changes in response to
+  // input should return false whenever nothing is animating
+  virtual bool needs_continuous_frames() const = 0;
+
   virtual bee::OrError<> render(Renderer& ren) = 0;
 };
 
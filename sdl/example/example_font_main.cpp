@@ -1,6 +1,11 @@
+#include <utility>
 #include <variant>
 
+#include "assets.hpp"
+
+#include "bee/file_path.hpp"
 #include "bee/print.hpp"
+#include "sdl/asset_pack.hpp"
 #include "sdl/font.hpp"
 #include "sdl/renderer.hpp"
 #include "sdl/sdl_context.hpp"
@@ -8,14 +13,21 @@
 
 namespace sdl::example {
 
-void main()
+// Takes an optional asset pack, whose "font" entry is used instead of a
+// system font
+void main(int argc, char* argv[])
 {
+  AssetPack::ptr pack;
+  if (argc > 1) {
+    must(opened, AssetPack::open(bee::FilePath(argv[1])));
+    pack = std::move(opened);
+  }
   must(ctx, SDLContext::create());
   must(win, Window::create(*ctx, "Example Game", {800, 600}));
   must(ren, Renderer::create(*win, {.blend_mode = BlendMode::Add}));
 
   must_unit(TTF::init());
-  must(font, Font::create(48));
+  must(font, Assets(pack.get()).load_font(48));
   P("Chosen font: $", font->info());
   must(texture, font->render_text(*ren, "Hello world!"));
 
@@ -24,7 +36,7 @@ void main()
     must_unit(ren->clear());
     must_unit(
       ren->fill_rect(*texture, (ren->viewport().size - texture->size()) / 2));
-    ren->present();
+    must_unit(ren->present());
 
     while (true) {
       must(event, ctx->poll_event());
@@ -36,8 +48,8 @@ void main()
 
 } // namespace sdl::example
 
-int main()
+int main(int argc, char* argv[])
 {
-  sdl::example::main();
+  sdl::example::main(argc, argv);
   return 0;
 }
@@ -0,0 +1,40 @@
+#include "frame_stats.hpp"
+
+#include <algorithm>
+
+#include "bee/print.hpp"
+
+namespace sdl::example {
+
+FrameStats::FrameStats() : _start(bee::Time::monotonic()), _last(_start) {}
+
+FrameStats::~FrameStats() {}
+
+void FrameStats::end_frame()
+{
+  auto now = bee::Time::monotonic();
+  _frame_times.push_back(now - _last);
+  _last = now;
+}
+
+void FrameStats::print() const
+{
+  if (_frame_times.empty()) { return; }
+
+  auto sorted = _frame_times;
+  std::sort(sorted.begin(), sorted.end());
+  auto percentile = [&](int p) {
+    return sorted.at((sorted.size() - 1) * p / 100);
+  };
+
+  bee::Span total = _last - _start;
+  double ticks_per_sec = sorted.size() / total.to_float_seconds();
+  P("Ticks: $ in $ ($ ticks/sec)", sorted.size(), total, ticks_per_sec);
+  P("Frame time: avg:$ p50:$ p99:$ max:$",
+    total / sorted.size(),
+    percentile(50),
+    percentile(99),
+    sorted.back());
+}
+
+} // namespace sdl::example
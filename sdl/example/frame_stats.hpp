@@ -0,0 +1,28 @@
+#pragma once
+
+#include <vector>
+
+#include "bee/span.hpp"
+#include "bee/time.hpp"
+
+namespace sdl::example {
+
+// Collects per frame timings of a run, used to report the throughput of
+// benchmark and replay sessions.
+struct FrameStats {
+ public:
+  FrameStats();
+  ~FrameStats();
+
+  // Marks the end of a frame, the first frame is measured from construction
+  void end_frame();
+
+  void print() const;
+
+ private:
+  bee::Time _start;
+  bee::Time _last;
+  std::vector<bee::Span> _frame_times;
+};
+
+} // namespace sdl::example
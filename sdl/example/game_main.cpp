@@ -1,17 +1,36 @@
+#include <algorithm>
+#include <charconv>
 #include <memory>
+#include <string>
+#include <utility>
 
+#include "assets.hpp"
 #include "controller.hpp"
+#include "frame_stats.hpp"
 #include "in_game.hpp"
 #include "level_editor.hpp"
 #include "menu.hpp"
 
+#include "bee/file_path.hpp"
 #include "bee/or_error.hpp"
 #include "bee/print.hpp"
+#include "bee/span.hpp"
+#include "bee/time.hpp"
+#include "sdl/asset_pack.hpp"
+#include "sdl/event_replay.hpp"
+#include "sdl/event_source.hpp"
+#include "sdl/file_watcher.hpp"
+#include "sdl/input_thread.hpp"
+#include "sdl/job_system.hpp"
 #include "sdl/renderer.hpp"
+#include "sdl/resolution_scaler.hpp"
 #include "sdl/sdl_context.hpp"
+#include "sdl/texture_loader.hpp"
 #include "sdl/window.hpp"
 
 using std::make_unique;
+using std::optional;
+using std::string;
 using std::unique_ptr;
 using std::vector;
 
@@ -19,16 +38,250 @@ namespace sdl::example {
 
 namespace {
 
+struct Options {
+  bool input_thread = false;
+
+  bool threaded_simulation = false;
+
+  int actor_count = 0;
+
+  // Worker threads for the job system, none when zero
+  int jobs = 0;
+
+  // VSync unless there is a frame budget
+  PresentMode present_mode = PresentMode::VSync;
+
+  // Frame rate cap, none when zero
+  int fps = 0;
+
+  // Lowers the resolution when frames take longer than this to draw, and
+  // raises it back when they are well within it. Presents with Immediate,
+  // since with VSync the measured work time leaves out the GPU and a lower
+  // resolution never looks faster.
+  optional<int> frame_budget_ms;
+
+  // Fixed resolution the scene is drawn at before being scaled up by a whole
+  // factor, for crisp pixels
+  optional<vec2i> internal_size;
+
+  // Estimated video memory textures may use before some are evicted
+  int texture_budget_mb = 256;
+
+  // Asset pack built with pack_assets
+  optional<bee::FilePath> pack;
+
+  // Directory of loose images that take precedence over the pack and are
+  // reloaded, along with the level, when they change
+  optional<bee::FilePath> hot_reload;
+
+  // Saves the input of the session to this file on exit
+  optional<bee::FilePath> record;
+
+  // Replays a recorded session in a hidden window without vsync, then reports
+  // ticks/sec and frame times
+  optional<bee::FilePath> replay;
+
+  static bee::OrError<Options> parse(int argc, char* argv[])
+  {
+    Options options;
+    optional<PresentMode> present_mode;
+    for (int i = 1; i < argc; i++) {
+      string arg = argv[i];
+      auto value = [&]() -> bee::OrError<string> {
+        if (i + 1 >= argc) { return EF("Missing value for $", arg); }
+        return string(argv[++i]);
+      };
+      auto int_value = [&]() -> bee::OrError<int> {
+        bail(str, value());
+        int v;
+        const char* last = str.data() + str.size();
+        auto [end, ec] = std::from_chars(str.data(), last, v);
+        if (ec != std::errc() || end != last || v < 0) {
+          return EF("Invalid value for $: $", arg, str);
+        }
+        return v;
+      };
+      if (arg == "--input-thread") {
+        options.input_thread = true;
+      } else if (arg == "--threaded-sim") {
+        options.threaded_simulation = true;
+      } else if (arg == "--actors") {
+        bail_assign(options.actor_count, int_value());
+      } else if (arg == "--jobs") {
+        bail_assign(options.jobs, int_value());
+      } else if (arg == "--present-mode") {
+        bail(mode, value());
+        if (mode == "vsync") {
+          present_mode = PresentMode::VSync;
+        } else if (mode == "immediate") {
+          present_mode = PresentMode::Immediate;
+        } else if (mode == "adaptive") {
+          present_mode = PresentMode::Adaptive;
+        } else {
+          return EF("Invalid value for $: $", arg, mode);
+        }
+      } else if (arg == "--fps") {
+        bail_assign(options.fps, int_value());
+      } else if (arg == "--frame-budget-ms") {
+        bail_assign(options.frame_budget_ms, int_value());
+      } else if (arg == "--internal-size") {
+        bail(size, value());
+        int w = 0, h = 0;
+        auto x = size.find('x');
+        const char* sep = size.data() + std::min(x, size.size());
+        const char* end = size.data() + size.size();
+        bool valid = x != string::npos &&
+                     std::from_chars(size.data(), sep, w).ptr == sep &&
+                     std::from_chars(sep + 1, end, h).ptr == end;
+        if (!valid || w <= 0 || h <= 0) {
+          return EF("Invalid value for $, expected WxH: $", arg, size);
+        }
+        options.internal_size = vec2i{w, h};
+      } else if (arg == "--texture-budget-mb") {
+        bail_assign(options.texture_budget_mb, int_value());
+      } else if (arg == "--pack") {
+        bail(path, value());
+        options.pack = bee::FilePath(path);
+      } else if (arg == "--hot-reload") {
+        bail(path, value());
+        options.hot_reload = bee::FilePath(path);
+      } else if (arg == "--record") {
+        bail(path, value());
+        options.record = bee::FilePath(path);
+      } else if (arg == "--replay") {
+        bail(path, value());
+        options.replay = bee::FilePath(path);
+      } else {
+        return EF("Unknown argument: $", arg);
+      }
+    }
+    if (options.replay.has_value() &&
+        (options.record.has_value() || options.input_thread)) {
+      return EF("--replay can't be combined with --record or --input-thread");
+    }
+    if (options.frame_budget_ms.has_value()) {
+      if (present_mode.value_or(PresentMode::Immediate) !=
+          PresentMode::Immediate) {
+        return EF("--frame-budget-ms needs --present-mode immediate");
+      }
+      present_mode = PresentMode::Immediate;
+    }
+    options.present_mode = present_mode.value_or(PresentMode::VSync);
+    return options;
+  }
+};
+
+// How long the loop sleeps waiting for input when no controller needs frames.
+// Wake-ups cut it short, the bound only matters if one is missed.
+constexpr bee::Span idle_timeout = bee::Span::of_seconds(1);
+
+// Time between an input event being taken off the SDL queue and the frame
+// that reflects it being presented.
+struct LatencyStats {
+ public:
+  void add(const bee::Span& latency)
+  {
+    _total += latency;
+    _max = std::max(_max, latency);
+    _count++;
+  }
+
+  void print() const
+  {
+    if (_count == 0) { return; }
+    P("Input to present latency: avg:$ max:$ samples:$",
+      _total / _count,
+      _max,
+      _count);
+  }
+
+ private:
+  bee::Span _total = bee::Span::zero();
+  bee::Span _max = bee::Span::zero();
+  int64_t _count = 0;
+};
+
 struct Main {
  public:
   using ptr = std::unique_ptr<Main>;
 
-  static bee::OrError<ptr> create()
+  static bee::OrError<ptr> create(const Options& options)
   {
+    bool replaying = options.replay.has_value();
+
     bail(ctx, SDLContext::create());
-    bail(win, Window::create(*ctx, "Example Game", {2400, 1800}));
-    bail(ren, Renderer::create(*win, {.blend_mode = BlendMode::Add}));
-    return make_unique<Main>(std::move(ctx), std::move(win), std::move(ren));
+
+    // Controllers only care about the latest mouse position, so there is no
+    // point in dispatching every motion event a high rate mouse generates.
+    EventFilter filter;
+    filter.set_mode(EventKind::MouseMotion, FilterMode::Coalesce);
+    ctx->set_event_filter(std::move(filter));
+
+    bail(
+      win,
+      Window::create(
+        *ctx, "Example Game", {2400, 1800}, {.hidden = replaying}));
+    bail(
+      ren,
+      Renderer::create(
+        *win,
+        {
+          .blend_mode = BlendMode::Add,
+          .present_mode =
+            replaying ? PresentMode::Immediate : options.present_mode,
+          .target_fps = replaying ? 0 : options.fps,
+          .deferred = true,
+          .dynamic_resolution = options.frame_budget_ms.has_value(),
+          .internal_size = options.internal_size,
+        }));
+    auto main = make_unique<Main>(
+      std::move(ctx), std::move(win), std::move(ren), options);
+    bail_unit(main->_init_event_source(options));
+    if (options.pack.has_value()) {
+      bail_assign(main->_pack, AssetPack::open(*options.pack));
+    }
+    if (options.hot_reload.has_value()) {
+      bail_assign(main->_watcher, FileWatcher::create());
+    }
+    bail_assign(
+      main->_textures,
+      TextureLoader::create(
+        *main->_ren,
+        main->_jobs.get(),
+        {
+          .upload = {},
+          .max_resident_bytes = size_t(options.texture_budget_mb) << 20,
+          .on_ready = [source = main->_source]() { source->wake(); },
+        }));
+    return main;
+  }
+
+  bee::OrError<> _init_event_source(const Options& options)
+  {
+    _source = _ctx.get();
+    if (options.input_thread) {
+      bail_assign(_input, InputThread::create(*_ctx));
+      _source = _input.get();
+    }
+    if (options.record.has_value()) {
+      _recorder = make_unique<EventRecorder>(*_source);
+      _record_path = options.record;
+      _source = _recorder.get();
+    }
+    if (options.replay.has_value()) {
+      bail_assign(_replayer, EventReplayer::load(*options.replay));
+      _source = _replayer.get();
+    }
+    return bee::ok();
+  }
+
+  Assets _assets() const
+  {
+    optional<Assets::HotReload> hot_reload;
+    if (_watcher != nullptr) {
+      hot_reload = {.dir = *_options.hot_reload, .watcher = _watcher.get()};
+    }
+    return Assets(_pack.get(), hot_reload);
   }
 
   void _handle_status(const ControllerStatus::Exit&) { _running = false; }
@@ -36,14 +289,22 @@ struct Main {
 
   void _handle_status(ControllerStatus::StartGame& event)
   {
-    push_controller(InGame::create(std::move(event.level)));
+    push_controller(InGame::create(
+      std::move(event.level),
+      *_textures,
+      _assets(),
+      {
+        .threaded_simulation = _options.threaded_simulation,
+        .actor_count = _options.actor_count,
+        .jobs = _jobs.get(),
+      }));
   }
 
   void _handle_status(const ControllerStatus::Back&) { pop_controller(); }
 
   void _handle_status(const ControllerStatus::StartLevelEditor&)
   {
-    push_controller(LevelEditor::create());
+    push_controller(LevelEditor::create(*_textures, _assets()));
   }
 
   void push_controller(Controller::ptr&& controller)
@@ -61,24 +322,71 @@ struct Main {
 
   bee::OrError<> render()
   {
+    bail_unit(_textures->upload_pending());
     bail_unit(_ren->clear());
     bail_unit(_controller->render(*_ren));
-    _ren->present();
+    bail_unit(_ren->present());
+    if (_scaler.has_value()) {
+      _ren->set_resolution_scale(
+        _scaler->add_frame(_ren->frame_work_time()));
+    }
     return bee::ok();
   }
 
   void tick() { _controller->tick(); }
 
+  // Mouse events come in window coordinates, controllers work in viewport
+  // coordinates
+  void _to_viewport(Event& event) const
+  {
+    if (auto button = event.get_if<Event::MouseButtonEvent>()) {
+      auto pos = _ren->window_to_viewport({button->x, button->y});
+      button->x = pos.x;
+      button->y = pos.y;
+    } else if (auto motion = event.get_if<Event::MouseMotionEvent>()) {
+      auto pos = _ren->window_to_viewport({motion->x, motion->y});
+      auto prev = _ren->window_to_viewport(
+        {motion->x - motion->xrel, motion->y - motion->yrel});
+      *motion = {
+        .x = pos.x,
+        .y = pos.y,
+        .xrel = pos.x - prev.x,
+        .yrel = pos.y - prev.y,
+      };
+    }
+  }
+
+  // Frames are only drawn back to back while something is changing on its
+  // own, otherwise the loop blocks until input or a wake-up
+  optional<bee::Span> _wait_timeout() const
+  {
+    if (_controller->needs_continuous_frames() || _textures->pending() > 0) {
+      return std::nullopt;
+    }
+    return idle_timeout;
+  }
+
   bee::OrError<> main_loop()
   {
-    while (_running) {
+    for (int64_t tick_index = 0; _running; tick_index++) {
+      _source->begin_tick(tick_index);
       vector<ControllerStatus> queue;
+      optional<bee::Time> oldest_event;
+      auto timeout = _wait_timeout();
+      bool idled = timeout.has_value();
       while (true) {
-        bail(event, _ctx->poll_event());
+        bail(event, _source->poll_event(std::exchange(timeout, std::nullopt)));
         if (!event.has_value()) { break; }
+        if (!oldest_event.has_value()) { oldest_event = event->timestamp(); }
+        _to_viewport(*event);
         auto result = _controller->handle_event(*event);
         queue.push_back(std::move(result));
       }
+      // The frame after an idle wait starts a new schedule rather than
+      // counting as late by the length of the wait
+      if (idled) {
+        if (auto limiter = _ren->frame_limiter()) { limiter->reset(); }
+      }
 
       for (auto& event : queue) {
         event.visit([this](auto&& result) { _handle_status(result); });
@@ -86,23 +394,99 @@ struct Main {
 
       tick();
       bail_unit(render());
+      _frame_stats.end_frame();
+
+      if (oldest_event.has_value()) {
+        _latency.add(bee::Time::monotonic() - *oldest_event);
+      }
+
+      if (_replayer != nullptr && _replayer->finished()) { _running = false; }
+    }
+
+    if (_recorder != nullptr) { bail_unit(_recorder->save(*_record_path)); }
+
+    if (_replayer != nullptr) {
+      _frame_stats.print();
+      const auto& textures = _textures->stats();
+      P("Textures: resident:$ ($ KiB) hits:$ misses:$ evictions:$",
+        textures.resident,
+        textures.resident_bytes / 1024,
+        textures.hits,
+        textures.misses,
+        textures.evictions);
+    } else {
+      _latency.print();
+    }
+
+    if (_scaler.has_value()) {
+      P("Resolution scale: final:$% decreases:$ increases:$",
+        int(_scaler->scale() * 100),
+        _scaler->decreases(),
+        _scaler->increases());
+    }
+
+    if (auto limiter = _ren->frame_limiter()) {
+      const auto& stats = limiter->stats();
+      P("Frame limiter: frames:$ missed:$ max_late:$",
+        stats.frames,
+        stats.missed,
+        stats.max_late);
     }
 
     return bee::ok();
   }
 
-  Main(SDLContext::ptr&& ctx, Window::ptr&& win, Renderer::ptr&& ren)
-      : _ctx(std::move(ctx)),
+  Main(
+    SDLContext::ptr&& ctx,
+    Window::ptr&& win,
+    Renderer::ptr&& ren,
+    const Options& options)
+      : _options(options),
+        _ctx(std::move(ctx)),
         _win(std::move(win)),
         _ren(std::move(ren)),
+        _jobs(options.jobs > 0 ? JobSystem::create(options.jobs) : nullptr),
         _controller(Menu::create())
-  {}
+  {
+    if (options.frame_budget_ms.has_value()) {
+      _scaler.emplace(ResolutionScaler::Options{
+        .budget = bee::Span::of_millis(*options.frame_budget_ms),
+      });
+    }
+  }
 
  private:
+  Options _options;
+
   SDLContext::ptr _ctx;
   Window::ptr _win;
   Renderer::ptr _ren;
 
+  // Outlives the controllers that schedule work on it
+  JobSystem::ptr _jobs;
+
+  // Textures may still be uploading from the pack, so it outlives the loader
+  AssetPack::ptr _pack;
+
+  // Outlives the controllers holding watches on it
+  FileWatcher::ptr _watcher;
+
+  // Must be destroyed before the context it pumps events from
+  InputThread::ptr _input;
+  EventRecorder::ptr _recorder;
+  optional<bee::FilePath> _record_path;
+  EventReplayer::ptr _replayer;
+
+  EventSource* _source = nullptr;
+
+  // Wakes the event source from worker threads, so it goes first
+  TextureLoader::ptr _textures;
+
+  optional<ResolutionScaler> _scaler;
+
+  LatencyStats _latency;
+  FrameStats _frame_stats;
+
   bool _running = true;
 
   Controller::ptr _controller;
@@ -112,17 +496,18 @@ struct Main {
 
 } // namespace
 
-bee::OrError<> run()
+bee::OrError<> run(int argc, char* argv[])
 {
-  bail(main, Main::create());
+  bail(options, Options::parse(argc, argv));
+  bail(main, Main::create(options));
   return main->main_loop();
 }
 
 } // namespace sdl::example
 
-int main()
+int main(int argc, char* argv[])
 {
-  auto ret = sdl::example::run();
+  auto ret = sdl::example::run(argc, argv);
   if (ret.is_error()) {
     PE(ret.error());
     return EXIT_FAILURE;
@@ -1,17 +1,29 @@
 #include "in_game.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
 #include <optional>
+#include <thread>
+#include <utility>
 #include <vector>
 
+#include "actors.hpp"
 #include "constants.hpp"
 #include "controller.hpp"
+#include "level_controller.hpp"
 
+#include "bee/span.hpp"
 #include "bee/time.hpp"
 #include "sdl/event.hpp"
+#include "sdl/file_watcher.hpp"
 #include "sdl/key_mapping.hpp"
 #include "sdl/rect.hpp"
+#include "sdl/spsc_queue.hpp"
 #include "sdl/texture.hpp"
+#include "sdl/texture_loader.hpp"
+#include "sdl/triple_buffer.hpp"
 
 using bee::Time;
 using std::clamp;
@@ -36,6 +48,7 @@ enum class PlayerAction {
 
 enum class GeneralAction {
   Exit,
+  ToggleDebugOverlay,
 };
 
 struct Action {
@@ -64,6 +77,7 @@ struct InGameKeyMapping {
   InGameKeyMapping()
   {
     _map.add(Action(GeneralAction::Exit), {KeyCode::Escape, KeyCode::Q});
+    _map.add(Action(GeneralAction::ToggleDebugOverlay), {KeyCode::B});
     _map.add(Action(PlayerAction::MoveUp), {KeyCode::Up, KeyCode::W});
     _map.add(Action(PlayerAction::MoveLeft), {KeyCode::Left, KeyCode::A});
     _map.add(Action(PlayerAction::MoveDown), {KeyCode::Down, KeyCode::S});
@@ -80,48 +94,6 @@ struct InGameKeyMapping {
   KeyMapping<Action> _map;
 };
 
-struct LevelController {
- public:
-  LevelController(vector<Recti>&& blocks) : _blocks(std::move(blocks)) {}
-
-  ~LevelController() {}
-
-  const vector<Recti> blocks() const { return _blocks; }
-
-  optional<Dir> move_rect(
-    Axis axis, double& speed, vec2d& pos, const vec2i& rect_size) const
-  {
-    vec2d target = pos;
-    target.get(axis) += speed;
-
-    Recti initial_rect{pos.cast<int>(), rect_size};
-
-    optional<Dir> intersect_dir;
-    for (const auto& block : _blocks) {
-      // Was already intersecting, don't know what to do
-      if (block.intersect(initial_rect)) { continue; }
-      if (block.intersect({target.cast<int>(), rect_size})) {
-        if (speed > 0) {
-          target.get(axis) = block.pos.get(axis) - rect_size.get(axis);
-          intersect_dir = axis_dir(axis, true);
-        } else {
-          target.get(axis) = block.pos.get(axis) + block.size.get(axis);
-          intersect_dir = axis_dir(axis, false);
-        }
-      }
-    }
-
-    if (intersect_dir.has_value()) { speed = 0; }
-
-    pos = target;
-
-    return intersect_dir;
-  };
-
- private:
-  vector<Recti> _blocks;
-};
-
 struct JumpController {
  public:
   static constexpr int jump_ticks = 20;
@@ -264,12 +236,10 @@ struct ViewController {
   ViewController() {}
   ~ViewController() {}
 
-  void update(const Recti& player_rect, Renderer& ren)
+  void update(const Recti& player_rect, const vec2i& window_size)
   {
     const int border = 200;
 
-    auto viewport = ren.viewport();
-    auto& window_size = viewport.size;
     auto& player_pos = player_rect.pos;
 
     if (player_pos.x - _view_offset.x >= window_size.x - border) {
@@ -285,46 +255,309 @@ struct ViewController {
     if (player_pos.y - _view_offset.y <= border) {
       _view_offset.y = player_pos.y - border;
     }
-
-    ren.set_view(_view_offset);
-    ren.set_zoom(1.0);
   }
 
+  const vec2f& view_offset() const { return _view_offset; }
+
  private:
   vec2f _view_offset = {0, 0};
 };
 
+struct PlayerInput {
+  PlayerAction action;
+  bool activated;
+};
+
+// Everything needed to draw a frame. Once published by the simulation it is
+// never modified, so it can be drawn while the next tick runs.
+struct GameSnapshot {
+  Recti player_rect;
+  vec2f view_offset;
+  vector<Recti> visible_blocks;
+  vector<Recti> visible_actors;
+};
+
+// Holds a level reloaded on the file watcher thread until the thread running
+// the simulation picks it up
+struct LevelMailbox {
+ public:
+  void post(LevelController&& level)
+  {
+    std::lock_guard lock(_mutex);
+    _level.emplace(std::move(level));
+    _has_level.store(true, std::memory_order_release);
+  }
+
+  // Checked every tick, so the common empty case doesn't lock
+  optional<LevelController> take()
+  {
+    if (!_has_level.load(std::memory_order_acquire)) { return std::nullopt; }
+    std::lock_guard lock(_mutex);
+    _has_level.store(false, std::memory_order_relaxed);
+    return std::exchange(_level, std::nullopt);
+  }
+
+ private:
+  std::mutex _mutex;
+  optional<LevelController> _level;
+  std::atomic<bool> _has_level = false;
+};
+
+struct GameSimulation {
+ public:
+  GameSimulation(optional<Level>& level, const InGame::Options& options)
+      : _player_controller(get_player_initial_position(level)),
+        _level(make_level_controller(level)),
+        _actors(get_player_initial_position(level), options.actor_count),
+        _jobs(options.jobs)
+  {}
+
+  void handle_input(const PlayerInput& input)
+  {
+    _player_controller.handle_event(input.action, input.activated);
+  }
+
+  // Swaps the blocks under the player and actors, who stay where they are
+  void set_level(LevelController&& level) { _level = std::move(level); }
+
+  void tick()
+  {
+    _player_controller.tick(_level);
+    _actors.tick(_level, _jobs);
+  }
+
+  void fill_snapshot(const vec2i& viewport_size, GameSnapshot& snapshot)
+  {
+    auto player_rect = _player_controller.rect();
+    _view_controller.update(player_rect, viewport_size);
+
+    snapshot.player_rect = player_rect;
+    snapshot.view_offset = _view_controller.view_offset();
+
+    // Pad by a pixel to account for the truncation of the view offset
+    Recti view{snapshot.view_offset.cast<int>() - 1, viewport_size + 2};
+    snapshot.visible_blocks.clear();
+    for (const auto& block : _level.blocks()) {
+      if (block.intersect(view)) { snapshot.visible_blocks.push_back(block); }
+    }
+    snapshot.visible_actors.clear();
+    _actors.collect_visible(view, snapshot.visible_actors);
+  }
+
+ private:
+  static LevelController make_level_controller(optional<Level>& level)
+  {
+    if (level.has_value()) {
+      return LevelController(std::move(level->blocks));
+    } else {
+      return LevelController(
+        {{
+           .pos = {0, 800},
+           .size = {800 * 2, 800 * 2},
+         },
+         {
+           .pos = {1200, 500},
+           .size = {100, 100},
+         },
+         {
+           .pos = {300, 700},
+           .size = {100, 100},
+         }});
+    }
+  }
+
+  static vec2d get_player_initial_position(optional<Level>& level)
+  {
+    if (level.has_value()) {
+      return level->player_initial_pos.cast<double>();
+    } else {
+      return {0, 0};
+    }
+  }
+
+  PlayerController _player_controller;
+
+  ViewController _view_controller;
+
+  LevelController _level;
+
+  Actors _actors;
+
+  JobSystem* _jobs;
+};
+
+// Runs the simulation at a fixed rate on its own thread. Input flows in
+// through a lock-free queue and snapshots flow out through a triple buffer,
+// so a long tick never delays presenting a frame and vice versa.
+struct SimulationThread {
+ public:
+  using ptr = std::unique_ptr<SimulationThread>;
+
+  static constexpr bee::Span tick_period = bee::Span::of_micros(16667);
+
+  SimulationThread(
+    GameSimulation&& sim, const vec2i& viewport_size, LevelMailbox& levels)
+      : _sim(std::move(sim)),
+        _inputs(1024),
+        _viewport_size(viewport_size),
+        _levels(levels)
+  {
+    _sim.fill_snapshot(viewport_size, _snapshots.back());
+    _snapshots.publish();
+    _thread = std::jthread([this](std::stop_token stop) { _run(stop); });
+  }
+
+  ~SimulationThread()
+  {
+    _thread.request_stop();
+    if (_thread.joinable()) { _thread.join(); }
+  }
+
+  void push_input(const PlayerInput& input)
+  {
+    while (!_inputs.try_push(input)) { std::this_thread::yield(); }
+  }
+
+  void set_viewport_size(const vec2i& size)
+  {
+    _viewport_size.store(size, std::memory_order_relaxed);
+  }
+
+  const GameSnapshot& latest_snapshot()
+  {
+    _snapshots.consume();
+    return _snapshots.front();
+  }
+
+ private:
+  void _run(std::stop_token stop)
+  {
+    auto next_tick = Time::monotonic();
+    while (!stop.stop_requested()) {
+      while (auto input = _inputs.try_pop()) { _sim.handle_input(*input); }
+      if (auto level = _levels.take()) { _sim.set_level(std::move(*level)); }
+      _sim.tick();
+      _sim.fill_snapshot(
+        _viewport_size.load(std::memory_order_relaxed), _snapshots.back());
+      _snapshots.publish();
+
+      next_tick += tick_period;
+      auto remaining = next_tick - Time::monotonic();
+      if (remaining > bee::Span::zero()) {
+        std::this_thread::sleep_for(
+          std::chrono::nanoseconds(remaining.to_nanos()));
+      } else {
+        // Too far behind, don't try to catch up with a burst of ticks
+        next_tick = Time::monotonic();
+      }
+    }
+  }
+
+  GameSimulation _sim;
+
+  SpscQueue<PlayerInput> _inputs;
+
+  std::atomic<vec2i> _viewport_size;
+
+  LevelMailbox& _levels;
+
+  TripleBuffer<GameSnapshot> _snapshots;
+
+  std::jthread _thread;
+};
+
 struct InGameController : Controller {
  public:
   using ptr = std::unique_ptr<InGameController>;
 
-  virtual void tick() override { _player_controller.tick(_level); }
-
-  virtual bee::OrError<> render(Renderer& ren) override
+  virtual void tick() override
   {
-    if (_block_texture == nullptr) {
-      bail_assign(_block_texture, ren.create_texture(Images::Squares));
+    if (_sim_thread != nullptr) { return; }
+    if (auto level = _reloaded_levels.take()) {
+      _sim->set_level(std::move(*level));
     }
+    _sim->tick();
+  }
 
-    auto player_rect = _player_controller.rect();
+  virtual bool needs_continuous_frames() const override { return true; }
 
-    _view_controller.update(player_rect, ren);
+  bee::OrError<> draw_snapshot(Renderer& ren, const GameSnapshot& snapshot)
+  {
+    ren.set_view(snapshot.view_offset);
+    ren.set_zoom(1.0);
 
     const Color player_color = {.r = 255, .g = 255, .b = 255, .a = 255};
-    bail_unit(ren.fill_rect(player_color, player_rect));
+    bail_unit(ren.fill_rect(player_color, snapshot.player_rect));
 
-    // Color block_color = {.r = 255, .g = 50, .b = 50, .a = 255};
-    for (const auto& block : _level.blocks()) {
-      // bail_unit(ren.fill_rect(block_color, block));
-      bail_unit(ren.fill_rect(*_block_texture, block));
+    if (auto block_texture = _block_texture.get()) {
+      for (const auto& block : snapshot.visible_blocks) {
+        bail_unit(ren.fill_rect(*block_texture, block));
+      }
+    } else {
+      // Still loading
+      const Color placeholder = {.r = 66, .g = 66, .b = 66, .a = 255};
+      bail_unit(ren.fill_rects(placeholder, snapshot.visible_blocks));
     }
 
+    const Color actor_color = {.r = 255, .g = 200, .b = 64, .a = 255};
+    bail_unit(ren.fill_rects(actor_color, snapshot.visible_actors));
+
+    if (_show_debug_overlay) { bail_unit(draw_debug_overlay(ren, snapshot)); }
+
     return bee::ok();
   }
 
-  static ptr create(optional<Level>&& level)
+  // Collision boxes, drawn with one batched call regardless of block count
+  bee::OrError<> draw_debug_overlay(Renderer& ren, const GameSnapshot& snapshot)
   {
-    return make_unique<InGameController>(std::move(level));
+    const Color block_color = {.r = 255, .g = 0, .b = 0, .a = 96};
+    const Color player_top = {.r = 0, .g = 255, .b = 0, .a = 128};
+    const Color player_bottom = {.r = 0, .g = 0, .b = 255, .a = 128};
+
+    ren.set_layer(1);
+    bail_unit(ren.fill_rects(block_color, snapshot.visible_blocks));
+    GradientRect player{
+      .rect = snapshot.player_rect,
+      .top_left = player_top,
+      .top_right = player_top,
+      .bottom_right = player_bottom,
+      .bottom_left = player_bottom,
+    };
+    bail_unit(ren.fill_rects({&player, 1}));
+    ren.set_layer(0);
+
+    return bee::ok();
+  }
+
+  virtual bee::OrError<> render(Renderer& ren) override
+  {
+    auto viewport_size = ren.viewport().size;
+
+    if (!_threaded) {
+      _sim->fill_snapshot(viewport_size, _snapshot);
+      return draw_snapshot(ren, _snapshot);
+    }
+
+    // The simulation is handed over to its thread on the first frame, once
+    // the viewport size is known
+    if (_sim_thread == nullptr) {
+      _sim_thread = make_unique<SimulationThread>(
+        std::move(*_sim), viewport_size, _reloaded_levels);
+      _sim.reset();
+    } else {
+      _sim_thread->set_viewport_size(viewport_size);
+    }
+    return draw_snapshot(ren, _sim_thread->latest_snapshot());
+  }
+
+  static ptr create(
+    optional<Level>&& level,
+    TextureLoader& textures,
+    const Assets& assets,
+    const InGame::Options& options)
+  {
+    return make_unique<InGameController>(
+      std::move(level), textures, assets, options);
   }
 
   virtual ControllerStatus handle_event(const Event& event) override
@@ -337,6 +570,15 @@ struct InGameController : Controller {
     return ControllerStatus::Exit{};
   }
 
+  void _handle_player_input(const PlayerInput& input)
+  {
+    if (_sim_thread != nullptr) {
+      _sim_thread->push_input(input);
+    } else {
+      _sim->handle_input(input);
+    }
+  }
+
   ControllerStatus _handle_event(const Event::KeyboardEvent& event)
   {
     if (event.repeat) { return ControllerStatus::Continue{}; }
@@ -348,12 +590,15 @@ struct InGameController : Controller {
 
     return action->visit([&]<class T>(const T& action) -> ControllerStatus {
       if constexpr (std::is_same_v<T, PlayerAction>) {
-        _player_controller.handle_event(action, activated);
+        _handle_player_input({.action = action, .activated = activated});
         return ControllerStatus::Continue{};
       } else if constexpr (std::is_same_v<T, GeneralAction>) {
         switch (action) {
         case GeneralAction::Exit:
           return ControllerStatus::Back{};
+        case GeneralAction::ToggleDebugOverlay:
+          if (activated) { _show_debug_overlay = !_show_debug_overlay; }
+          return ControllerStatus::Continue{};
         }
       }
     });
@@ -374,61 +619,59 @@ struct InGameController : Controller {
     return ControllerStatus::Continue{};
   }
 
-  static LevelController make_level_controller(optional<Level>& level)
-  {
-    if (level.has_value()) {
-      return LevelController(std::move(level->blocks));
-    } else {
-      return LevelController(
-        {{
-           .pos = {0, 800},
-           .size = {800 * 2, 800 * 2},
-         },
-         {
-           .pos = {1200, 500},
-           .size = {100, 100},
-         },
-         {
-           .pos = {300, 700},
-           .size = {100, 100},
-         }});
-    }
-  }
-
-  static vec2d get_player_initial_position(optional<Level>& level)
-  {
-    if (level.has_value()) {
-      return level->player_initial_pos.cast<double>();
-    } else {
-      return {0, 0};
-    }
-  }
-
-  InGameController(optional<Level>&& level)
+  InGameController(
+    optional<Level>&& level,
+    TextureLoader& textures,
+    const Assets& assets,
+    const InGame::Options& options)
       : _start_time(Time::monotonic()),
-        _player_controller(get_player_initial_position(level)),
-        _level(make_level_controller(level))
+        _threaded(options.threaded_simulation),
+        _sim(std::in_place, level, options),
+        _block_texture(assets.load_block_texture(textures)),
+        _block_texture_watch(
+          assets.watch_block_texture(textures, _block_texture)),
+        _level_watch(assets.watch_level([this](Level&& level) {
+          // The collision index is built here, off the simulation thread
+          _reloaded_levels.post(LevelController(std::move(level.blocks)));
+        }))
   {}
 
  private:
   Time _start_time;
 
-  PlayerController _player_controller;
+  bool _threaded;
 
-  ViewController _view_controller;
+  bool _show_debug_overlay = false;
+
+  // Owned by the controller until the simulation thread takes it over
+  optional<GameSimulation> _sim;
+
+  LevelMailbox _reloaded_levels;
+
+  SimulationThread::ptr _sim_thread;
+
+  // Reused across frames when the simulation runs on this thread
+  GameSnapshot _snapshot;
 
   InGameKeyMapping _key_mapping;
 
-  LevelController _level;
+  TextureHandle _block_texture;
 
-  Texture::ptr _block_texture;
+  // Destroyed first, so no reload arrives while the rest is torn down
+  FileWatcher::Watch _block_texture_watch;
+  FileWatcher::Watch _level_watch;
 };
 
 } // namespace
 
-Controller::ptr InGame::create(optional<Level>&& level)
+Controller::ptr InGame::create(
+  optional<Level>&& level,
+  TextureLoader& textures,
+  const Assets& assets,
+  const Options& options)
 {
-  return InGameController::create(std::move(level));
+  return InGameController::create(
+    std::move(level), textures, assets, options);
 }
 
 } // namespace sdl::example
@@ -1,12 +1,32 @@
 #pragma once
 
+#include "assets.hpp"
 #include "controller.hpp"
 #include "level.hpp"
 
+#include "sdl/job_system.hpp"
+#include "sdl/texture_loader.hpp"
+
 namespace sdl::example {
 
 struct InGame {
-  static Controller::ptr create(std::optional<Level>&& level);
+  struct Options {
+    // Runs the simulation on its own thread at a fixed rate, decoupled from
+    // rendering
+    bool threaded_simulation = false;
+
+    // Number of non player actors to spawn
+    int actor_count = 0;
+
+    // When set, actor updates are split across its workers
+    JobSystem* jobs = nullptr;
+  };
+
+  static Controller::ptr create(
+    std::optional<Level>&& level,
+    TextureLoader& textures,
+    const Assets& assets,
+    const Options& options);
 };
 
 } // namespace sdl::example
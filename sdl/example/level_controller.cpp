@@ -0,0 +1,67 @@
+#include "level_controller.hpp"
+
+#include <cmath>
+
+using std::optional;
+using std::vector;
+
+namespace sdl::example {
+
+LevelController::LevelController(vector<Recti>&& blocks)
+    : _blocks(std::move(blocks)), _block_array(_blocks.begin(), _blocks.end())
+{}
+
+LevelController::~LevelController() {}
+
+optional<LevelController::Hit> LevelController::sweep(
+  const Rectd& rect, const vec2d& delta) const
+{
+  // Only blocks overlapping the area swept by the move can be hit
+  auto start = rect.pos;
+  auto end = rect.pos + delta;
+  vec2i min_corner{
+    int(std::floor(std::min(start.x, end.x))),
+    int(std::floor(std::min(start.y, end.y)))};
+  vec2i max_corner{
+    int(std::ceil(std::max(start.x, end.x) + rect.size.x)),
+    int(std::ceil(std::max(start.y, end.y) + rect.size.y))};
+  thread_local vector<uint32_t> candidates;
+  _block_array.intersect_indices(
+    Recti::of_corners(min_corner, max_corner), candidates);
+
+  optional<Hit> first;
+  for (uint32_t idx : candidates) {
+    auto hit = sweep_aabb(rect, delta, _blocks[idx].cast<double>());
+    if (hit.has_value() && (!first || hit->time < first->sweep.time)) {
+      first = Hit{.sweep = *hit, .block = idx};
+    }
+  }
+  return first;
+}
+
+optional<Dir> LevelController::move_rect(
+  Axis axis, double& speed, vec2d& pos, const vec2i& rect_size) const
+{
+  vec2d delta{0, 0};
+  delta.get(axis) = speed;
+
+  auto hit = sweep({pos, rect_size.cast<double>()}, delta);
+  if (!hit.has_value()) {
+    pos += delta;
+    return std::nullopt;
+  }
+
+  // Snap to the face that was hit rather than moving by time * speed, so the
+  // resting position is exact
+  const auto& block = _blocks[hit->block];
+  bool positive = speed > 0;
+  if (positive) {
+    pos.get(axis) = block.pos.get(axis) - rect_size.get(axis);
+  } else {
+    pos.get(axis) = block.pos.get(axis) + block.size.get(axis);
+  }
+  speed = 0;
+  return axis_dir(axis, positive);
+}
+
+} // namespace sdl::example
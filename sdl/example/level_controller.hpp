@@ -0,0 +1,43 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "sdl/rect.hpp"
+#include "sdl/rect_array.hpp"
+#include "sdl/swept_aabb.hpp"
+#include "sdl/vec2.hpp"
+
+namespace sdl::example {
+
+struct LevelController {
+ public:
+  struct Hit {
+    SweepHit sweep;
+    size_t block;
+  };
+
+  LevelController(std::vector<Recti>&& blocks);
+  ~LevelController();
+
+  LevelController(LevelController&& other) = default;
+  LevelController& operator=(LevelController&& other) = default;
+
+  const std::vector<Recti>& blocks() const { return _blocks; }
+
+  // Earliest block hit by `rect` moving by `delta`, the move can be diagonal.
+  // Queries are safe to run from several threads at once.
+  std::optional<Hit> sweep(const Rectd& rect, const vec2d& delta) const;
+
+  // Moves `pos` by `speed` along `axis`, stopping flush against the first
+  // block in the way however fast the move is. Returns the direction of the
+  // move when it was stopped.
+  std::optional<Dir> move_rect(
+    Axis axis, double& speed, vec2d& pos, const vec2i& rect_size) const;
+
+ private:
+  std::vector<Recti> _blocks;
+  RectArrayi _block_array;
+};
+
+} // namespace sdl::example
@@ -6,15 +6,18 @@
 #include <set>
 #include <vector>
 
+#include "assets.hpp"
 #include "constants.hpp"
 #include "controller.hpp"
 #include "level.hpp"
+#include "occupancy_map.hpp"
 
 #include "bee/file_reader.hpp"
 #include "bee/file_writer.hpp"
 #include "bee/print.hpp"
 #include "bee/time.hpp"
 #include "sdl/event.hpp"
+#include "sdl/file_watcher.hpp"
 #include "sdl/key_mapping.hpp"
 #include "sdl/rect.hpp"
 #include "sdl/texture.hpp"
@@ -118,25 +121,24 @@ Level create_level(const set<vec2i>& blocks, vec2i player_initial_pos)
   };
 }
 
-const bee::FilePath level_filename("level.cof");
-
-bee::OrError<Level> load_level()
-{
-  return yasf::Cof::deserialize_file<Level>(level_filename);
-}
-
-bee::OrError<> save_level(const Level& level)
-{
-  return yasf::Cof::serialize_file(level_filename, level);
-}
-
 struct LevelEditorController : Controller {
  public:
   static constexpr double zoom_speed = 1.02;
   static constexpr double scroll_zoom_speed = 1.1;
 
+  // Below this many pixels per block, the occupancy map is drawn instead of
+  // the blocks
+  static constexpr double lod_block_pixels = 4.0;
+
   virtual void tick() override {}
 
+  // The view only moves on its own while a zoom or move key is held
+  virtual bool needs_continuous_frames() const override
+  {
+    return _is_zooming_in || _is_zooming_out || _moving_up || _moving_down ||
+           _moving_left || _moving_right;
+  }
+
   vec2d project(const vec2d& v) const { return v * _zoom - _view_offset; }
 
   vec2d unproject(const vec2d& v) const { return (v + _view_offset) / _zoom; }
@@ -150,10 +152,6 @@ struct LevelEditorController : Controller {
 
   virtual bee::OrError<> render(Renderer& ren) override
   {
-    if (_block_texture == nullptr) {
-      bail_assign(_block_texture, ren.create_texture(Images::Squares));
-    }
-
     auto viewport = ren.viewport().size.cast<double>();
 
     double zoom_delta = 1.0;
@@ -181,11 +179,25 @@ struct LevelEditorController : Controller {
 
     ren.set_view(_view_offset.cast<float>());
 
-    for (const auto& block : _blocks) {
-      bail_unit(ren.fill_rect(
-        *_block_texture, {block * block_size, {block_size, block_size}}));
+    if (_zoom * block_size < lod_block_pixels && _occupancy.drawable()) {
+      bail_unit(_occupancy.draw(ren, block_size));
+    } else if (auto block_texture = _block_texture.get()) {
+      for (const auto& block : _blocks) {
+        bail_unit(ren.fill_rect(
+          *block_texture, {block * block_size, {block_size, block_size}}));
+      }
+    } else {
+      // Still loading
+      const Color placeholder = {.r = 66, .g = 66, .b = 66, .a = 255};
+      for (const auto& block : _blocks) {
+        bail_unit(ren.fill_rect(
+          placeholder, {block * block_size, {block_size, block_size}}));
+      }
     }
 
+    // Overlays must stay on top of the blocks
+    ren.set_layer(1);
+
     if (_player.has_value()) {
       const Color color = {.r = 255, .g = 255, .b = 255, .a = 255};
       Recti rect{.pos = *_player, .size = Constants::player_size};
@@ -206,9 +218,10 @@ struct LevelEditorController : Controller {
     return bee::ok();
   }
 
-  static Controller::ptr create()
+  static Controller::ptr create(TextureLoader& textures, const Assets& assets)
   {
-    return make_unique<LevelEditorController>(load_level().to_optional());
+    return make_unique<LevelEditorController>(
+      assets.load_level().to_optional(), textures, assets);
   }
 
   virtual ControllerStatus handle_event(const Event& event) override
@@ -295,25 +308,24 @@ struct LevelEditorController : Controller {
 
   void _handle_toggle_block()
   {
-    auto toggle = [this](const vec2i& v) {
-      auto it = _blocks.find(v);
-      if (it == _blocks.end()) {
-        _blocks.insert(v);
-      } else {
-        _blocks.erase(it);
-      }
-    };
-    for_each_in_selection(toggle);
+    for_each_in_selection(
+      [this](const vec2i& v) { _set_block(v, !_blocks.contains(v)); });
   }
 
   void _handle_add_block()
   {
-    for_each_in_selection([this](auto&& v) { _blocks.insert(v); });
+    for_each_in_selection([this](auto&& v) { _set_block(v, true); });
   }
 
   void _handle_remove_block()
   {
-    for_each_in_selection([this](auto&& v) { _blocks.erase(v); });
+    for_each_in_selection([this](auto&& v) { _set_block(v, false); });
+  }
+
+  void _set_block(const vec2i& v, bool filled)
+  {
+    bool changed = filled ? _blocks.insert(v).second : _blocks.erase(v) > 0;
+    if (changed) { _occupancy.set(v, filled); }
   }
 
   ControllerStatus _handle_play_level()
@@ -332,7 +344,7 @@ struct LevelEditorController : Controller {
   {
     if (_player.has_value()) {
       auto level = create_level(_blocks, *_player);
-      auto res = save_level(level);
+      auto res = _assets.save_level(level);
       if (res.is_error()) { PE("Failed to save level: $", res.error()); }
     }
   }
@@ -417,7 +429,14 @@ struct LevelEditorController : Controller {
     return ControllerStatus::Continue{};
   }
 
-  LevelEditorController(std::optional<Level>&& level)
+  LevelEditorController(
+    std::optional<Level>&& level,
+    TextureLoader& textures,
+    const Assets& assets)
+      : _assets(assets),
+        _block_texture(assets.load_block_texture(textures)),
+        _block_texture_watch(
+          assets.watch_block_texture(textures, _block_texture))
   {
     if (level.has_value()) {
       _player = level->player_initial_pos;
@@ -425,6 +444,7 @@ struct LevelEditorController : Controller {
         _blocks.insert(block.pos / block_size);
       }
     }
+    _occupancy.reset(_blocks);
   }
 
  private:
@@ -445,20 +465,28 @@ struct LevelEditorController : Controller {
 
   set<vec2i> _blocks;
 
+  // Stands in for _blocks when zoomed far out
+  OccupancyMap _occupancy;
+
   optional<vec2i> _selection_start;
 
   optional<vec2i> _player;
 
-  Texture::ptr _block_texture;
+  Assets _assets;
+
+  TextureHandle _block_texture;
 
   optional<vec2i> _mouse;
+
+  FileWatcher::Watch _block_texture_watch;
 };
 
 } // namespace
 
-Controller::ptr LevelEditor::create()
+Controller::ptr LevelEditor::create(
+  TextureLoader& textures, const Assets& assets)
 {
-  return LevelEditorController::create();
+  return LevelEditorController::create(textures, assets);
 }
 
 } // namespace sdl::example
@@ -1,11 +1,15 @@
 #pragma once
 
+#include "assets.hpp"
 #include "controller.hpp"
 
+#include "sdl/texture_loader.hpp"
+
 namespace sdl::example {
 
 struct LevelEditor {
-  static Controller::ptr create();
+  static Controller::ptr create(
+    TextureLoader& textures, const Assets& assets);
 };
 
 } // namespace sdl::example
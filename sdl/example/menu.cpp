@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <vector>
 
+#include "ui.hpp"
+
 #include "sdl/key_mapping.hpp"
 #include "sdl/text_writer.hpp"
 
@@ -31,13 +33,9 @@ struct MenuItem {
 
   const std::string& label() const { return _label; }
 
-  const Recti& rect() const { return _rect; }
-  Recti& rect() { return _rect; }
-
  private:
   string _label;
   MenuAction _action;
-  Recti _rect;
 };
 
 enum class InputAction {
@@ -78,8 +76,15 @@ struct MenuImpl : public Controller {
           MenuItem("Start", MenuAction::Start),
           MenuItem("Level Editor", MenuAction::LevelEditor),
           MenuItem("Exit", MenuAction::Exit),
+        }),
+        _buttons({
+          .width = menu_width,
+          .height = item_height,
+          .margin = margin,
         })
-  {}
+  {
+    for (const auto& item : _menu_items) { _buttons.add(item.label()); }
+  }
   virtual ~MenuImpl() {}
 
   ControllerStatus _handle_event(const Event::QuitEvent&)
@@ -90,11 +95,9 @@ struct MenuImpl : public Controller {
   ControllerStatus _handle_event(const Event::MouseButtonEvent& event)
   {
     if (event.action == MouseButtonAction::ButtonDown) {
-      vec2i pos = {event.x, event.y};
-      for (const auto& item : _menu_items) {
-        if (item.rect().contains(pos)) {
-          return _handle_menu_action(item.action());
-        }
+      auto hit = _buttons.hit_test({event.x, event.y});
+      if (hit.has_value()) {
+        return _handle_menu_action(_menu_items.at(*hit).action());
       }
     }
     return ControllerStatus::Continue{};
@@ -102,14 +105,8 @@ struct MenuImpl : public Controller {
 
   ControllerStatus _handle_event(const Event::MouseMotionEvent& event)
   {
-    vec2i pos = {event.x, event.y};
-    for (int i = 0; i < std::ssize(_menu_items); i++) {
-      const auto& item = _menu_items.at(i);
-      if (item.rect().contains(pos)) {
-        _selected_menu_item = i;
-        break;
-      }
-    }
+    auto hit = _buttons.hit_test({event.x, event.y});
+    if (hit.has_value()) { _selected_menu_item = *hit; }
     return ControllerStatus::Continue{};
   }
 
@@ -177,21 +174,7 @@ struct MenuImpl : public Controller {
 
   virtual void tick() {}
 
-  void reflow(Renderer& ren)
-  {
-    vec2i menu_size{menu_width, int(_menu_items.size() * item_height)};
-
-    auto viewport = ren.viewport();
-
-    _menu_location = (viewport.size - menu_size) / 2;
-
-    vec2i item_location = _menu_location;
-    for (int i = 0; i < std::ssize(_menu_items); i++) {
-      auto& item = _menu_items.at(i);
-      item.rect() = Recti{item_location, {menu_width, item_height}};
-      item_location.y += item_height;
-    }
-  }
+  virtual bool needs_continuous_frames() const { return false; }
 
   virtual bee::OrError<> render(Renderer& ren)
   {
@@ -202,30 +185,21 @@ struct MenuImpl : public Controller {
     ren.set_view({0, 0});
     ren.set_zoom(1.0);
 
-    reflow(ren);
+    // Only does work when the window was resized
+    _buttons.update(ren.viewport().size);
 
-    for (int i = 0; i < int(_menu_items.size()); i++) {
-      auto& item = _menu_items.at(i);
-      if (i == _selected_menu_item) {
-        bail_unit(ren.fill_rect(Color{30, 30, 30, 255}, item.rect()));
-      }
-      bail_unit(
-        _text_writer->draw_text(ren, item.rect().pos + margin, item.label()));
-    }
-
-    return bee::ok();
+    return _buttons.render(ren, *_text_writer, _selected_menu_item);
   }
 
  private:
   TextWriter::ptr _text_writer;
 
   vector<MenuItem> _menu_items;
+  ui::ButtonColumn _buttons;
 
   MenuKeyMapping _key_mapping;
 
   int _selected_menu_item = 0;
-
-  vec2i _menu_location;
 };
 
 } // namespace
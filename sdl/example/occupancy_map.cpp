@@ -0,0 +1,194 @@
+#include "occupancy_map.hpp"
+
+#include <algorithm>
+#include <utility>
+
+using std::vector;
+
+namespace sdl::example {
+
+namespace {
+
+constexpr uint32_t empty_pixel = 0;
+constexpr uint32_t filled_pixel = OccupancyMap::filled_color.to_rgba32();
+
+// Blocks added around the bounds when they grow
+constexpr int min_slack = 64;
+
+int floor_div(int a, int b) { return a / b - (a % b < 0 ? 1 : 0); }
+
+int ceil_div(int a, int b) { return -floor_div(-a, b); }
+
+// Doubles `scale` until the blocks in [lo, hi) fit in max_size pixels
+int fit_scale(int lo, int hi, int scale)
+{
+  while (ceil_div(hi, scale) - floor_div(lo, scale) > OccupancyMap::max_size) {
+    scale *= 2;
+  }
+  return scale;
+}
+
+// The pixels covering the blocks in [lo, hi), with as much of `slack`
+// pixels on each side as fits in max_size
+std::pair<int, int> pixel_range(int lo, int hi, int scale, int slack)
+{
+  int first = floor_div(lo, scale);
+  int last = ceil_div(hi, scale);
+  int extra = std::min(2 * slack, OccupancyMap::max_size - (last - first));
+  return {first - extra / 2, last + (extra - extra / 2)};
+}
+
+} // namespace
+
+void OccupancyMap::reset(const std::set<vec2i>& blocks)
+{
+  _bounds = Recti{{0, 0}, {0, 0}};
+  _scale = 1;
+  _counts.clear();
+  _dirty = std::nullopt;
+  if (blocks.empty()) { return; }
+
+  vec2i min_corner = *blocks.begin();
+  vec2i max_corner = min_corner;
+  for (const auto& block : blocks) {
+    min_corner = min_corner.min(block);
+    max_corner = max_corner.max(block);
+  }
+  _resize(Recti::of_corners(min_corner, max_corner + 1), 1, {0, 0});
+  for (const auto& block : blocks) { _counts[_index(block)]++; }
+}
+
+void OccupancyMap::set(const vec2i& block, bool filled)
+{
+  if (!_bounds.contains(block)) {
+    if (!filled) { return; }
+    _grow(block);
+  }
+  auto& count = _counts[_index(block)];
+  if (!filled && count == 0) { return; }
+  bool was_filled = count > 0;
+  count += filled ? 1 : -1;
+  if ((count > 0) == was_filled) { return; }
+  _mark_dirty({(block - _bounds.pos) / _scale, {1, 1}});
+}
+
+bool OccupancyMap::filled(const vec2i& block) const
+{
+  if (!_bounds.contains(block)) { return false; }
+  return _counts[_index(block)] > 0;
+}
+
+int OccupancyMap::_index(const vec2i& block) const
+{
+  auto p = (block - _bounds.pos) / _scale;
+  return p.y * _size().x + p.x;
+}
+
+std::optional<Recti> OccupancyMap::_filled_bounds() const
+{
+  auto size = _size();
+  std::optional<vec2i> min_corner;
+  vec2i max_corner = {0, 0};
+  for (int y = 0; y < size.y; y++) {
+    for (int x = 0; x < size.x; x++) {
+      if (_counts[y * size.x + x] == 0) { continue; }
+      vec2i p = {x, y};
+      min_corner = min_corner.has_value() ? min_corner->min(p) : p;
+      max_corner = max_corner.max(p + 1);
+    }
+  }
+  if (!min_corner.has_value()) { return std::nullopt; }
+  return Recti::of_corners(
+    _bounds.pos + *min_corner * _scale, _bounds.pos + max_corner * _scale);
+}
+
+void OccupancyMap::_grow(const vec2i& block)
+{
+  Recti blocks{block, {1, 1}};
+  if (auto filled = _filled_bounds()) {
+    blocks = Recti::of_corners(
+      blocks.min_corner().min(filled->min_corner()),
+      blocks.max_corner().max(filled->max_corner()));
+  }
+  _resize(blocks, _scale, (_bounds.size / 2).max({min_slack, min_slack}));
+}
+
+void OccupancyMap::_resize(
+  const Recti& blocks, int min_scale, const vec2i& slack)
+{
+  auto min_corner = blocks.min_corner();
+  auto max_corner = blocks.max_corner();
+  int scale = fit_scale(min_corner.x, max_corner.x, min_scale);
+  scale = fit_scale(min_corner.y, max_corner.y, scale);
+  auto [x1, x2] = pixel_range(
+    min_corner.x, max_corner.x, scale, ceil_div(slack.x, scale));
+  auto [y1, y2] = pixel_range(
+    min_corner.y, max_corner.y, scale, ceil_div(slack.y, scale));
+  Recti bounds =
+    Recti::of_corners(vec2i{x1, y1} * scale, vec2i{x2, y2} * scale);
+
+  // The new scale is a multiple of the old one, so every old pixel lands in
+  // a single new pixel
+  vec2i size = bounds.size / scale;
+  vector<uint32_t> counts(size.x * size.y, 0);
+  auto old_size = _size();
+  for (int y = 0; y < old_size.y; y++) {
+    for (int x = 0; x < old_size.x; x++) {
+      uint32_t count = _counts[y * old_size.x + x];
+      if (count == 0) { continue; }
+      auto p = (_bounds.pos + vec2i{x, y} * _scale - bounds.pos) / scale;
+      counts[p.y * size.x + p.x] += count;
+    }
+  }
+  _counts = std::move(counts);
+  _bounds = bounds;
+  _scale = scale;
+  _dirty = Recti{{0, 0}, size};
+}
+
+void OccupancyMap::_mark_dirty(const Recti& rect)
+{
+  if (!_dirty.has_value()) {
+    _dirty = rect;
+    return;
+  }
+  _dirty = Recti::of_corners(
+    _dirty->min_corner().min(rect.min_corner()),
+    _dirty->max_corner().max(rect.max_corner()));
+}
+
+bee::OrError<> OccupancyMap::upload(SDL_Renderer* ren)
+{
+  if (_counts.empty()) { return bee::ok(); }
+
+  auto size = _size();
+  if (_texture == nullptr || _texture->size() != size) {
+    bail_assign(_texture, Texture::create_streaming(ren, size));
+    _dirty = Recti{{0, 0}, size};
+  }
+  if (_dirty.has_value()) {
+    const auto& dirty = *_dirty;
+    vector<uint32_t> pixels;
+    pixels.reserve(dirty.size.x * dirty.size.y);
+    for (int y = dirty.pos.y; y < dirty.pos.y + dirty.size.y; y++) {
+      for (int x = dirty.pos.x; x < dirty.pos.x + dirty.size.x; x++) {
+        pixels.push_back(
+          _counts[y * size.x + x] > 0 ? filled_pixel : empty_pixel);
+      }
+    }
+    bail_unit(_texture->update(dirty, pixels.data(), dirty.size.x));
+    _dirty = std::nullopt;
+  }
+  return bee::ok();
+}
+
+bee::OrError<> OccupancyMap::draw(Renderer& ren, int block_size)
+{
+  if (_counts.empty()) { return bee::ok(); }
+
+  bail_unit(upload(ren.sdl_renderer()));
+  return ren.fill_rect(
+    *_texture, Recti{_bounds.pos * block_size, _bounds.size * block_size});
+}
+
+} // namespace sdl::example
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <optional>
+#include <set>
+#include <vector>
+
+#include "bee/or_error.hpp"
+#include "sdl/color.hpp"
+#include "sdl/rect.hpp"
+#include "sdl/renderer.hpp"
+#include "sdl/texture.hpp"
+
+namespace sdl::example {
+
+// A picture of the level with one pixel per block, kept in a streaming
+// texture so that a zoomed out level is drawn as a single quad. Edits only
+// upload the pixels they changed. Levels wider than max_size blocks are
+// drawn with each pixel covering a square of blocks instead.
+struct OccupancyMap {
+ public:
+  static constexpr Color filled_color = {
+    .r = 160, .g = 160, .b = 160, .a = 255};
+
+  // Pixels on a side of the texture
+  static constexpr int max_size = 4096;
+
+  void reset(const std::set<vec2i>& blocks);
+
+  // Only called when the block changes, so the map can keep counts of the
+  // blocks under each pixel
+  void set(const vec2i& block, bool filled);
+
+  bool drawable() const { return !_counts.empty(); }
+
+  // Whether the pixel covering `block` has any filled block
+  bool filled(const vec2i& block) const;
+
+  // In blocks, covers every filled block and some slack around them
+  const Recti& bounds() const { return _bounds; }
+
+  // Blocks on a side of each pixel, a power of two
+  int scale() const { return _scale; }
+
+  // In pixels of the map, what the next upload sends
+  const std::optional<Recti>& dirty() const { return _dirty; }
+
+  // Uploads pending changes, making a new texture when the bounds changed
+  bee::OrError<> upload(SDL_Renderer* ren);
+
+  // Uploads pending changes and draws the map where the blocks are, with
+  // each block covering block_size units
+  bee::OrError<> draw(Renderer& ren, int block_size);
+
+ private:
+  vec2i _size() const { return _bounds.size / _scale; }
+
+  int _index(const vec2i& block) const;
+
+  // In blocks, the pixels that have filled blocks
+  std::optional<Recti> _filled_bounds() const;
+
+  // Makes room for `block`, with some slack so that drawing past the edge
+  // doesn't reallocate every time
+  void _grow(const vec2i& block);
+
+  // Moves the counts to new bounds covering `blocks` and up to `slack`
+  // blocks around them, with a scale no smaller than `min_scale` that keeps
+  // the texture within max_size
+  void _resize(const Recti& blocks, int min_scale, const vec2i& slack);
+
+  void _mark_dirty(const Recti& rect);
+
+  // In blocks, aligned to _scale
+  Recti _bounds{{0, 0}, {0, 0}};
+  int _scale = 1;
+
+  // Filled blocks under each pixel
+  std::vector<uint32_t> _counts;
+
+  // In pixels of the texture, which is recreated when it is null or its size
+  // doesn't match _bounds
+  std::optional<Recti> _dirty;
+  Texture::ptr _texture;
+};
+
+} // namespace sdl::example
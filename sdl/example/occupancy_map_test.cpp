@@ -0,0 +1,150 @@
+#include "occupancy_map.hpp"
+
+#include <set>
+
+#include "bee/testing.hpp"
+#include "sdl/software_canvas.hpp"
+
+namespace sdl::example {
+namespace {
+
+void show(const OccupancyMap& map)
+{
+  P("drawable:$ bounds:$ scale:$",
+    map.drawable(),
+    map.bounds(),
+    map.scale());
+  if (map.dirty().has_value()) {
+    P("dirty:$", *map.dirty());
+  } else {
+    P("dirty:none");
+  }
+}
+
+void show_filled(const OccupancyMap& map, const std::set<vec2i>& blocks)
+{
+  for (const auto& block : blocks) {
+    P("$,$ filled:$", block.x, block.y, map.filled(block));
+  }
+}
+
+TEST(reset)
+{
+  OccupancyMap map;
+  show(map);
+
+  // Bounds fit the blocks exactly and the whole map is uploaded
+  map.reset({{0, 0}, {3, 2}, {-5, 7}});
+  show(map);
+  show_filled(map, {{0, 0}, {3, 2}, {-5, 7}, {1, 1}, {-6, 7}, {4, 2}});
+
+  // Nothing from before a reset is kept
+  map.reset({{10, 10}});
+  show(map);
+  show_filled(map, {{0, 0}, {10, 10}});
+
+  map.reset({});
+  show(map);
+  show_filled(map, {{10, 10}});
+}
+
+// Edits inside the bounds only upload the rect around what they changed
+TEST(dirty)
+{
+  SoftwareCanvas canvas({16, 16});
+  OccupancyMap map;
+  map.reset({{0, 0}, {3, 2}, {-5, 7}});
+  must_unit(map.upload(canvas.ren()));
+  show(map);
+
+  // Clearing a block that isn't there changes nothing
+  map.set({1, 1}, false);
+  show(map);
+
+  map.set({1, 1}, true);
+  show(map);
+  map.set({3, 2}, false);
+  show(map);
+  map.set({-4, 6}, true);
+  show(map);
+  show_filled(map, {{1, 1}, {3, 2}, {-4, 6}});
+
+  must_unit(map.upload(canvas.ren()));
+  show(map);
+}
+
+TEST(grow)
+{
+  SoftwareCanvas canvas({16, 16});
+  OccupancyMap map;
+  map.reset({{0, 0}, {3, 2}, {-5, 7}});
+  must_unit(map.upload(canvas.ren()));
+
+  // Clearing outside the bounds doesn't grow them
+  map.set({100, 100}, false);
+  show(map);
+
+  // Growing keeps the blocks and uploads everything again
+  map.set({200, -100}, true);
+  show(map);
+  show_filled(map, {{0, 0}, {3, 2}, {-5, 7}, {200, -100}});
+  must_unit(map.upload(canvas.ren()));
+
+  // The slack leaves room for nearby blocks
+  map.set({210, -110}, true);
+  show(map);
+
+  // Starting from an empty map
+  map.reset({});
+  map.set({-3, 4}, true);
+  show(map);
+  show_filled(map, {{-3, 4}});
+}
+
+// Blocks that fit in max_size keep one pixel per block, with only as much
+// slack as fits
+TEST(grow_near_max_size)
+{
+  OccupancyMap map;
+  map.reset({{0, 0}, {1999, 0}});
+  map.set({3200, 0}, true);
+  show(map);
+  show_filled(map, {{0, 0}, {1999, 0}, {3200, 0}});
+
+  map.set({OccupancyMap::max_size - 1, 0}, true);
+  show(map);
+
+  // Removed blocks don't hold on to the bounds when growing
+  map.set({0, 0}, false);
+  map.set({4500, 0}, true);
+  show(map);
+  show_filled(map, {{1999, 0}, {4500, 0}});
+}
+
+// Past max_size each pixel covers a square of blocks, and stays filled
+// until every block under it is cleared
+TEST(coarse)
+{
+  SoftwareCanvas canvas({16, 16});
+  OccupancyMap map;
+  map.reset({{0, 0}, {1, 0}, {-1, 0}});
+  map.set({10000, 5}, true);
+  show(map);
+  show_filled(map, {{-1, 0}, {0, 0}, {1, 0}, {10000, 5}, {10001, 5}});
+  must_unit(map.upload(canvas.ren()));
+
+  map.set({0, 0}, false);
+  show_filled(map, {{0, 0}, {1, 0}});
+  map.set({1, 0}, false);
+  show_filled(map, {{0, 0}, {1, 0}, {-1, 0}});
+  show(map);
+
+  // A reset goes back to one pixel per block when the blocks fit
+  map.reset({{0, 0}, {10000, 0}});
+  show(map);
+  map.reset({{0, 0}, {100, 0}});
+  show(map);
+}
+
+} // namespace
+} // namespace sdl::example
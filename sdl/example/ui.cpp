@@ -0,0 +1,118 @@
+#include "ui.hpp"
+
+#include <algorithm>
+
+using std::optional;
+using std::string;
+
+namespace sdl::example::ui {
+
+////////////////////////////////////////////////////////////////////////////////
+// HitIndex
+//
+
+void HitIndex::build(std::span<const Recti> rects)
+{
+  _rects.assign(rects.begin(), rects.end());
+  _cells.clear();
+  if (_rects.empty()) {
+    _bounds = Recti{{0, 0}, {0, 0}};
+    _cells_size = {0, 0};
+    return;
+  }
+
+  vec2i min_corner = _rects.front().min_corner();
+  vec2i max_corner = _rects.front().max_corner();
+  for (const auto& rect : _rects) {
+    min_corner = min_corner.min(rect.min_corner());
+    max_corner = max_corner.max(rect.max_corner());
+  }
+  _bounds = Recti::of_corners(min_corner, max_corner);
+  _cells_size = (_bounds.size + (cell_size - 1)) / cell_size;
+  _cells.resize(_cells_size.x * _cells_size.y);
+
+  for (int i = 0; i < std::ssize(_rects); i++) {
+    const auto& rect = _rects[i];
+    if (rect.size.x <= 0 || rect.size.y <= 0) { continue; }
+    vec2i first = (rect.min_corner() - _bounds.pos) / cell_size;
+    vec2i last = (rect.max_corner() - _bounds.pos - 1) / cell_size;
+    for (int y = first.y; y <= last.y; y++) {
+      for (int x = first.x; x <= last.x; x++) {
+        _cells[y * _cells_size.x + x].push_back(i);
+      }
+    }
+  }
+}
+
+optional<int> HitIndex::find(const vec2i& pos) const
+{
+  if (!_bounds.contains(pos)) { return std::nullopt; }
+  vec2i cell = (pos - _bounds.pos) / cell_size;
+  for (int i : _cells[cell.y * _cells_size.x + cell.x]) {
+    if (_rects[i].contains(pos)) { return i; }
+  }
+  return std::nullopt;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ButtonColumn
+//
+
+int ButtonColumn::add(const string& label)
+{
+  _buttons.push_back({.label = label});
+  // Adding a button moves all the others
+  for (auto& button : _buttons) { button.dirty = true; }
+  return size() - 1;
+}
+
+void ButtonColumn::set_label(int index, const string& label)
+{
+  auto& button = _buttons.at(index);
+  if (button.label == label) { return; }
+  button.label = label;
+  button.dirty = true;
+}
+
+bool ButtonColumn::update(const vec2i& viewport_size)
+{
+  bool resized = _viewport_size != viewport_size;
+  if (!resized && std::ranges::none_of(_buttons, &Button::dirty)) {
+    return false;
+  }
+  _viewport_size = viewport_size;
+
+  vec2i column_size{_style.width, size() * _style.height};
+  vec2i pos = (viewport_size - column_size) / 2;
+  std::vector<Recti> rects;
+  rects.reserve(_buttons.size());
+  for (auto& button : _buttons) {
+    button.rect = Recti{pos, {_style.width, _style.height}};
+    button.dirty = false;
+    rects.push_back(button.rect);
+    pos.y += _style.height;
+  }
+  _hits.build(rects);
+  return true;
+}
+
+optional<int> ButtonColumn::hit_test(const vec2i& pos) const
+{
+  return _hits.find(pos);
+}
+
+bee::OrError<> ButtonColumn::render(
+  Renderer& ren, TextWriter& text, optional<int> highlighted) const
+{
+  if (highlighted.has_value()) {
+    ren.set_layer(0);
+    bail_unit(ren.fill_rect(Color{30, 30, 30, 255}, rect(*highlighted)));
+  }
+  for (const auto& button : _buttons) {
+    text.queue_text(button.rect.pos + _style.margin, button.label);
+  }
+  ren.set_layer(1);
+  return text.flush(ren);
+}
+
+} // namespace sdl::example::ui
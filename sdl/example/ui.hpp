@@ -0,0 +1,78 @@
+#pragma once
+
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "bee/or_error.hpp"
+#include "sdl/rect.hpp"
+#include "sdl/renderer.hpp"
+#include "sdl/text_writer.hpp"
+
+namespace sdl::example::ui {
+
+// Finds which rect a point falls in through a uniform grid over their
+// bounds, so a lookup only checks the rects overlapping one cell
+struct HitIndex {
+ public:
+  static constexpr int cell_size = 64;
+
+  void build(std::span<const Recti> rects);
+
+  // The first of the rects that contains pos
+  std::optional<int> find(const vec2i& pos) const;
+
+ private:
+  std::vector<Recti> _rects;
+  Recti _bounds{{0, 0}, {0, 0}};
+  vec2i _cells_size = {0, 0};
+  std::vector<std::vector<int>> _cells;
+};
+
+// A column of labelled buttons centered in the viewport. Rects and the hit
+// index are kept between frames and only recomputed when the viewport is
+// resized or a button changes, so rendering a static column just replays
+// cached draws.
+struct ButtonColumn {
+ public:
+  struct Style {
+    int width;
+    int height;
+    int margin;
+  };
+
+  explicit ButtonColumn(const Style& style) : _style(style) {}
+
+  int add(const std::string& label);
+
+  void set_label(int index, const std::string& label);
+
+  int size() const { return int(_buttons.size()); }
+
+  const Recti& rect(int index) const { return _buttons.at(index).rect; }
+
+  // Lays out the buttons again if anything changed, returns whether it did
+  bool update(const vec2i& viewport_size);
+
+  // Only valid after update()
+  std::optional<int> hit_test(const vec2i& pos) const;
+
+  // Highlights a button and draws all labels with a single draw call
+  bee::OrError<> render(
+    Renderer& ren, TextWriter& text, std::optional<int> highlighted) const;
+
+ private:
+  struct Button {
+    std::string label;
+    Recti rect{};
+    bool dirty = true;
+  };
+
+  Style _style;
+  std::vector<Button> _buttons;
+  std::optional<vec2i> _viewport_size;
+  HitIndex _hits;
+};
+
+} // namespace sdl::example::ui
@@ -0,0 +1,77 @@
+#include "ui.hpp"
+
+#include <vector>
+
+#include "bee/testing.hpp"
+
+using std::vector;
+
+namespace sdl::example::ui {
+namespace {
+
+void show_hits(const HitIndex& index, const vector<vec2i>& points)
+{
+  for (const auto& pos : points) {
+    auto hit = index.find(pos);
+    if (hit.has_value()) {
+      P("$,$ -> $", pos.x, pos.y, *hit);
+    } else {
+      P("$,$ -> none", pos.x, pos.y);
+    }
+  }
+}
+
+TEST(hit_and_miss)
+{
+  // A column of buttons with gaps between them, spread over several cells
+  vector<Recti> rects = {
+    {{200, 100}, {400, 40}},
+    {{200, 144}, {400, 40}},
+    {{200, 188}, {400, 40}},
+  };
+  HitIndex index;
+  index.build(rects);
+
+  // Corners are inside, the far edges are outside
+  show_hits(index, {{200, 100}, {599, 139}, {600, 120}, {300, 140}});
+  // The gaps between the buttons and around the column
+  show_hits(index, {{300, 142}, {300, 185}, {199, 150}, {300, 99}});
+  show_hits(index, {{300, 150}, {599, 227}, {300, 228}, {-1000, -1000}});
+}
+
+TEST(overlapping)
+{
+  // The first of the rects containing the point wins, even when a later one
+  // is smaller
+  vector<Recti> rects = {
+    {{0, 0}, {100, 100}},
+    {{-50, -50}, {300, 300}},
+    {{50, 50}, {10, 10}},
+  };
+  HitIndex index;
+  index.build(rects);
+  show_hits(index, {{55, 55}, {0, 0}, {99, 99}, {100, 100}, {-50, -50}});
+  show_hits(index, {{249, 249}, {250, 0}});
+}
+
+TEST(rebuild)
+{
+  HitIndex index;
+  show_hits(index, {{0, 0}});
+
+  // Empty rects are never hit
+  vector<Recti> rects = {{{0, 0}, {10, 10}}, {{20, 0}, {0, 10}}};
+  index.build(rects);
+  show_hits(index, {{5, 5}, {20, 5}});
+
+  // Building again forgets the previous rects
+  rects = {{{100, 100}, {10, 10}}};
+  index.build(rects);
+  show_hits(index, {{5, 5}, {105, 105}});
+
+  index.build({});
+  show_hits(index, {{0, 0}, {105, 105}});
+}
+
+} // namespace
+} // namespace sdl::example::ui
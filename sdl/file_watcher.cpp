@@ -0,0 +1,152 @@
+#include "file_watcher.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <set>
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+using std::string;
+
+namespace sdl {
+
+namespace {
+
+constexpr uint32_t watch_mask = IN_CLOSE_WRITE | IN_MOVED_TO;
+
+// How often the thread checks whether it should stop
+constexpr int poll_timeout_ms = 100;
+
+std::pair<string, string> split_path(const string& path)
+{
+  auto slash = path.rfind('/');
+  if (slash == string::npos) { return {".", path}; }
+  if (slash == 0) { return {"/", path.substr(1)}; }
+  return {path.substr(0, slash), path.substr(slash + 1)};
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+// Watch
+//
+
+FileWatcher::Watch::~Watch()
+{
+  if (_watcher != nullptr) { _watcher->_unwatch(_id); }
+}
+
+FileWatcher::Watch::Watch(Watch&& other)
+    : _watcher(std::exchange(other._watcher, nullptr)), _id(other._id)
+{}
+
+FileWatcher::Watch& FileWatcher::Watch::operator=(Watch&& other)
+{
+  if (this != &other) {
+    if (_watcher != nullptr) { _watcher->_unwatch(_id); }
+    _watcher = std::exchange(other._watcher, nullptr);
+    _id = other._id;
+  }
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// FileWatcher
+//
+
+FileWatcher::FileWatcher(int fd) : _fd(fd)
+{
+  _thread = std::jthread([this](std::stop_token stop) { _run(stop); });
+}
+
+FileWatcher::~FileWatcher()
+{
+  _thread.request_stop();
+  if (_thread.joinable()) { _thread.join(); }
+  close(_fd);
+}
+
+bee::OrError<FileWatcher::ptr> FileWatcher::create()
+{
+  int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (fd < 0) { return EF("inotify_init1 failed: $", strerror(errno)); }
+  return ptr(new FileWatcher(fd));
+}
+
+bee::OrError<FileWatcher::Watch> FileWatcher::watch(
+  const bee::FilePath& path, Callback&& on_change)
+{
+  auto [dir, filename] = split_path(path.to_string());
+  // Watching a directory twice returns the same descriptor
+  int wd = inotify_add_watch(_fd, dir.data(), watch_mask);
+  if (wd < 0) {
+    return EF("Failed to watch $: $", path.to_string(), strerror(errno));
+  }
+
+  std::lock_guard lock(_mutex);
+  uint64_t id = _next_id++;
+  _entries.emplace(
+    id,
+    Entry{
+      .wd = wd,
+      .filename = filename,
+      .path = path,
+      .on_change = std::move(on_change),
+    });
+  return Watch(this, id);
+}
+
+void FileWatcher::_unwatch(uint64_t id)
+{
+  std::lock_guard callback_lock(_callback_mutex);
+  std::lock_guard lock(_mutex);
+  auto it = _entries.find(id);
+  if (it == _entries.end()) { return; }
+  int wd = it->second.wd;
+  _entries.erase(it);
+  for (const auto& [_, entry] : _entries) {
+    if (entry.wd == wd) { return; }
+  }
+  inotify_rm_watch(_fd, wd);
+}
+
+void FileWatcher::_run(std::stop_token stop)
+{
+  alignas(inotify_event) char buffer[4096];
+  while (!stop.stop_requested()) {
+    pollfd fds = {.fd = _fd, .events = POLLIN, .revents = 0};
+    if (poll(&fds, 1, poll_timeout_ms) <= 0) { continue; }
+
+    // A save usually shows up as several events, they are merged so each
+    // changed file is reported once per batch
+    std::set<std::pair<int, string>> changed;
+    while (true) {
+      ssize_t size = read(_fd, buffer, sizeof(buffer));
+      if (size <= 0) { break; }
+      for (ssize_t offset = 0; offset < size;) {
+        auto event = reinterpret_cast<const inotify_event*>(buffer + offset);
+        if (event->len > 0) { changed.emplace(event->wd, event->name); }
+        offset += sizeof(inotify_event) + event->len;
+      }
+    }
+    if (changed.empty()) { continue; }
+
+    std::lock_guard callback_lock(_callback_mutex);
+    std::vector<const Entry*> matches;
+    {
+      std::lock_guard lock(_mutex);
+      for (const auto& [_, entry] : _entries) {
+        if (changed.contains({entry.wd, entry.filename})) {
+          matches.push_back(&entry);
+        }
+      }
+    }
+    // Entries are only erased under the callback lock, so these stay valid
+    for (const auto* entry : matches) { entry->on_change(entry->path); }
+  }
+}
+
+} // namespace sdl
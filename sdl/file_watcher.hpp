@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "bee/file_path.hpp"
+#include "bee/or_error.hpp"
+
+namespace sdl {
+
+// Calls back when watched files change, using inotify on a background
+// thread. Directories are watched rather than the files themselves so that
+// editors that save by writing a new file and renaming it over the old one
+// are noticed too.
+struct FileWatcher {
+ public:
+  using ptr = std::unique_ptr<FileWatcher>;
+
+  // Runs on the watcher thread
+  using Callback = std::function<void(const bee::FilePath& path)>;
+
+  // Keeps a callback registered, destroying it unregisters the callback and
+  // waits for it to return if it is running
+  struct Watch {
+   public:
+    Watch() = default;
+    ~Watch();
+
+    Watch(const Watch& other) = delete;
+    Watch(Watch&& other);
+    Watch& operator=(Watch&& other);
+
+   private:
+    friend struct FileWatcher;
+
+    Watch(FileWatcher* watcher, uint64_t id) : _watcher(watcher), _id(id) {}
+
+    FileWatcher* _watcher = nullptr;
+    uint64_t _id = 0;
+  };
+
+  ~FileWatcher();
+
+  FileWatcher(const FileWatcher& other) = delete;
+  FileWatcher(FileWatcher&& other) = delete;
+
+  static bee::OrError<ptr> create();
+
+  // Calls `on_change` after `path` is written or replaced. The watcher must
+  // outlive the returned Watch.
+  bee::OrError<Watch> watch(const bee::FilePath& path, Callback&& on_change);
+
+ private:
+  struct Entry {
+    int wd;
+    std::string filename;
+    bee::FilePath path;
+    Callback on_change;
+  };
+
+  explicit FileWatcher(int fd);
+
+  void _unwatch(uint64_t id);
+  void _run(std::stop_token stop);
+
+  int _fd;
+
+  // Held while callbacks run, so a callback never runs after _unwatch
+  // returns
+  std::mutex _callback_mutex;
+
+  std::mutex _mutex;
+  std::map<uint64_t, Entry> _entries;
+  uint64_t _next_id = 1;
+
+  std::jthread _thread;
+};
+
+} // namespace sdl
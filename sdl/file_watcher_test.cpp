@@ -0,0 +1,147 @@
+#include "file_watcher.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "bee/testing.hpp"
+
+using std::string;
+using std::vector;
+
+namespace sdl {
+namespace {
+
+// Only reached if the watcher misses a change, so it can be generous enough
+// for a loaded machine
+constexpr auto deadline = std::chrono::seconds(10);
+
+// Callbacks run on the watcher thread, the test waits for the change it
+// expects. Changes are reported in the order they happen, so a change that
+// wasn't reported by the time a later one is never will be.
+struct Changes {
+ public:
+  FileWatcher::Callback callback()
+  {
+    return [this](const bee::FilePath& path) {
+      auto name = std::filesystem::path(path.to_string()).filename();
+      std::lock_guard lock(_mutex);
+      _names.push_back(name.string());
+      _cv.notify_all();
+    };
+  }
+
+  // The names of the files reported so far, once `name` is among them
+  string wait_for(const string& name)
+  {
+    std::unique_lock lock(_mutex);
+    _cv.wait_for(lock, deadline, [&]() {
+      return std::find(_names.begin(), _names.end(), name) != _names.end();
+    });
+    string names;
+    for (const auto& reported : _names) { names += " " + reported; }
+    return names;
+  }
+
+ private:
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  vector<string> _names;
+};
+
+struct TempDir {
+ public:
+  TempDir()
+  {
+    string pattern =
+      (std::filesystem::temp_directory_path() / "file_watcher_test.XXXXXX")
+        .string();
+    path = mkdtemp(pattern.data());
+  }
+
+  ~TempDir() { std::filesystem::remove_all(path); }
+
+  string file(const string& name) const { return path + "/" + name; }
+
+  string path;
+};
+
+void write_file(const string& path, const string& content)
+{
+  std::ofstream(path, std::ios::binary) << content;
+}
+
+// Like editors that save by writing a new file and renaming it over the old
+// one
+void replace_file(const string& path, const string& content)
+{
+  write_file(path + ".tmp", content);
+  std::rename((path + ".tmp").data(), path.data());
+}
+
+TEST(atomic_replace)
+{
+  TempDir dir;
+  auto path = dir.file("level.txt");
+  write_file(path, "old");
+
+  must(watcher, FileWatcher::create());
+  Changes changes;
+  must(watch, watcher->watch(bee::FilePath(path), changes.callback()));
+  auto marker = dir.file("marker.txt");
+  must(marker_watch, watcher->watch(bee::FilePath(marker), changes.callback()));
+
+  // The write to the temporary file and the rename are a single change
+  replace_file(path, "new");
+  P("reported:$", changes.wait_for("level.txt"));
+  write_file(marker, "");
+  P("reported:$", changes.wait_for("marker.txt"));
+}
+
+TEST(ignores_other_files)
+{
+  TempDir dir;
+  auto path = dir.file("level.txt");
+  write_file(path, "old");
+
+  must(watcher, FileWatcher::create());
+  Changes changes;
+  must(watch, watcher->watch(bee::FilePath(path), changes.callback()));
+  auto marker = dir.file("marker.txt");
+  must(marker_watch, watcher->watch(bee::FilePath(marker), changes.callback()));
+
+  write_file(dir.file("other.txt"), "other");
+  write_file(marker, "");
+  P("reported:$", changes.wait_for("marker.txt"));
+
+  write_file(path, "new");
+  P("reported:$", changes.wait_for("level.txt"));
+}
+
+TEST(unwatch)
+{
+  TempDir dir;
+  auto path = dir.file("level.txt");
+  write_file(path, "old");
+
+  must(watcher, FileWatcher::create());
+  Changes changes;
+  auto marker = dir.file("marker.txt");
+  must(marker_watch, watcher->watch(bee::FilePath(marker), changes.callback()));
+  {
+    must(watch, watcher->watch(bee::FilePath(path), changes.callback()));
+  }
+  replace_file(path, "new");
+  write_file(marker, "");
+  P("reported:$", changes.wait_for("marker.txt"));
+}
+
+} // namespace
+} // namespace sdl
@@ -50,6 +50,22 @@ bee::OrError<Font::ptr> Font::create(int ptsize)
   return std::make_shared<FontImpl>(font_info, font);
 }
 
+bee::OrError<Font::ptr> Font::create_from_memory(
+  const std::string& name, std::span<const std::byte> ttf, int ptsize)
+{
+  auto rw = SDL_RWFromConstMem(ttf.data(), int(ttf.size()));
+  if (rw == nullptr) {
+    return EF("SDL_RWFromConstMem failed: $", SDL_GetError());
+  }
+  // Closes the RWops along with the font
+  auto font = TTF_OpenFontRW(rw, 1, ptsize);
+  if (font == nullptr) {
+    return EF("Failed to open font $: $", name, TTF_GetError());
+  }
+  FontInfo info{.file_path = bee::FilePath(), .name = name, .style = ""};
+  return std::make_shared<FontImpl>(info, font);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // TTF
 //
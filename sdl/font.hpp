@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <span>
+#include <string>
 
 #include "font_info.hpp"
 #include "renderer.hpp"
@@ -21,6 +24,11 @@ struct Font {
 
   static bee::OrError<ptr> create(int size);
 
+  // Reads the font from TTF data in memory, an asset pack entry for instance,
+  // without copying it. The data must outlive the font.
+  static bee::OrError<ptr> create_from_memory(
+    const std::string& name, std::span<const std::byte> ttf, int size);
+
   virtual const FontInfo& info() const = 0;
 };
 
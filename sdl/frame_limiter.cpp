@@ -0,0 +1,64 @@
+#include "frame_limiter.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <thread>
+
+namespace sdl {
+namespace {
+
+struct SystemClock final : public FrameLimiter::Clock {
+ public:
+  virtual bee::Time now() override { return bee::Time::monotonic(); }
+
+  virtual void sleep(const bee::Span& span) override
+  {
+    std::this_thread::sleep_for(std::chrono::nanoseconds(span.to_nanos()));
+  }
+};
+
+} // namespace
+
+FrameLimiter::Clock::~Clock() {}
+
+FrameLimiter::Clock& FrameLimiter::Clock::system()
+{
+  static SystemClock clock;
+  return clock;
+}
+
+FrameLimiter::FrameLimiter(int fps, Clock& clock)
+    : _clock(&clock), _period(bee::Span::of_nanos(1000000000 / fps))
+{
+  assert(fps > 0);
+}
+
+void FrameLimiter::wait()
+{
+  _stats.frames++;
+  auto now = _clock->now();
+  if (!_deadline.has_value()) {
+    _deadline = now + _period;
+    return;
+  }
+
+  if (now > *_deadline) {
+    auto late = now - *_deadline;
+    if (late > tolerance) {
+      _stats.missed++;
+      _stats.total_late += late;
+      _stats.max_late = std::max(_stats.max_late, late);
+    }
+    _deadline = now + _period;
+    return;
+  }
+
+  auto sleep = (*_deadline - now) - spin_margin;
+  if (sleep > bee::Span::zero()) { _clock->sleep(sleep); }
+  while (_clock->now() < *_deadline) {}
+
+  *_deadline += _period;
+}
+
+} // namespace sdl
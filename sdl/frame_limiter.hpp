@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "bee/span.hpp"
+#include "bee/time.hpp"
+
+namespace sdl {
+
+// Holds a loop to a fixed frame rate. The thread sleeps until shortly before
+// each deadline, then spins the rest of the way, since sleeps routinely
+// overshoot by more than the precision we want.
+struct FrameLimiter {
+ public:
+  // Where the limiter reads the time from and how it sleeps, so tests can
+  // run it on a fake clock
+  struct Clock {
+   public:
+    virtual ~Clock();
+
+    virtual bee::Time now() = 0;
+
+    // May return late, but not early
+    virtual void sleep(const bee::Span& span) = 0;
+
+    // The monotonic clock and the thread sleeping for real
+    static Clock& system();
+  };
+
+  struct Stats {
+    int64_t frames = 0;
+
+    // Frames that only started after their deadline had passed, and by how
+    // much they were late
+    int64_t missed = 0;
+    bee::Span total_late = bee::Span::zero();
+    bee::Span max_late = bee::Span::zero();
+  };
+
+  // How early the limiter stops sleeping and starts spinning
+  static constexpr bee::Span spin_margin = bee::Span::of_millis(1);
+
+  // Lateness below this isn't counted as a missed deadline
+  static constexpr bee::Span tolerance = bee::Span::of_micros(100);
+
+  explicit FrameLimiter(int fps, Clock& clock = Clock::system());
+
+  // Returns at the deadline of the next frame. The first call returns right
+  // away, and after a missed deadline the schedule restarts from now instead
+  // of rushing frames to catch up.
+  void wait();
+
+  // Drops the schedule, so the next wait() returns right away like the first
+  // one. For loops that just slept on their own, whose next frame would
+  // otherwise be counted as missed by the length of the sleep.
+  void reset() { _deadline = std::nullopt; }
+
+  const bee::Span& period() const { return _period; }
+
+  const Stats& stats() const { return _stats; }
+
+ private:
+  Clock* _clock;
+  bee::Span _period;
+  std::optional<bee::Time> _deadline;
+  Stats _stats;
+};
+
+} // namespace sdl
@@ -0,0 +1,138 @@
+#include "frame_limiter.hpp"
+
+#include <string>
+
+#include "bee/testing.hpp"
+
+using std::string;
+
+namespace sdl {
+namespace {
+
+constexpr int fps = 100;
+constexpr bee::Span period = bee::Span::of_millis(10);
+
+// Time only moves when the test or the limiter says so, so the results don't
+// depend on how busy the machine is. Each read takes a little time, which is
+// what lets the limiter's spin reach the deadline.
+struct FakeClock final : public FrameLimiter::Clock {
+ public:
+  static constexpr bee::Span read_time = bee::Span::of_micros(10);
+
+  explicit FakeClock(const bee::Span& sleep_overshoot = bee::Span::zero())
+      : _sleep_overshoot(sleep_overshoot)
+  {}
+
+  virtual bee::Time now() override
+  {
+    _time += read_time;
+    return _time;
+  }
+
+  virtual void sleep(const bee::Span& span) override
+  {
+    _sleeps++;
+    _time += span + _sleep_overshoot;
+  }
+
+  // Stands in for the work of a frame
+  void advance(const bee::Span& span) { _time += span; }
+
+  int64_t elapsed_micros() const { return (_time - _start).to_micros(); }
+
+  int sleeps() const { return _sleeps; }
+
+ private:
+  bee::Span _sleep_overshoot;
+  bee::Time _start = bee::Time::monotonic();
+  bee::Time _time = _start;
+  int _sleeps = 0;
+};
+
+void show_stats(const FrameLimiter& limiter)
+{
+  const auto& stats = limiter.stats();
+  P("frames:$ missed:$ total_late:$us max_late:$us",
+    stats.frames,
+    stats.missed,
+    stats.total_late.to_micros(),
+    stats.max_late.to_micros());
+}
+
+// Runs `frames` frames that each do `work`, and shows when each wait
+// returned
+void run_frames(
+  FakeClock& clock, FrameLimiter& limiter, int frames, const bee::Span& work)
+{
+  string returns;
+  for (int i = 0; i < frames; i++) {
+    clock.advance(work);
+    limiter.wait();
+    returns += " " + std::to_string(clock.elapsed_micros());
+  }
+  P("returned at (us):$", returns);
+}
+
+TEST(cadence)
+{
+  FakeClock clock;
+  FrameLimiter limiter(fps, clock);
+  P("period is 10ms:$", limiter.period() == period);
+
+  // The first wait returns right away, then each wait returns at its
+  // deadline, a period after the previous one, so the schedule doesn't drift
+  // with the time spent between waits
+  run_frames(clock, limiter, 1, bee::Span::zero());
+  run_frames(clock, limiter, 5, period / 4);
+  run_frames(clock, limiter, 3, period * 3 / 4);
+  P("sleeps:$", clock.sleeps());
+  show_stats(limiter);
+}
+
+// Sleeps that overshoot by less than the spin margin still hit the deadline,
+// longer ones make the frame late without moving the next deadlines
+TEST(sleep_overshoot)
+{
+  FakeClock precise(FrameLimiter::spin_margin / 2);
+  FrameLimiter precise_limiter(fps, precise);
+  run_frames(precise, precise_limiter, 4, period / 4);
+
+  FakeClock sloppy(FrameLimiter::spin_margin * 2);
+  FrameLimiter sloppy_limiter(fps, sloppy);
+  run_frames(sloppy, sloppy_limiter, 4, period / 4);
+}
+
+TEST(missed_deadline)
+{
+  FakeClock clock;
+  FrameLimiter limiter(fps, clock);
+  run_frames(clock, limiter, 1, bee::Span::zero());
+
+  // Late by about two periods, counted once and the schedule restarts from
+  // the late frame instead of rushing the next ones
+  run_frames(clock, limiter, 1, period * 3);
+  show_stats(limiter);
+  run_frames(clock, limiter, 2, bee::Span::zero());
+  show_stats(limiter);
+
+  // Lateness within the tolerance isn't counted
+  run_frames(clock, limiter, 1, period + FrameLimiter::tolerance / 2);
+  show_stats(limiter);
+}
+
+TEST(reset)
+{
+  FakeClock clock;
+  FrameLimiter limiter(fps, clock);
+  run_frames(clock, limiter, 1, bee::Span::zero());
+
+  // Like after an idle sleep in the game loop, the next frame starts a new
+  // schedule and isn't counted as missed
+  clock.advance(period * 3);
+  limiter.reset();
+  run_frames(clock, limiter, 3, bee::Span::zero());
+  show_stats(limiter);
+}
+
+} // namespace
+} // namespace sdl
@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+
+# Generates assets/ascii.qoi, the font atlas used by TextWriter. Each
+# character from ' ' to '~' gets a 32x32 cell, 16 to a row, with the glyph
+# origin 7 pixels into the cell and the baseline 23 pixels down. Glyphs are
+# drawn into their own cell and the outermost row and column of every cell
+# are kept transparent, so sampling a cell never picks up its neighbours.
+#
+# After regenerating, update embedded_images.cpp with embed_images.
+
+import sys
+
+from PIL import Image, ImageDraw, ImageFont
+
+FONT = '/usr/share/fonts/truetype/dejavu/DejaVuSansMono.ttf'
+FONT_SIZE = 28
+
+FIRST_CHAR = ' '
+LAST_CHAR = '~'
+CELL_SIZE = 32
+CELLS_PER_ROW = 16
+GLYPH_INSET = 7
+BASELINE = 23
+PADDING = 1
+
+
+def draw_cell(font, c):
+    cell = Image.new('RGBA', (CELL_SIZE, CELL_SIZE), (255, 255, 255, 0))
+    draw = ImageDraw.Draw(cell)
+    draw.text(
+        (GLYPH_INSET, BASELINE), c, font=font, fill=(255, 255, 255, 255),
+        anchor='ls')
+    inside = (PADDING, PADDING, CELL_SIZE - PADDING, CELL_SIZE - PADDING)
+    bbox = cell.getbbox()
+    if bbox is not None and (
+            bbox[0] < inside[0] or bbox[1] < inside[1] or
+            bbox[2] > inside[2] or bbox[3] > inside[3]):
+        sys.exit(f'{c!r} does not fit in its cell: {bbox}')
+    return cell
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(f'usage: {sys.argv[0]} <output.qoi>')
+
+    font = ImageFont.truetype(FONT, FONT_SIZE)
+    count = ord(LAST_CHAR) - ord(FIRST_CHAR) + 1
+    rows = (count + CELLS_PER_ROW - 1) // CELLS_PER_ROW
+    atlas = Image.new(
+        'RGBA', (CELLS_PER_ROW * CELL_SIZE, rows * CELL_SIZE),
+        (255, 255, 255, 0))
+    for i in range(count):
+        cell = draw_cell(font, chr(ord(FIRST_CHAR) + i))
+        atlas.paste(
+            cell,
+            ((i % CELLS_PER_ROW) * CELL_SIZE, (i // CELLS_PER_ROW) * CELL_SIZE))
+    atlas.save(sys.argv[1], format='QOI')
+
+
+main()
@@ -0,0 +1,96 @@
+#include "input_thread.hpp"
+
+#include <chrono>
+#include <thread>
+#include <utility>
+
+#include "bee/span.hpp"
+#include "bee/time.hpp"
+
+namespace sdl {
+
+namespace {
+
+// Upper bound on how long the input thread blocks in SDL, which is also how
+// long it takes to notice a stop request.
+constexpr bee::Span wait_timeout = bee::Span::of_millis(5);
+
+} // namespace
+
+InputThread::InputThread(SDLContext& ctx, size_t capacity)
+    : _ctx(ctx), _queue(capacity)
+{}
+
+InputThread::~InputThread()
+{
+  _thread.request_stop();
+  if (_thread.joinable()) { _thread.join(); }
+}
+
+bee::OrError<InputThread::ptr> InputThread::create(
+  SDLContext& ctx, size_t capacity)
+{
+  auto input = ptr(new InputThread(ctx, capacity));
+  input->_thread = std::jthread(
+    [raw = input.get()](std::stop_token stop) { raw->_run(stop); });
+  return input;
+}
+
+void InputThread::_run(std::stop_token stop)
+{
+  while (!stop.stop_requested()) {
+    auto event = _ctx.poll_event(wait_timeout);
+    if (event.is_error()) {
+      std::lock_guard lock(_mutex);
+      _error = event.error();
+      _cv.notify_one();
+      return;
+    }
+    if (!event.value().has_value()) { continue; }
+    // Input must not be lost, so wait for the game loop to catch up rather
+    // than dropping events.
+    while (!_queue.try_push(std::move(*event.value()))) {
+      _stalls.fetch_add(1, std::memory_order_relaxed);
+      if (stop.stop_requested()) { return; }
+      std::this_thread::yield();
+    }
+    _notify();
+  }
+}
+
+void InputThread::_notify()
+{
+  // Taking the lock orders the push before the consumer's last look at the
+  // queue, so the notification can't slip in between that look and the wait
+  std::lock_guard lock(_mutex);
+  _cv.notify_one();
+}
+
+bee::OrError<std::optional<Event>> InputThread::poll_event(
+  const std::optional<bee::Span>& timeout)
+{
+  if (auto event = _queue.try_pop()) { return event; }
+
+  std::optional<bee::Time> deadline;
+  if (timeout.has_value()) { deadline = bee::Time::monotonic() + *timeout; }
+
+  std::unique_lock lock(_mutex);
+  while (true) {
+    if (auto event = _queue.try_pop()) { return event; }
+    if (_error.has_value()) { return *_error; }
+    if (!deadline.has_value()) { return std::nullopt; }
+    auto now = bee::Time::monotonic();
+    if (now >= *deadline) { return std::nullopt; }
+    if (std::exchange(_woken, false)) { return std::nullopt; }
+    _cv.wait_for(lock, std::chrono::nanoseconds((*deadline - now).to_nanos()));
+  }
+}
+
+void InputThread::wake()
+{
+  std::lock_guard lock(_mutex);
+  _woken = true;
+  _cv.notify_one();
+}
+
+} // namespace sdl
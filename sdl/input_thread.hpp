@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "event.hpp"
+#include "event_source.hpp"
+#include "sdl_context.hpp"
+#include "spsc_queue.hpp"
+
+#include "bee/or_error.hpp"
+
+namespace sdl {
+
+// Pumps SDL events on a dedicated thread as soon as they arrive and hands them
+// to the game loop through a lock-free queue. Events are timestamped when they
+// are taken off the SDL queue, so the consumer can measure latency and process
+// input at sub-frame precision.
+//
+// SDL only guarantees event pumping from the thread that initialized video.
+// X11 and Wayland tolerate pumping from another thread, other platforms may
+// not, which is why this is opt-in.
+struct InputThread final : public EventSource {
+ public:
+  using ptr = std::unique_ptr<InputThread>;
+
+  virtual ~InputThread();
+
+  InputThread(const InputThread& other) = delete;
+  InputThread(InputThread&& other) = delete;
+
+  static bee::OrError<ptr> create(SDLContext& ctx, size_t capacity = 4096);
+
+  // Consumer side, must always be called from the same thread. Returns the
+  // error that stopped the input thread, if any.
+  virtual bee::OrError<std::optional<Event>> poll_event(
+    const std::optional<bee::Span>& timeout = std::nullopt) override;
+
+  virtual void wake() override;
+
+  // Number of times the input thread had to wait for the consumer to make room
+  // in the queue.
+  int64_t stalls() const { return _stalls.load(std::memory_order_relaxed); }
+
+ private:
+  InputThread(SDLContext& ctx, size_t capacity);
+
+  void _run(std::stop_token stop);
+
+  void _notify();
+
+  SDLContext& _ctx;
+
+  SpscQueue<Event> _queue;
+
+  std::atomic<int64_t> _stalls = 0;
+
+  // Lets the consumer block until an event is pushed, wake() is called or
+  // the input thread fails
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  bool _woken = false;
+  std::optional<bee::Error> _error;
+
+  std::jthread _thread;
+};
+
+} // namespace sdl
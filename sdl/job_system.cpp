@@ -0,0 +1,200 @@
+#include "job_system.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace sdl {
+
+namespace {
+
+// Identifies the job system and worker running on the current thread, so
+// jobs pushed from a worker land on its own deque
+thread_local const JobSystem* current_system = nullptr;
+thread_local size_t current_worker = 0;
+
+} // namespace
+
+JobSystem::JobSystem(int num_workers)
+{
+  assert(num_workers >= 0);
+  for (int i = 0; i < num_workers; i++) {
+    _workers.push_back(std::make_unique<Worker>());
+  }
+  // Started only once every worker exists, since they steal from each other
+  for (size_t i = 0; i < _workers.size(); i++) {
+    _workers[i]->thread = std::jthread(
+      [this, i](std::stop_token stop) { _run_worker(i, stop); });
+  }
+}
+
+JobSystem::~JobSystem()
+{
+  for (auto& worker : _workers) { worker->thread.request_stop(); }
+  {
+    std::lock_guard lock(_sleep_mutex);
+    _wake.notify_all();
+  }
+  for (auto& worker : _workers) {
+    if (worker->thread.joinable()) { worker->thread.join(); }
+  }
+}
+
+JobSystem::ptr JobSystem::create()
+{
+  int hardware = int(std::thread::hardware_concurrency());
+  return create(std::max(1, hardware - 1));
+}
+
+JobSystem::ptr JobSystem::create(int num_workers)
+{
+  return ptr(new JobSystem(num_workers));
+}
+
+void JobSystem::run(Job&& job, JobCounter* counter)
+{
+  if (counter != nullptr) {
+    counter->_pending.fetch_add(1, std::memory_order_relaxed);
+  }
+  _push({.job = std::move(job), .counter = counter});
+}
+
+void JobSystem::run_after(
+  JobCounter& dependency, Job&& job, JobCounter* counter)
+{
+  if (counter != nullptr) {
+    counter->_pending.fetch_add(1, std::memory_order_relaxed);
+  }
+  {
+    // _finish drains continuations under the same lock after the counter
+    // drops to zero, so either it sees this one or we see zero
+    std::lock_guard lock(dependency._mutex);
+    if (!dependency.done()) {
+      dependency._continuations.push_back(
+        {.job = std::move(job), .counter = counter});
+      return;
+    }
+  }
+  _push({.job = std::move(job), .counter = counter});
+}
+
+void JobSystem::wait(const JobCounter& counter)
+{
+  while (!counter.done()) {
+    if (!_run_one()) { std::this_thread::yield(); }
+  }
+}
+
+void JobSystem::parallel_for(
+  size_t begin,
+  size_t end,
+  size_t grain,
+  const std::function<void(size_t, size_t)>& f)
+{
+  if (begin >= end) { return; }
+  grain = std::max<size_t>(grain, 1);
+
+  JobCounter counter;
+  for (size_t chunk = begin; chunk < end; chunk += grain) {
+    size_t chunk_end = std::min(end, chunk + grain);
+    run([&f, chunk, chunk_end]() { f(chunk, chunk_end); }, &counter);
+  }
+  wait(counter);
+}
+
+void JobSystem::_push(Task&& task)
+{
+  if (_workers.empty()) {
+    // No workers, the job runs right away on the calling thread
+    task.job();
+    _finish(task.counter);
+    return;
+  }
+
+  size_t index;
+  if (current_system == this) {
+    index = current_worker;
+  } else {
+    index = _next_worker.fetch_add(1, std::memory_order_relaxed) %
+            _workers.size();
+  }
+  {
+    auto& worker = *_workers[index];
+    std::lock_guard lock(worker.mutex);
+    worker.tasks.push_back(std::move(task));
+  }
+  _queued.fetch_add(1, std::memory_order_release);
+  {
+    std::lock_guard lock(_sleep_mutex);
+    _wake.notify_one();
+  }
+}
+
+bool JobSystem::_try_pop(Task& task)
+{
+  if (current_system != this) { return false; }
+  auto& worker = *_workers[current_worker];
+  std::lock_guard lock(worker.mutex);
+  if (worker.tasks.empty()) { return false; }
+  task = std::move(worker.tasks.back());
+  worker.tasks.pop_back();
+  return true;
+}
+
+bool JobSystem::_try_steal(size_t thief, Task& task)
+{
+  size_t n = _workers.size();
+  for (size_t offset = 1; offset <= n; offset++) {
+    auto& victim = *_workers[(thief + offset) % n];
+    std::lock_guard lock(victim.mutex);
+    if (victim.tasks.empty()) { continue; }
+    task = std::move(victim.tasks.front());
+    victim.tasks.pop_front();
+    return true;
+  }
+  return false;
+}
+
+bool JobSystem::_run_one()
+{
+  if (_workers.empty()) { return false; }
+  Task task;
+  size_t thief = current_system == this ? current_worker : 0;
+  if (!_try_pop(task) && !_try_steal(thief, task)) { return false; }
+  _queued.fetch_sub(1, std::memory_order_relaxed);
+  task.job();
+  _finish(task.counter);
+  return true;
+}
+
+void JobSystem::_finish(JobCounter* counter)
+{
+  if (counter == nullptr) { return; }
+  // The counter may be destroyed as soon as it reads as done, so it is only
+  // touched under its lock, which its destructor also takes
+  std::vector<JobCounter::Continuation> continuations;
+  {
+    std::lock_guard lock(counter->_mutex);
+    if (counter->_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      continuations.swap(counter->_continuations);
+    }
+  }
+  for (auto& c : continuations) {
+    _push({.job = std::move(c.job), .counter = c.counter});
+  }
+}
+
+void JobSystem::_run_worker(size_t index, std::stop_token stop)
+{
+  current_system = this;
+  current_worker = index;
+  while (!stop.stop_requested()) {
+    if (_run_one()) { continue; }
+    std::unique_lock lock(_sleep_mutex);
+    _wake.wait(lock, [&] {
+      return stop.stop_requested() ||
+             _queued.load(std::memory_order_acquire) > 0;
+    });
+  }
+}
+
+} // namespace sdl
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sdl {
+
+struct JobSystem;
+
+// Counts unfinished jobs. Jobs can be scheduled to run once a counter drops
+// to zero, which is how dependencies between jobs are expressed.
+struct JobCounter {
+ public:
+  JobCounter() = default;
+
+  // Waits for a job that just finished to be done touching the counter
+  ~JobCounter() { std::lock_guard lock(_mutex); }
+
+  JobCounter(const JobCounter& other) = delete;
+  JobCounter(JobCounter&& other) = delete;
+
+  bool done() const { return _pending.load(std::memory_order_acquire) == 0; }
+
+ private:
+  friend struct JobSystem;
+
+  struct Continuation {
+    std::function<void()> job;
+    JobCounter* counter;
+  };
+
+  std::atomic<int> _pending = 0;
+
+  std::mutex _mutex;
+  std::vector<Continuation> _continuations;
+};
+
+// Fixed pool of worker threads, each with its own deque of jobs. A worker
+// pushes and pops jobs at the back of its own deque and, when it runs out,
+// steals from the front of the others. Threads that wait on a counter run
+// jobs while they wait instead of blocking, so waiting from inside a job
+// doesn't deadlock.
+struct JobSystem {
+ public:
+  using ptr = std::unique_ptr<JobSystem>;
+  using Job = std::function<void()>;
+
+  ~JobSystem();
+
+  JobSystem(const JobSystem& other) = delete;
+  JobSystem(JobSystem&& other) = delete;
+
+  // With no argument, uses one worker per hardware thread minus one, the
+  // thread calling wait() being the extra one
+  static ptr create();
+  static ptr create(int num_workers);
+
+  int num_workers() const { return int(_workers.size()); }
+
+  // Schedules a job. If given, the counter goes up now and down when the job
+  // finishes.
+  void run(Job&& job, JobCounter* counter = nullptr);
+
+  // Schedules a job to run once `dependency` is done
+  void run_after(
+    JobCounter& dependency, Job&& job, JobCounter* counter = nullptr);
+
+  // Runs jobs on the calling thread until the counter is done
+  void wait(const JobCounter& counter);
+
+  // Calls f(chunk_begin, chunk_end) over [begin, end) split in chunks of
+  // about `grain` indices and returns when they all finished
+  void parallel_for(
+    size_t begin,
+    size_t end,
+    size_t grain,
+    const std::function<void(size_t, size_t)>& f);
+
+ private:
+  struct Task {
+    Job job;
+    JobCounter* counter = nullptr;
+  };
+
+  struct Worker {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+    std::jthread thread;
+  };
+
+  explicit JobSystem(int num_workers);
+
+  void _push(Task&& task);
+  bool _try_pop(Task& task);
+  bool _try_steal(size_t thief, Task& task);
+  bool _run_one();
+  void _finish(JobCounter* counter);
+  void _run_worker(size_t index, std::stop_token stop);
+
+  std::vector<std::unique_ptr<Worker>> _workers;
+
+  // Jobs pushed from threads that aren't workers are spread round robin
+  std::atomic<size_t> _next_worker = 0;
+
+  // Number of queued jobs, workers sleep when it is zero
+  std::atomic<int> _queued = 0;
+  std::mutex _sleep_mutex;
+  std::condition_variable _wake;
+};
+
+} // namespace sdl
@@ -0,0 +1,75 @@
+#include "job_system.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
+#include "bee/testing.hpp"
+
+using std::vector;
+
+namespace sdl {
+namespace {
+
+TEST(parallel_for)
+{
+  for (int workers : {0, 1, 4}) {
+    auto jobs = JobSystem::create(workers);
+    vector<int64_t> values(100000);
+    jobs->parallel_for(0, values.size(), 1000, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; i++) { values[i] = int64_t(i) * 2; }
+    });
+    int64_t sum = std::accumulate(values.begin(), values.end(), int64_t(0));
+    P("workers:$ sum:$", workers, sum);
+  }
+}
+
+TEST(dependencies)
+{
+  auto jobs = JobSystem::create(4);
+  std::mutex mutex;
+  vector<int> order;
+  auto record = [&](int stage) {
+    std::lock_guard lock(mutex);
+    order.push_back(stage);
+  };
+
+  // Three stages of ten jobs, each stage only starts once the previous one
+  // is done
+  JobCounter first, second, third;
+  for (int i = 0; i < 10; i++) {
+    jobs->run([&] { record(1); }, &first);
+  }
+  for (int i = 0; i < 10; i++) {
+    jobs->run_after(first, [&] { record(2); }, &second);
+  }
+  for (int i = 0; i < 10; i++) {
+    jobs->run_after(second, [&] { record(3); }, &third);
+  }
+  jobs->wait(third);
+
+  bool sorted = std::is_sorted(order.begin(), order.end());
+  P("jobs:$ sorted:$", order.size(), sorted);
+}
+
+TEST(nested)
+{
+  // Jobs waiting on jobs they spawned don't deadlock, even with one worker
+  auto jobs = JobSystem::create(1);
+  std::atomic<int> leaves = 0;
+  JobCounter outer;
+  for (int i = 0; i < 8; i++) {
+    jobs->run(
+      [&] {
+        jobs->parallel_for(0, 16, 1, [&](size_t, size_t) { leaves++; });
+      },
+      &outer);
+  }
+  jobs->wait(outer);
+  P("leaves:$", leaves.load());
+}
+
+} // namespace
+} // namespace sdl
@@ -0,0 +1,78 @@
+// Builds an asset pack:
+//
+//   pack_assets <output.pack> <kind>:<name>=<file>...
+//
+// where kind is one of:
+//   image: a QOI image, stored decoded so textures can be made from it in place
+//   font:  a TTF font
+//   data:  any other file, a level for instance
+
+#include <string>
+
+#include "asset_pack.hpp"
+#include "qoi.hpp"
+
+#include "bee/file_path.hpp"
+#include "bee/file_reader.hpp"
+#include "bee/or_error.hpp"
+#include "bee/print.hpp"
+
+using std::string;
+
+namespace sdl {
+namespace {
+
+bee::OrError<> add_asset(AssetPackWriter& writer, const string& arg)
+{
+  auto colon = arg.find(':');
+  auto eq = arg.find('=');
+  if (colon == string::npos || eq == string::npos || eq < colon ||
+      eq == colon + 1) {
+    return EF("Expected <kind>:<name>=<file>, got: $", arg);
+  }
+  string kind = arg.substr(0, colon);
+  string name = arg.substr(colon + 1, eq - colon - 1);
+  bail(data, bee::FileReader::read_file(bee::FilePath(arg.substr(eq + 1))));
+
+  if (kind == "image") {
+    bail(
+      img,
+      qoi_decode({reinterpret_cast<const uint8_t*>(data.data()), data.size()}));
+    P("$: $x$x$", name, img.width, img.height, img.channels);
+    writer.add_image(
+      name,
+      RawImage(img.width, img.height, img.channels, std::move(img.pixels)));
+  } else if (kind == "font") {
+    P("$: $ bytes", name, data.size());
+    writer.add(name, AssetKind::Font, std::move(data));
+  } else if (kind == "data") {
+    P("$: $ bytes", name, data.size());
+    writer.add(name, AssetKind::Data, std::move(data));
+  } else {
+    return EF("Unknown asset kind: $", kind);
+  }
+  return bee::ok();
+}
+
+bee::OrError<> run(int argc, char* argv[])
+{
+  if (argc < 3) {
+    return EF("Usage: $ <output.pack> <kind>:<name>=<file>...", argv[0]);
+  }
+  AssetPackWriter writer;
+  for (int i = 2; i < argc; i++) { bail_unit(add_asset(writer, argv[i])); }
+  return writer.write(bee::FilePath(argv[1]));
+}
+
+} // namespace
+} // namespace sdl
+
+int main(int argc, char* argv[])
+{
+  auto ret = sdl::run(argc, argv);
+  if (ret.is_error()) {
+    PE("Error: $", ret.error());
+    return 1;
+  }
+  return 0;
+}
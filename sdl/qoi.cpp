@@ -0,0 +1,210 @@
+#include "qoi.hpp"
+
+#include <array>
+
+namespace sdl {
+
+namespace {
+
+constexpr uint8_t op_index = 0x00;
+constexpr uint8_t op_diff = 0x40;
+constexpr uint8_t op_luma = 0x80;
+constexpr uint8_t op_run = 0xc0;
+constexpr uint8_t op_rgb = 0xfe;
+constexpr uint8_t op_rgba = 0xff;
+constexpr uint8_t op_mask = 0xc0;
+
+constexpr size_t header_size = 14;
+constexpr std::array<uint8_t, 8> end_marker = {0, 0, 0, 0, 0, 0, 0, 1};
+
+// Refuses images that would take more than 400M pixels, same as the
+// reference implementation
+constexpr uint64_t max_pixels = 400'000'000;
+
+struct Pixel {
+  uint8_t r = 0;
+  uint8_t g = 0;
+  uint8_t b = 0;
+  uint8_t a = 255;
+
+  bool operator==(const Pixel& other) const = default;
+
+  int hash() const { return (r * 3 + g * 5 + b * 7 + a * 11) % 64; }
+};
+
+void write_u32(std::string& out, uint32_t v)
+{
+  out.push_back(char(v >> 24));
+  out.push_back(char(v >> 16));
+  out.push_back(char(v >> 8));
+  out.push_back(char(v));
+}
+
+uint32_t read_u32(std::span<const uint8_t> data, size_t pos)
+{
+  return uint32_t(data[pos]) << 24 | uint32_t(data[pos + 1]) << 16 |
+         uint32_t(data[pos + 2]) << 8 | uint32_t(data[pos + 3]);
+}
+
+} // namespace
+
+bee::OrError<QoiImage> qoi_decode(std::span<const uint8_t> data)
+{
+  if (data.size() < header_size + end_marker.size()) {
+    return EF("QOI data too short: $ bytes", data.size());
+  }
+  if (data[0] != 'q' || data[1] != 'o' || data[2] != 'i' || data[3] != 'f') {
+    return EF("Not QOI data");
+  }
+  uint32_t width = read_u32(data, 4);
+  uint32_t height = read_u32(data, 8);
+  int channels = data[12];
+  if (width == 0 || height == 0 || uint64_t(width) * height > max_pixels) {
+    return EF("Invalid QOI size: $x$", width, height);
+  }
+  if (channels != 3 && channels != 4) {
+    return EF("Invalid QOI channel count: $", channels);
+  }
+
+  size_t num_pixels = size_t(width) * height;
+  std::string pixels(num_pixels * channels, '\0');
+  auto out = reinterpret_cast<uint8_t*>(pixels.data());
+
+  std::array<Pixel, 64> index{};
+  Pixel px;
+  int run = 0;
+  size_t pos = header_size;
+  size_t chunks_end = data.size() - end_marker.size();
+  for (size_t i = 0; i < num_pixels; i++) {
+    if (run > 0) {
+      run--;
+    } else {
+      if (pos >= chunks_end) { return EF("Truncated QOI data"); }
+      uint8_t b1 = data[pos++];
+      if (b1 == op_rgb) {
+        if (pos + 3 > chunks_end) { return EF("Truncated QOI data"); }
+        px.r = data[pos++];
+        px.g = data[pos++];
+        px.b = data[pos++];
+      } else if (b1 == op_rgba) {
+        if (pos + 4 > chunks_end) { return EF("Truncated QOI data"); }
+        px.r = data[pos++];
+        px.g = data[pos++];
+        px.b = data[pos++];
+        px.a = data[pos++];
+      } else if ((b1 & op_mask) == op_index) {
+        px = index[b1];
+      } else if ((b1 & op_mask) == op_diff) {
+        px.r += ((b1 >> 4) & 0x03) - 2;
+        px.g += ((b1 >> 2) & 0x03) - 2;
+        px.b += (b1 & 0x03) - 2;
+      } else if ((b1 & op_mask) == op_luma) {
+        if (pos >= chunks_end) { return EF("Truncated QOI data"); }
+        uint8_t b2 = data[pos++];
+        int vg = (b1 & 0x3f) - 32;
+        px.r += vg - 8 + ((b2 >> 4) & 0x0f);
+        px.g += vg;
+        px.b += vg - 8 + (b2 & 0x0f);
+      } else {
+        run = b1 & 0x3f;
+      }
+      index[px.hash()] = px;
+    }
+
+    *out++ = px.r;
+    *out++ = px.g;
+    *out++ = px.b;
+    if (channels == 4) { *out++ = px.a; }
+  }
+
+  return QoiImage{
+    .width = int(width),
+    .height = int(height),
+    .channels = channels,
+    .pixels = std::move(pixels),
+  };
+}
+
+std::string qoi_encode(
+  int width, int height, int channels, std::string_view pixels)
+{
+  size_t num_pixels = size_t(width) * height;
+
+  std::string out;
+  out.reserve(header_size + num_pixels * (channels + 1) + end_marker.size());
+  out += "qoif";
+  write_u32(out, width);
+  write_u32(out, height);
+  out.push_back(char(channels));
+  out.push_back(0); // sRGB with linear alpha
+
+  std::array<Pixel, 64> index{};
+  Pixel prev;
+  int run = 0;
+  auto in = reinterpret_cast<const uint8_t*>(pixels.data());
+  for (size_t i = 0; i < num_pixels; i++) {
+    Pixel px{
+      .r = in[0],
+      .g = in[1],
+      .b = in[2],
+      .a = channels == 4 ? in[3] : uint8_t(255),
+    };
+    in += channels;
+
+    if (px == prev) {
+      run++;
+      if (run == 62 || i + 1 == num_pixels) {
+        out.push_back(char(op_run | (run - 1)));
+        run = 0;
+      }
+      continue;
+    }
+
+    if (run > 0) {
+      out.push_back(char(op_run | (run - 1)));
+      run = 0;
+    }
+
+    int hash = px.hash();
+    if (index[hash] == px) {
+      out.push_back(char(op_index | hash));
+    } else {
+      index[hash] = px;
+      if (px.a == prev.a) {
+        int8_t vr = int8_t(px.r - prev.r);
+        int8_t vg = int8_t(px.g - prev.g);
+        int8_t vb = int8_t(px.b - prev.b);
+        int8_t vg_r = int8_t(vr - vg);
+        int8_t vg_b = int8_t(vb - vg);
+        if (
+          vr >= -2 && vr <= 1 && vg >= -2 && vg <= 1 && vb >= -2 && vb <= 1) {
+          out.push_back(
+            char(op_diff | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2)));
+        } else if (
+          vg_r >= -8 && vg_r <= 7 && vg >= -32 && vg <= 31 && vg_b >= -8 &&
+          vg_b <= 7) {
+          out.push_back(char(op_luma | (vg + 32)));
+          out.push_back(char((vg_r + 8) << 4 | (vg_b + 8)));
+        } else {
+          out.push_back(char(op_rgb));
+          out.push_back(char(px.r));
+          out.push_back(char(px.g));
+          out.push_back(char(px.b));
+        }
+      } else {
+        out.push_back(char(op_rgba));
+        out.push_back(char(px.r));
+        out.push_back(char(px.g));
+        out.push_back(char(px.b));
+        out.push_back(char(px.a));
+      }
+    }
+    prev = px;
+  }
+
+  out.append(
+    reinterpret_cast<const char*>(end_marker.data()), end_marker.size());
+  return out;
+}
+
+} // namespace sdl
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "bee/or_error.hpp"
+
+namespace sdl {
+
+// Lossless image compression in the QOI format (https://qoiformat.org).
+// Decoding is a single pass with no allocation besides the output, which
+// makes it cheap enough to unpack embedded assets on first use.
+
+struct QoiImage {
+  int width;
+  int height;
+  int channels; // 3 or 4
+  std::string pixels;
+};
+
+bee::OrError<QoiImage> qoi_decode(std::span<const uint8_t> data);
+
+// `pixels` holds width * height * channels bytes
+std::string qoi_encode(
+  int width, int height, int channels, std::string_view pixels);
+
+} // namespace sdl
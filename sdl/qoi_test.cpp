@@ -0,0 +1,86 @@
+#include "qoi.hpp"
+
+#include <string>
+
+#include "raw_image.hpp"
+
+#include "bee/testing.hpp"
+
+namespace sdl {
+namespace {
+
+std::span<const uint8_t> bytes(const std::string& str)
+{
+  return {reinterpret_cast<const uint8_t*>(str.data()), str.size()};
+}
+
+void decode(const std::string& encoded, const std::string& pixels)
+{
+  auto decoded = qoi_decode(bytes(encoded));
+  if (decoded.is_error()) {
+    P("error: $", decoded.error());
+    return;
+  }
+  P("$x$x$ raw:$ encoded:$ same:$",
+    decoded.value().width,
+    decoded.value().height,
+    decoded.value().channels,
+    pixels.size(),
+    encoded.size(),
+    decoded.value().pixels == pixels);
+}
+
+void round_trip(int width, int height, int channels, const std::string& pixels)
+{
+  decode(qoi_encode(width, height, channels, pixels), pixels);
+}
+
+TEST(round_trip)
+{
+  round_trip(4, 4, 3, std::string(4 * 4 * 3, '\x20'));
+
+  std::string gradient;
+  for (int i = 0; i < 64; i++) {
+    gradient += char(i * 4);
+    gradient += char(255 - i * 4);
+    gradient += char(i % 8);
+    gradient += char(i < 32 ? 255 : 128);
+  }
+  round_trip(8, 8, 4, gradient);
+
+  std::string noise;
+  uint32_t state = 1;
+  for (int i = 0; i < 16 * 16 * 3; i++) {
+    state = state * 1103515245 + 12345;
+    noise += char(state >> 16);
+  }
+  round_trip(16, 16, 3, noise);
+}
+
+TEST(errors)
+{
+  std::string pixels;
+  for (int i = 0; i < 16; i++) { pixels += char(i * 37); }
+  auto encoded = qoi_encode(2, 2, 4, pixels);
+  decode(encoded.substr(0, 10), pixels);
+  decode("qoix" + encoded.substr(4), pixels);
+
+  // Drops the end marker and the last chunk
+  decode(encoded.substr(0, encoded.size() - 9), pixels);
+}
+
+TEST(embedded)
+{
+  for (auto* img : {&Images::Squares, &Images::Ascii}) {
+    const RawImage& raw = *img;
+    P("$x$x$ compressed:$ decoded:$",
+      raw.width,
+      raw.height,
+      raw.bytes_per_pixel,
+      img->compressed().size(),
+      raw.pixels().size());
+  }
+}
+
+} // namespace
+} // namespace sdl
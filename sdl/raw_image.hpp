@@ -1,19 +1,108 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
 #include <string>
 
 namespace sdl {
 
+// Pixels of an image, either borrowed from static storage or owned. Both
+// kinds are read through pixels(), and copying an owning image shares its
+// buffer instead of duplicating it.
 struct RawImage {
+ public:
+  // Borrows the pixels, which must outlive the image. Usable in constinit
+  // and constexpr initializers, so static images need no allocation.
+  constexpr RawImage(
+    int width,
+    int height,
+    int bytes_per_pixel,
+    std::span<const std::byte> pixels)
+      : width(width),
+        height(height),
+        bytes_per_pixel(bytes_per_pixel),
+        _pixels(pixels)
+  {}
+
+  // Takes ownership of the pixels without copying them
+  RawImage(int width, int height, int bytes_per_pixel, std::string&& pixels);
+
   const int width;
   const int height;
   const int bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */
-  const std::string pixel_data;
+
+  std::span<const std::byte> pixels() const { return _pixels; }
+
+  bool owns_pixels() const { return _owner != nullptr; }
+
+ private:
+  std::shared_ptr<const std::string> _owner;
+  std::span<const std::byte> _pixels;
+};
+
+// Identifies the pixels of an image, for caching what is made from them.
+// Borrowed pixels are identified by address, which is stable since they
+// outlive the image. Owned pixels can be freed and their address reused, so
+// they are identified by a hash of their content instead, which two
+// different images can share: a cache hit must be confirmed, with
+// PixelSamples for instance.
+struct RawImageKey {
+ public:
+  static RawImageKey of(const RawImage& img);
+
+  const void* address; // nullptr for owned pixels
+  uint64_t hash; // 0 for borrowed pixels
+  int width;
+  int height;
+  int bytes_per_pixel;
+
+  auto operator<=>(const RawImageKey& other) const = default;
+};
+
+// Words read at fixed spots spread over the pixels of an image. Kept next to
+// a RawImageKey they confirm a cache hit without keeping the pixels alive,
+// since a wrong match would need a hash collision that also agrees at every
+// sample.
+struct PixelSamples {
+ public:
+  static constexpr size_t count = 16;
+
+  static PixelSamples of(const RawImage& img);
+
+  std::array<uint64_t, count> words;
+
+  bool operator==(const PixelSamples& other) const = default;
+};
+
+// QOI compressed image stored in the binary. It is decoded the first time it
+// is used and stays decoded after that.
+struct EmbeddedImage {
+ public:
+  constexpr EmbeddedImage(std::span<const uint8_t> qoi) : _qoi(qoi) {}
+
+  // Thread safe, aborts if the embedded data is corrupt
+  const RawImage& get() const;
+
+  operator const RawImage&() const { return get(); }
+
+  std::span<const uint8_t> compressed() const { return _qoi; }
+
+ private:
+  std::span<const uint8_t> _qoi;
+
+  mutable std::once_flag _decoded;
+  mutable std::optional<const RawImage> _image;
 };
 
+// Generated into embedded_images.cpp by embed_images
 struct Images {
-  static RawImage Squares;
-  static RawImage Letters;
+  static const EmbeddedImage Squares;
+  static const EmbeddedImage Ascii;
 };
 
 } // namespace sdl
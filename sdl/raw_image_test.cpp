@@ -0,0 +1,79 @@
+#include "raw_image.hpp"
+
+#include <string>
+
+#include "bee/testing.hpp"
+
+using std::string;
+
+namespace sdl {
+namespace {
+
+constexpr std::byte checker[] = {
+  std::byte{0xff}, std::byte{0x00}, std::byte{0x00}, std::byte{0xff}};
+
+constinit const RawImage borrowed(2, 2, 1, checker);
+
+TEST(pixels)
+{
+  P("borrowed owns:$ size:$ same:$",
+    borrowed.owns_pixels(),
+    borrowed.pixels().size(),
+    borrowed.pixels().data() == checker);
+
+  RawImage owned(2, 1, 3, string(6, 'x'));
+  RawImage copy = owned;
+  P("owned owns:$ size:$ shared:$",
+    owned.owns_pixels(),
+    owned.pixels().size(),
+    copy.pixels().data() == owned.pixels().data());
+}
+
+TEST(key)
+{
+  RawImage owned(2, 1, 3, string(6, 'x'));
+  RawImage same(2, 1, 3, string(6, 'x'));
+  RawImage different(2, 1, 3, string(6, 'y'));
+  RawImage reshaped(1, 2, 3, string(6, 'x'));
+  auto key = RawImageKey::of(owned);
+  P("key same content:$ different content:$ different shape:$",
+    key == RawImageKey::of(same),
+    key == RawImageKey::of(different),
+    key == RawImageKey::of(reshaped));
+  P("key borrowed same:$ borrowed vs owned:$",
+    RawImageKey::of(borrowed) == RawImageKey::of(RawImage(2, 2, 1, checker)),
+    RawImageKey::of(borrowed) ==
+      RawImageKey::of(RawImage(2, 2, 1, string(4, '\x00'))));
+}
+
+TEST(samples)
+{
+  string pixels(4096, 'x');
+  RawImage owned(32, 32, 4, string(pixels));
+  auto samples = PixelSamples::of(owned);
+  P("equal content:$ copy:$",
+    samples == PixelSamples::of(RawImage(32, 32, 4, string(pixels))),
+    samples == PixelSamples::of(owned));
+
+  // The first, last and evenly spread words are read, not the ones between
+  auto changed = [&](size_t offset) {
+    string other = pixels;
+    other[offset] = 'y';
+    return samples != PixelSamples::of(RawImage(32, 32, 4, std::move(other)));
+  };
+  P("first byte:$ last byte:$ middle sample:$ between samples:$",
+    changed(0),
+    changed(4095),
+    changed(4088 * 5 / 15),
+    changed(100));
+
+  // Images smaller than a word are read whole
+  P("tiny:$ tiny different:$",
+    PixelSamples::of(RawImage(1, 1, 3, string("abc"))) ==
+      PixelSamples::of(RawImage(1, 1, 3, string("abc"))),
+    PixelSamples::of(RawImage(1, 1, 3, string("abc"))) ==
+      PixelSamples::of(RawImage(1, 1, 3, string("abd"))));
+}
+
+} // namespace
+} // namespace sdl
@@ -47,6 +47,11 @@ template <class T> struct Rect {
 
   Rect translate(const value_type& t) const { return {pos + t, size}; }
 
+  template <class U> Rect<U> cast() const
+  {
+    return {pos.template cast<U>(), size.template cast<U>()};
+  }
+
   Rect sub(const Rect& inner) const
   {
     auto other = inner.translate(pos);
@@ -0,0 +1,349 @@
+#include "rect_array.hpp"
+
+#include <algorithm>
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+namespace sdl::rect_kernels {
+
+namespace {
+
+// Each Ops struct wraps one register type with the handful of operations the
+// kernels need, so every kernel is written once. Loads are aligned, which
+// holds because the kernels only load at multiples of the register width
+// from 32 byte aligned columns.
+
+#if defined(__AVX2__)
+
+constexpr const char* kIsaName = "avx2";
+
+struct OpsInt {
+  using scalar = int;
+  using reg = __m256i;
+  static constexpr size_t width = 8;
+
+  static reg load(const int* p)
+  {
+    return _mm256_load_si256(reinterpret_cast<const __m256i*>(p));
+  }
+  static void store(int* p, reg v)
+  {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+  }
+  static reg set1(int v) { return _mm256_set1_epi32(v); }
+  static reg add(reg a, reg b) { return _mm256_add_epi32(a, b); }
+  static reg sub(reg a, reg b) { return _mm256_sub_epi32(a, b); }
+  static reg mul(reg a, reg b) { return _mm256_mullo_epi32(a, b); }
+  static reg min(reg a, reg b) { return _mm256_min_epi32(a, b); }
+  static reg max(reg a, reg b) { return _mm256_max_epi32(a, b); }
+  static reg lt(reg a, reg b) { return _mm256_cmpgt_epi32(b, a); }
+  static reg le(reg a, reg b)
+  {
+    return _mm256_xor_si256(_mm256_cmpgt_epi32(a, b), _mm256_set1_epi32(-1));
+  }
+  static reg bit_and(reg a, reg b) { return _mm256_and_si256(a, b); }
+  static uint64_t movemask(reg m)
+  {
+    return uint32_t(_mm256_movemask_ps(_mm256_castsi256_ps(m)));
+  }
+};
+
+struct OpsFloat {
+  using scalar = float;
+  using reg = __m256;
+  static constexpr size_t width = 8;
+
+  static reg load(const float* p) { return _mm256_load_ps(p); }
+  static void store(float* p, reg v) { _mm256_storeu_ps(p, v); }
+  static reg set1(float v) { return _mm256_set1_ps(v); }
+  static reg add(reg a, reg b) { return _mm256_add_ps(a, b); }
+  static reg sub(reg a, reg b) { return _mm256_sub_ps(a, b); }
+  static reg mul(reg a, reg b) { return _mm256_mul_ps(a, b); }
+  static reg min(reg a, reg b) { return _mm256_min_ps(a, b); }
+  static reg max(reg a, reg b) { return _mm256_max_ps(a, b); }
+  static reg lt(reg a, reg b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+  static reg le(reg a, reg b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+  static reg bit_and(reg a, reg b) { return _mm256_and_ps(a, b); }
+  static uint64_t movemask(reg m) { return uint32_t(_mm256_movemask_ps(m)); }
+};
+
+#elif defined(__SSE4_1__)
+
+constexpr const char* kIsaName = "sse4.1";
+
+struct OpsInt {
+  using scalar = int;
+  using reg = __m128i;
+  static constexpr size_t width = 4;
+
+  static reg load(const int* p)
+  {
+    return _mm_load_si128(reinterpret_cast<const __m128i*>(p));
+  }
+  static void store(int* p, reg v)
+  {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+  }
+  static reg set1(int v) { return _mm_set1_epi32(v); }
+  static reg add(reg a, reg b) { return _mm_add_epi32(a, b); }
+  static reg sub(reg a, reg b) { return _mm_sub_epi32(a, b); }
+  static reg mul(reg a, reg b) { return _mm_mullo_epi32(a, b); }
+  static reg min(reg a, reg b) { return _mm_min_epi32(a, b); }
+  static reg max(reg a, reg b) { return _mm_max_epi32(a, b); }
+  static reg lt(reg a, reg b) { return _mm_cmplt_epi32(a, b); }
+  static reg le(reg a, reg b)
+  {
+    return _mm_xor_si128(_mm_cmpgt_epi32(a, b), _mm_set1_epi32(-1));
+  }
+  static reg bit_and(reg a, reg b) { return _mm_and_si128(a, b); }
+  static uint64_t movemask(reg m)
+  {
+    return uint32_t(_mm_movemask_ps(_mm_castsi128_ps(m)));
+  }
+};
+
+struct OpsFloat {
+  using scalar = float;
+  using reg = __m128;
+  static constexpr size_t width = 4;
+
+  static reg load(const float* p) { return _mm_load_ps(p); }
+  static void store(float* p, reg v) { _mm_storeu_ps(p, v); }
+  static reg set1(float v) { return _mm_set1_ps(v); }
+  static reg add(reg a, reg b) { return _mm_add_ps(a, b); }
+  static reg sub(reg a, reg b) { return _mm_sub_ps(a, b); }
+  static reg mul(reg a, reg b) { return _mm_mul_ps(a, b); }
+  static reg min(reg a, reg b) { return _mm_min_ps(a, b); }
+  static reg max(reg a, reg b) { return _mm_max_ps(a, b); }
+  static reg lt(reg a, reg b) { return _mm_cmplt_ps(a, b); }
+  static reg le(reg a, reg b) { return _mm_cmple_ps(a, b); }
+  static reg bit_and(reg a, reg b) { return _mm_and_ps(a, b); }
+  static uint64_t movemask(reg m) { return uint32_t(_mm_movemask_ps(m)); }
+};
+
+#else
+
+constexpr const char* kIsaName = "scalar";
+
+// One lane wide, comparisons produce 0 or 1 and movemask is the identity
+template <class T> struct OpsScalar {
+  using scalar = T;
+  using reg = T;
+  static constexpr size_t width = 1;
+
+  static reg load(const T* p) { return *p; }
+  static void store(T* p, reg v) { *p = v; }
+  static reg set1(T v) { return v; }
+  static reg add(reg a, reg b) { return a + b; }
+  static reg sub(reg a, reg b) { return a - b; }
+  static reg mul(reg a, reg b) { return a * b; }
+  static reg min(reg a, reg b) { return std::min(a, b); }
+  static reg max(reg a, reg b) { return std::max(a, b); }
+  static reg lt(reg a, reg b) { return a < b; }
+  static reg le(reg a, reg b) { return a <= b; }
+  static reg bit_and(reg a, reg b) { return a && b; }
+  static uint64_t movemask(reg m) { return m != 0; }
+};
+
+using OpsInt = OpsScalar<int>;
+using OpsFloat = OpsScalar<float>;
+
+#endif
+
+// Scalar versions, used for the tail that doesn't fill a whole register
+
+template <class T>
+bool intersect_one(T x, T y, T w, T h, const Rect<T>& q, T qx2, T qy2)
+{
+  return x < qx2 && q.pos.x < x + w && y < qy2 && q.pos.y < y + h;
+}
+
+template <class T>
+bool contains_one(T x, T y, T w, T h, const vec2<T>& p)
+{
+  return x <= p.x && p.x < x + w && y <= p.y && p.y < y + h;
+}
+
+template <class T> T area_one(T x, T y, T w, T h, const Rect<T>& q)
+{
+  T dx = std::min(x + w, q.pos.x + q.size.x) - std::max(x, q.pos.x);
+  T dy = std::min(y + h, q.pos.y + q.size.y) - std::max(y, q.pos.y);
+  return std::max<T>(dx, 0) * std::max<T>(dy, 0);
+}
+
+template <class Ops, class T = typename Ops::scalar>
+void intersect_mask_impl(
+  const T* x,
+  const T* y,
+  const T* w,
+  const T* h,
+  size_t n,
+  const Rect<T>& q,
+  uint64_t* mask)
+{
+  constexpr size_t W = Ops::width;
+  const T qx2 = q.pos.x + q.size.x;
+  const T qy2 = q.pos.y + q.size.y;
+  const auto vqx = Ops::set1(q.pos.x);
+  const auto vqy = Ops::set1(q.pos.y);
+  const auto vqx2 = Ops::set1(qx2);
+  const auto vqy2 = Ops::set1(qy2);
+
+  size_t i = 0;
+  for (; i + W <= n; i += W) {
+    auto vx = Ops::load(x + i);
+    auto vy = Ops::load(y + i);
+    auto mx = Ops::bit_and(
+      Ops::lt(vx, vqx2), Ops::lt(vqx, Ops::add(vx, Ops::load(w + i))));
+    auto my = Ops::bit_and(
+      Ops::lt(vy, vqy2), Ops::lt(vqy, Ops::add(vy, Ops::load(h + i))));
+    // 64 is a multiple of W, so a group of bits never straddles two words
+    mask[i / 64] |= Ops::movemask(Ops::bit_and(mx, my)) << (i % 64);
+  }
+  for (; i < n; i++) {
+    if (intersect_one(x[i], y[i], w[i], h[i], q, qx2, qy2)) {
+      mask[i / 64] |= uint64_t(1) << (i % 64);
+    }
+  }
+}
+
+template <class Ops, class T = typename Ops::scalar>
+void contains_mask_impl(
+  const T* x,
+  const T* y,
+  const T* w,
+  const T* h,
+  size_t n,
+  const vec2<T>& p,
+  uint64_t* mask)
+{
+  constexpr size_t W = Ops::width;
+  const auto vpx = Ops::set1(p.x);
+  const auto vpy = Ops::set1(p.y);
+
+  size_t i = 0;
+  for (; i + W <= n; i += W) {
+    auto vx = Ops::load(x + i);
+    auto vy = Ops::load(y + i);
+    auto mx = Ops::bit_and(
+      Ops::le(vx, vpx), Ops::lt(vpx, Ops::add(vx, Ops::load(w + i))));
+    auto my = Ops::bit_and(
+      Ops::le(vy, vpy), Ops::lt(vpy, Ops::add(vy, Ops::load(h + i))));
+    mask[i / 64] |= Ops::movemask(Ops::bit_and(mx, my)) << (i % 64);
+  }
+  for (; i < n; i++) {
+    if (contains_one(x[i], y[i], w[i], h[i], p)) {
+      mask[i / 64] |= uint64_t(1) << (i % 64);
+    }
+  }
+}
+
+template <class Ops, class T = typename Ops::scalar>
+void intersection_areas_impl(
+  const T* x,
+  const T* y,
+  const T* w,
+  const T* h,
+  size_t n,
+  const Rect<T>& q,
+  T* out)
+{
+  constexpr size_t W = Ops::width;
+  const auto vqx = Ops::set1(q.pos.x);
+  const auto vqy = Ops::set1(q.pos.y);
+  const auto vqx2 = Ops::set1(q.pos.x + q.size.x);
+  const auto vqy2 = Ops::set1(q.pos.y + q.size.y);
+  const auto zero = Ops::set1(0);
+
+  size_t i = 0;
+  for (; i + W <= n; i += W) {
+    auto vx = Ops::load(x + i);
+    auto vy = Ops::load(y + i);
+    auto dx = Ops::sub(
+      Ops::min(Ops::add(vx, Ops::load(w + i)), vqx2), Ops::max(vx, vqx));
+    auto dy = Ops::sub(
+      Ops::min(Ops::add(vy, Ops::load(h + i)), vqy2), Ops::max(vy, vqy));
+    Ops::store(out + i, Ops::mul(Ops::max(dx, zero), Ops::max(dy, zero)));
+  }
+  for (; i < n; i++) { out[i] = area_one(x[i], y[i], w[i], h[i], q); }
+}
+
+} // namespace
+
+void intersect_mask(
+  const int* x,
+  const int* y,
+  const int* w,
+  const int* h,
+  size_t n,
+  const Recti& query,
+  uint64_t* mask)
+{
+  intersect_mask_impl<OpsInt>(x, y, w, h, n, query, mask);
+}
+
+void intersect_mask(
+  const float* x,
+  const float* y,
+  const float* w,
+  const float* h,
+  size_t n,
+  const Rectf& query,
+  uint64_t* mask)
+{
+  intersect_mask_impl<OpsFloat>(x, y, w, h, n, query, mask);
+}
+
+void contains_mask(
+  const int* x,
+  const int* y,
+  const int* w,
+  const int* h,
+  size_t n,
+  const vec2i& point,
+  uint64_t* mask)
+{
+  contains_mask_impl<OpsInt>(x, y, w, h, n, point, mask);
+}
+
+void contains_mask(
+  const float* x,
+  const float* y,
+  const float* w,
+  const float* h,
+  size_t n,
+  const vec2f& point,
+  uint64_t* mask)
+{
+  contains_mask_impl<OpsFloat>(x, y, w, h, n, point, mask);
+}
+
+void intersection_areas(
+  const int* x,
+  const int* y,
+  const int* w,
+  const int* h,
+  size_t n,
+  const Recti& query,
+  int* out)
+{
+  intersection_areas_impl<OpsInt>(x, y, w, h, n, query, out);
+}
+
+void intersection_areas(
+  const float* x,
+  const float* y,
+  const float* w,
+  const float* h,
+  size_t n,
+  const Rectf& query,
+  float* out)
+{
+  intersection_areas_impl<OpsFloat>(x, y, w, h, n, query, out);
+}
+
+const char* isa_name() { return kIsaName; }
+
+} // namespace sdl::rect_kernels
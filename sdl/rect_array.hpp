@@ -0,0 +1,236 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "rect.hpp"
+
+namespace sdl {
+
+template <class T, size_t Alignment> struct AlignedAllocator {
+ public:
+  using value_type = T;
+
+  template <class U> struct rebind {
+    using other = AlignedAllocator<U, Alignment>;
+  };
+
+  AlignedAllocator() = default;
+
+  template <class U>
+  AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept
+  {}
+
+  T* allocate(size_t n)
+  {
+    return static_cast<T*>(
+      ::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+  }
+
+  void deallocate(T* p, size_t) noexcept
+  {
+    ::operator delete(p, std::align_val_t(Alignment));
+  }
+
+  template <class U>
+  bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept
+  {
+    return true;
+  }
+};
+
+// Kernels over SoA columns, vectorized with AVX2 or SSE4.1 when the target
+// supports them. Semantics match Rect::intersect and Rect::contains.
+namespace rect_kernels {
+
+// Bit i of the mask is set when rect i intersects `query`. The mask must hold
+// at least (n + 63) / 64 zeroed words.
+void intersect_mask(
+  const int* x,
+  const int* y,
+  const int* w,
+  const int* h,
+  size_t n,
+  const Recti& query,
+  uint64_t* mask);
+void intersect_mask(
+  const float* x,
+  const float* y,
+  const float* w,
+  const float* h,
+  size_t n,
+  const Rectf& query,
+  uint64_t* mask);
+
+// Same layout as intersect_mask, bit i is set when rect i contains `point`
+void contains_mask(
+  const int* x,
+  const int* y,
+  const int* w,
+  const int* h,
+  size_t n,
+  const vec2i& point,
+  uint64_t* mask);
+void contains_mask(
+  const float* x,
+  const float* y,
+  const float* w,
+  const float* h,
+  size_t n,
+  const vec2f& point,
+  uint64_t* mask);
+
+// out[i] is the area of the intersection between rect i and `query`
+void intersection_areas(
+  const int* x,
+  const int* y,
+  const int* w,
+  const int* h,
+  size_t n,
+  const Recti& query,
+  int* out);
+void intersection_areas(
+  const float* x,
+  const float* y,
+  const float* w,
+  const float* h,
+  size_t n,
+  const Rectf& query,
+  float* out);
+
+// Name of the instruction set the kernels were compiled for
+const char* isa_name();
+
+} // namespace rect_kernels
+
+// Rects stored as separate x/y/w/h columns so a query can test a whole
+// vector register of rects at once
+template <class T> struct RectArray {
+ public:
+  static_assert(
+    std::is_same_v<T, int> || std::is_same_v<T, float>,
+    "RectArray only supports int and float");
+
+  using rect_type = Rect<T>;
+  using column = std::vector<T, AlignedAllocator<T, 32>>;
+
+  RectArray() = default;
+
+  template <class It> RectArray(It begin, It end)
+  {
+    for (auto it = begin; it != end; ++it) { push_back(*it); }
+  }
+
+  void push_back(const rect_type& rect)
+  {
+    _x.push_back(rect.pos.x);
+    _y.push_back(rect.pos.y);
+    _w.push_back(rect.size.x);
+    _h.push_back(rect.size.y);
+  }
+
+  void reserve(size_t size)
+  {
+    _x.reserve(size);
+    _y.reserve(size);
+    _w.reserve(size);
+    _h.reserve(size);
+  }
+
+  void clear()
+  {
+    _x.clear();
+    _y.clear();
+    _w.clear();
+    _h.clear();
+  }
+
+  size_t size() const { return _x.size(); }
+
+  bool empty() const { return _x.empty(); }
+
+  rect_type operator[](size_t idx) const
+  {
+    return {{_x[idx], _y[idx]}, {_w[idx], _h[idx]}};
+  }
+
+  void intersect_mask(
+    const rect_type& query, std::vector<uint64_t>& mask) const
+  {
+    _reset_mask(mask);
+    rect_kernels::intersect_mask(
+      _x.data(), _y.data(), _w.data(), _h.data(), size(), query, mask.data());
+  }
+
+  void contains_mask(
+    const vec2<T>& point, std::vector<uint64_t>& mask) const
+  {
+    _reset_mask(mask);
+    rect_kernels::contains_mask(
+      _x.data(), _y.data(), _w.data(), _h.data(), size(), point, mask.data());
+  }
+
+  // Indices are written in increasing order. Queries are safe to run from
+  // several threads at once.
+  void intersect_indices(
+    const rect_type& query, std::vector<uint32_t>& indices) const
+  {
+    auto& mask = _scratch_mask();
+    intersect_mask(query, mask);
+    indices_of_mask(mask, indices);
+  }
+
+  void contains_indices(
+    const vec2<T>& point, std::vector<uint32_t>& indices) const
+  {
+    auto& mask = _scratch_mask();
+    contains_mask(point, mask);
+    indices_of_mask(mask, indices);
+  }
+
+  void intersection_areas(const rect_type& query, std::vector<T>& areas) const
+  {
+    areas.resize(size());
+    rect_kernels::intersection_areas(
+      _x.data(), _y.data(), _w.data(), _h.data(), size(), query, areas.data());
+  }
+
+  static void indices_of_mask(
+    const std::vector<uint64_t>& mask, std::vector<uint32_t>& indices)
+  {
+    indices.clear();
+    for (size_t word = 0; word < mask.size(); word++) {
+      uint64_t bits = mask[word];
+      while (bits != 0) {
+        indices.push_back(uint32_t(word * 64 + std::countr_zero(bits)));
+        bits &= bits - 1;
+      }
+    }
+  }
+
+ private:
+  void _reset_mask(std::vector<uint64_t>& mask) const
+  {
+    mask.assign((size() + 63) / 64, 0);
+  }
+
+  static std::vector<uint64_t>& _scratch_mask()
+  {
+    thread_local std::vector<uint64_t> mask;
+    return mask;
+  }
+
+  column _x;
+  column _y;
+  column _w;
+  column _h;
+};
+
+using RectArrayi = RectArray<int>;
+using RectArrayf = RectArray<float>;
+
+} // namespace sdl
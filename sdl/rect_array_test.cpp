@@ -0,0 +1,134 @@
+#include "rect_array.hpp"
+
+#include <string>
+#include <vector>
+
+#include "bee/testing.hpp"
+
+using std::string;
+using std::vector;
+
+namespace sdl {
+namespace {
+
+template <class T> string join(const vector<T>& values)
+{
+  string out;
+  for (const auto& v : values) {
+    if (!out.empty()) { out += " "; }
+    out += std::to_string(v);
+  }
+  return out;
+}
+
+vector<Recti> small_rects()
+{
+  return {
+    {{0, 0}, {10, 10}},
+    {{10, 0}, {10, 10}},
+    {{5, 5}, {10, 10}},
+    {{-20, -20}, {5, 5}},
+    {{0, 20}, {30, 2}},
+    {{8, 8}, {0, 0}},
+    {{2, 2}, {2, 2}},
+    {{-5, 0}, {100, 1}},
+    {{9, 9}, {1, 1}},
+  };
+}
+
+TEST(intersect)
+{
+  vector<Recti> rects = small_rects();
+  RectArrayi arr(rects.begin(), rects.end());
+  vector<uint32_t> indices;
+  auto run = [&](const Recti& query) {
+    arr.intersect_indices(query, indices);
+    P("intersect($) -> [$]", query, join(indices));
+  };
+  run({{0, 0}, {10, 10}});
+  run({{9, 9}, {2, 2}});
+  run({{10, 10}, {10, 10}});
+  run({{-100, -100}, {1, 1}});
+}
+
+TEST(contains)
+{
+  vector<Recti> rects = small_rects();
+  RectArrayi arr(rects.begin(), rects.end());
+  vector<uint32_t> indices;
+  auto run = [&](const vec2i& point) {
+    arr.contains_indices(point, indices);
+    P("contains($, $) -> [$]", point.x, point.y, join(indices));
+  };
+  run({0, 0});
+  run({9, 9});
+  run({10, 10});
+  run({3, 0});
+}
+
+TEST(intersection_areas)
+{
+  vector<Recti> rects = small_rects();
+  RectArrayi arr(rects.begin(), rects.end());
+  vector<int> areas;
+  arr.intersection_areas({{0, 0}, {10, 10}}, areas);
+  P("int: [$]", join(areas));
+
+  RectArrayf arrf;
+  for (const auto& r : rects) {
+    arrf.push_back({r.pos.cast<float>(), r.size.cast<float>()});
+  }
+  vector<float> areasf;
+  arrf.intersection_areas({{0.5, 0.5}, {10, 10}}, areasf);
+  vector<int> quarters;
+  for (float a : areasf) { quarters.push_back(int(a * 4)); }
+  P("float, in quarters: [$]", join(quarters));
+}
+
+// Compares the kernels against Rect's own methods on sizes that exercise
+// both the vector body and the scalar tail
+TEST(matches_rect)
+{
+  uint32_t state = 12345;
+  auto next = [&](int range) {
+    state = state * 1103515245 + 12345;
+    return int((state >> 8) % uint32_t(range));
+  };
+
+  for (int n : {0, 1, 7, 8, 9, 63, 64, 65, 1000}) {
+    vector<Recti> rects;
+    for (int i = 0; i < n; i++) {
+      rects.push_back({{next(200), next(200)}, {next(40), next(40)}});
+    }
+    RectArrayi arr(rects.begin(), rects.end());
+
+    int mismatches = 0;
+    int hits = 0;
+    vector<uint64_t> mask;
+    vector<int> areas;
+    for (int q = 0; q < 50; q++) {
+      Recti query{{next(200), next(200)}, {next(60), next(60)}};
+      vec2i point{next(200), next(200)};
+
+      arr.intersect_mask(query, mask);
+      arr.intersection_areas(query, areas);
+      for (int i = 0; i < n; i++) {
+        bool bit = (mask[i / 64] >> (i % 64)) & 1;
+        hits += bit;
+        if (bit != rects[i].intersect(query)) { mismatches++; }
+        auto inter = rects[i].intersection(query);
+        if (areas[i] != inter.size.x * inter.size.y) { mismatches++; }
+      }
+
+      arr.contains_mask(point, mask);
+      for (int i = 0; i < n; i++) {
+        bool bit = (mask[i / 64] >> (i % 64)) & 1;
+        if (bit != rects[i].contains(point)) { mismatches++; }
+      }
+    }
+    P("n:$ hits:$ mismatches:$", n, hits, mismatches);
+  }
+}
+
+} // namespace
+} // namespace sdl
@@ -1,9 +1,23 @@
 #include "renderer.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "command_buffer.hpp"
 #include "sdl_error.hpp"
 #include "sdl_header.hpp"
+#include "vec2_simd.hpp"
+#include "viewport_mapping.hpp"
 #include "window.hpp"
 
+#include "bee/time.hpp"
+
 namespace sdl {
 
 namespace {
@@ -18,40 +32,102 @@ SDL_BlendMode to_sdl_blend_mode(BlendMode mode)
   }
 };
 
+// Adaptive vsync is a swap interval of -1, which SDL_RenderSetVSync rejects
+// but OpenGL contexts may accept
+bool set_adaptive_vsync(SDL_Renderer* ren)
+{
+  SDL_RendererInfo info;
+  if (SDL_GetRendererInfo(ren, &info) != 0) { return false; }
+  if (strcmp(info.name, "opengl") != 0 && strcmp(info.name, "opengles2") != 0) {
+    return false;
+  }
+  return SDL_GL_SetSwapInterval(-1) == 0;
+}
+
 struct RendererImpl final : public Renderer {
-  RendererImpl(SDL_Renderer* ren) : _ren(ren) { assert(_ren != nullptr); }
+  RendererImpl(SDL_Window* win, SDL_Renderer* ren, const Attr& attr)
+      : _win(win),
+        _ren(ren),
+        _deferred(attr.deferred),
+        _vsync(attr.present_mode != PresentMode::Immediate),
+        _dynamic_resolution(attr.dynamic_resolution),
+        _internal_size(attr.internal_size)
+  {
+    assert(_ren != nullptr);
+    if (attr.target_fps > 0) { _limiter.emplace(attr.target_fps); }
+  }
 
-  virtual ~RendererImpl() { SDL_DestroyRenderer(_ren); }
+  virtual ~RendererImpl()
+  {
+    if (_target != nullptr) { SDL_DestroyTexture(_target); }
+    SDL_DestroyRenderer(_ren);
+  }
 
   static bee::OrError<ptr> create(Window& window, const Attr& attr)
   {
-    auto ren = SDL_CreateRenderer(
-      window.sdl_window(),
-      -1,
-      SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+    if (attr.dynamic_resolution && attr.internal_size.has_value()) {
+      return EF("dynamic_resolution and internal_size are exclusive");
+    }
+    if (attr.internal_size.has_value() &&
+        (attr.internal_size->x <= 0 || attr.internal_size->y <= 0)) {
+      return EF(
+        "Invalid internal size: $x$",
+        attr.internal_size->x,
+        attr.internal_size->y);
+    }
+
+    Uint32 flags = SDL_RENDERER_ACCELERATED;
+    if (attr.present_mode != PresentMode::Immediate) {
+      flags |= SDL_RENDERER_PRESENTVSYNC;
+    }
+    if (attr.dynamic_resolution || attr.internal_size.has_value()) {
+      flags |= SDL_RENDERER_TARGETTEXTURE;
+    }
+    auto ren = SDL_CreateRenderer(window.sdl_window(), -1, flags);
     if (ren == nullptr) {
       return EF("SDL_CreateRenderer failed: $", SDL_GetError());
     }
+    if (attr.present_mode == PresentMode::Adaptive) {
+      // Keeps plain vsync when not supported
+      set_adaptive_vsync(ren);
+    }
 
     SDL_SetRenderDrawBlendMode(ren, to_sdl_blend_mode(attr.blend_mode));
 
-    return std::make_shared<RendererImpl>(ren);
+    return std::make_shared<RendererImpl>(window.sdl_window(), ren, attr);
+  }
+
+  // Includes the resolution scale, which is 1 when drawing to the output
+  Affine2 view_transform() const
+  {
+    return {_zoom * _frame_scale, _view_offset * -_frame_scale};
   }
 
   template <class T> SDL_FRect project(const T& rect)
   {
-    auto pos = rect.pos.template cast<float>() * _zoom - _view_offset;
-    return {
-      .x = pos.x,
-      .y = pos.y,
-      .w = float(rect.size.x) * _zoom,
-      .h = float(rect.size.y) * _zoom,
-    };
+    auto r = project_rect(rect);
+    return {.x = r.pos.x, .y = r.pos.y, .w = r.size.x, .h = r.size.y};
+  }
+
+  template <class T> Rectf project_rect(const T& rect)
+  {
+    return view_transform().apply(rect);
+  }
+
+  // Projects a whole batch into _projected
+  void project_rects(std::span<const Recti> rects)
+  {
+    _projected.resize(rects.size());
+    transform_rects(view_transform(), rects, _projected);
   }
 
   virtual bee::OrError<> fill_rect(
     const Color& color, const Recti& dst) override
   {
+    if (_deferred) {
+      _commands.fill(_layer, color, project_rect(dst));
+      return bee::ok();
+    }
     bail_unit_sdl(
       SDL_SetRenderDrawColor(_ren, color.r, color.g, color.b, color.a) != 0);
     auto sdl_dst_rect = project(dst);
@@ -59,6 +135,98 @@ struct RendererImpl final : public Renderer {
     return bee::ok();
   }
 
+  virtual bee::OrError<> fill_rects(
+    const Color& color, std::span<const Recti> rects) override
+  {
+    if (rects.empty()) { return bee::ok(); }
+    project_rects(rects);
+    if (_deferred) {
+      for (const auto& rect : _projected) {
+        _commands.fill(_layer, color, rect);
+      }
+      return bee::ok();
+    }
+
+    static_assert(sizeof(SDL_FRect) == sizeof(Rectf));
+    bail_unit_sdl(
+      SDL_SetRenderDrawColor(_ren, color.r, color.g, color.b, color.a) != 0);
+    bail_unit_sdl(SDL_RenderFillRectsF(
+      _ren,
+      reinterpret_cast<const SDL_FRect*>(_projected.data()),
+      int(_projected.size())));
+    return bee::ok();
+  }
+
+  virtual bee::OrError<> fill_rects(
+    std::span<const GradientRect> rects) override
+  {
+    if (rects.empty()) { return bee::ok(); }
+    if (_deferred) {
+      for (const auto& rect : rects) {
+        _commands.fill_gradient(
+          _layer, project_rect(rect.rect), rect.corners());
+      }
+      return bee::ok();
+    }
+
+    _vertices.clear();
+    _indices.clear();
+    for (const auto& rect : rects) {
+      append_quad(
+        _vertices,
+        _indices,
+        project_rect(rect.rect),
+        rect.corners(),
+        Rectf{{0, 0}, {0, 0}});
+    }
+    bail_unit_sdl(SDL_RenderGeometry(
+      _ren,
+      nullptr,
+      _vertices.data(),
+      int(_vertices.size()),
+      _indices.data(),
+      int(_indices.size())));
+    return bee::ok();
+  }
+
+  virtual bee::OrError<> fill_rects(
+    const Texture& texture, std::span<const TextureQuad> quads) override
+  {
+    if (quads.empty()) { return bee::ok(); }
+    if (_deferred) {
+      for (const auto& quad : quads) {
+        _commands.copy(
+          _layer, texture, quad.source, project_rect(quad.dest), 0);
+      }
+      return bee::ok();
+    }
+
+    const auto white = Color::white();
+    auto tex_size = texture.size().cast<float>();
+    _vertices.clear();
+    _indices.clear();
+    for (const auto& quad : quads) {
+      Rectf uv{
+        quad.source.pos.cast<float>() / tex_size,
+        quad.source.size.cast<float>() / tex_size,
+      };
+      append_quad(
+        _vertices,
+        _indices,
+        project_rect(quad.dest),
+        {white, white, white, white},
+        uv);
+    }
+    bail_unit_sdl(SDL_RenderGeometry(
+      _ren,
+      texture.sdl_texture(),
+      _vertices.data(),
+      int(_vertices.size()),
+      _indices.data(),
+      int(_indices.size())));
+    return bee::ok();
+  }
+
   virtual bee::OrError<> fill_rect(
     const Texture& tex, const vec2i& pos) override
   {
@@ -70,6 +238,11 @@ struct RendererImpl final : public Renderer {
   virtual bee::OrError<> fill_rect(
     const Texture& texture, const Recti& source, const Recti& dest) override
   {
+    if (_deferred) {
+      _commands.copy(_layer, texture, source, project_rect(dest), 0);
+      return bee::ok();
+    }
+
     SDL_Rect src_rect{
       .x = source.pos.x,
       .y = source.pos.y,
@@ -90,6 +263,11 @@ struct RendererImpl final : public Renderer {
     const Rectf& dest,
     double angle) override
   {
+    if (_deferred) {
+      _commands.copy(_layer, texture, source, project_rect(dest), angle);
+      return bee::ok();
+    }
+
     SDL_Rect src_rect{
       .x = source.pos.x,
       .y = source.pos.y,
@@ -119,17 +297,113 @@ struct RendererImpl final : public Renderer {
   bee::OrError<> fill_all(const pixel::Image& img) override
   {
     bail(tex, Texture::create_from_image(_ren, img));
-    return fill_rect(*tex, viewport());
+    // Drawn right away, on top of what was queued so far whatever the layer
+    bail_unit(_commands.flush(_ren));
+    bool deferred = std::exchange(_deferred, false);
+    auto res = fill_rect(*tex, viewport());
+    _deferred = deferred;
+    return res;
+  }
+
+  virtual bee::OrError<> present() override
+  {
+    bail_unit(_commands.flush(_ren));
+    if (_target != nullptr) {
+      // With dynamic resolution only the top left part of the target was
+      // drawn to
+      SDL_Rect src{
+        .x = 0,
+        .y = 0,
+        .w = _drawn_size.x,
+        .h = _drawn_size.y,
+      };
+      bail_unit_sdl(SDL_SetRenderTarget(_ren, nullptr));
+      if (_internal_size.has_value()) {
+        auto dest = upscaled_rect(output_size(), *_internal_size);
+        SDL_Rect dst{
+          .x = dest.pos.x,
+          .y = dest.pos.y,
+          .w = dest.size.x,
+          .h = dest.size.y,
+        };
+        // Clears the bars around the upscaled frame
+        bail_unit_sdl(SDL_SetRenderDrawColor(_ren, 0, 0, 0, 255));
+        bail_unit_sdl(SDL_RenderClear(_ren));
+        bail_unit_sdl(SDL_RenderCopy(_ren, _target, &src, &dst));
+      } else {
+        bail_unit_sdl(SDL_RenderCopy(_ren, _target, &src, nullptr));
+      }
+    }
+    bail_unit_sdl(SDL_RenderFlush(_ren));
+    _work_time = bee::Time::monotonic() - _frame_start;
+    if (_limiter.has_value()) { _limiter->wait(); }
+    auto present_start = bee::Time::monotonic();
+    SDL_RenderPresent(_ren);
+    // Without vsync the present only blocks when the GPU has fallen behind,
+    // which is work the frame caused
+    if (!_vsync) { _work_time += bee::Time::monotonic() - present_start; }
+    return bee::ok();
+  }
+
+  // Draws of the frame go to the target. For dynamic resolution it is sized
+  // to the output so that changing the scale doesn't reallocate it.
+  bee::OrError<> _bind_target()
+  {
+    auto size = _internal_size.value_or(output_size());
+    if (_target == nullptr || _target_size != size) {
+      if (_target != nullptr) { SDL_DestroyTexture(_target); }
+      _target = SDL_CreateTexture(
+        _ren,
+        SDL_PIXELFORMAT_ARGB8888,
+        SDL_TEXTUREACCESS_TARGET,
+        size.x,
+        size.y);
+      if (_target == nullptr) {
+        return EF("SDL_CreateTexture failed: $", SDL_GetError());
+      }
+      _target_size = size;
+      SDL_SetTextureBlendMode(_target, SDL_BLENDMODE_NONE);
+      SDL_SetTextureScaleMode(
+        _target,
+        _internal_size.has_value() ? SDL_ScaleModeNearest
+                                   : SDL_ScaleModeLinear);
+    }
+    _frame_scale = _dynamic_resolution ? _resolution_scale : 1.0f;
+    _drawn_size = vec2i{
+      std::max(1, int(size.x * _frame_scale)),
+      std::max(1, int(size.y * _frame_scale)),
+    };
+    bail_unit_sdl(SDL_SetRenderTarget(_ren, _target));
+    return bee::ok();
   }
 
-  virtual void present() override { SDL_RenderPresent(_ren); }
   virtual bee::OrError<> clear() override
   {
+    _frame_start = bee::Time::monotonic();
+    _commands.clear();
+    _layer = 0;
+    if (_dynamic_resolution || _internal_size.has_value()) {
+      bail_unit(_bind_target());
+    }
     bail_unit_sdl(SDL_SetRenderDrawColor(_ren, 0, 0, 0, 255));
     bail_unit_sdl(SDL_RenderClear(_ren));
     return bee::ok();
   }
 
+  virtual void set_resolution_scale(float scale) override
+  {
+    _resolution_scale = std::clamp(scale, min_resolution_scale, 1.0f);
+  }
+
+  virtual float resolution_scale() const override
+  {
+    return _resolution_scale;
+  }
+
+  virtual bee::Span frame_work_time() const override { return _work_time; }
+
+  virtual void set_layer(int layer) override { _layer = layer; }
+
   virtual void set_view(const vec2f& offset) override { _view_offset = offset; }
 
   virtual void set_zoom(float zoom) override { _zoom = zoom; }
@@ -139,11 +413,52 @@ struct RendererImpl final : public Renderer {
   virtual bee::OrError<Texture::ptr> create_texture(
     const RawImage& img) override
   {
-    return Texture::create_from_raw_image(_ren, img);
+    auto key = RawImageKey::of(img);
+    auto samples = PixelSamples::of(img);
+    {
+      std::lock_guard lock(_textures->mutex);
+      auto it = _textures->entries.find(key);
+      if (it != _textures->entries.end() && it->second.samples == samples) {
+        if (auto texture = it->second.texture.lock()) { return texture; }
+      }
+    }
+    bail(texture, Texture::create_from_raw_image(_ren, img));
+
+    // Handed out instead of the texture, so that the entry goes away with
+    // the last handle. A deferred draw holds the texture itself, which only
+    // costs a cache miss if the entry is gone before the draw.
+    Texture* raw = texture.get();
+    Texture::ptr cached(
+      raw,
+      [texture = std::move(texture),
+       weak_cache = std::weak_ptr<TextureCache>(_textures),
+       key](Texture*) mutable {
+        if (auto cache = weak_cache.lock()) {
+          std::lock_guard lock(cache->mutex);
+          auto it = cache->entries.find(key);
+          if (it != cache->entries.end() && it->second.texture.expired()) {
+            cache->entries.erase(it);
+          }
+        }
+        texture = nullptr;
+      });
+
+    // On a hash collision the newer image takes the entry over
+    std::lock_guard lock(_textures->mutex);
+    _textures->entries.insert_or_assign(
+      key, TextureCache::Entry{.samples = samples, .texture = cached});
+    return cached;
+  }
+
+  virtual bee::OrError<Texture::ptr> create_streaming_texture(
+    const vec2i& size) override
+  {
+    return Texture::create_streaming(_ren, size);
   }
 
   virtual Recti viewport() const override
   {
+    if (_internal_size.has_value()) { return {{0, 0}, *_internal_size}; }
     SDL_Rect sdl_rect;
     SDL_RenderGetViewport(_ren, &sdl_rect);
     return {{sdl_rect.x, sdl_rect.y}, {sdl_rect.w, sdl_rect.h}};
@@ -156,12 +471,69 @@ struct RendererImpl final : public Renderer {
     return {w, h};
   }
 
+  virtual vec2i window_to_viewport(const vec2i& pos) const override
+  {
+    vec2i window_size;
+    SDL_GetWindowSize(_win, &window_size.x, &window_size.y);
+    return sdl::window_to_viewport(
+      pos, window_size, output_size(), _internal_size);
+  }
+
   virtual SDL_Renderer* sdl_renderer() override { return _ren; }
 
+  virtual const FrameLimiter* frame_limiter() const override
+  {
+    return _limiter.has_value() ? &*_limiter : nullptr;
+  }
+
+  virtual FrameLimiter* frame_limiter() override
+  {
+    return _limiter.has_value() ? &*_limiter : nullptr;
+  }
+
+  SDL_Window* _win;
   SDL_Renderer* _ren;
 
   vec2f _view_offset = {0, 0};
   float _zoom = 1.0;
+
+  bool _deferred;
+  int _layer = 0;
+  CommandBuffer _commands;
+
+  std::optional<FrameLimiter> _limiter;
+  bool _vsync;
+  bee::Time _frame_start;
+  bee::Span _work_time = bee::Span::zero();
+
+  // Offscreen target for dynamic or internal resolution, _frame_scale is the
+  // scale the current frame is drawn at
+  bool _dynamic_resolution;
+  std::optional<vec2i> _internal_size;
+  SDL_Texture* _target = nullptr;
+  vec2i _target_size = {0, 0};
+  vec2i _drawn_size = {0, 0};
+  float _resolution_scale = 1.0f;
+  float _frame_scale = 1.0f;
+
+  // Scratch space for batched draws, reused across calls
+  std::vector<Rectf> _projected;
+
+  // Textures made by create_texture, whose entries are dropped along with
+  // the last handle to the texture, from whichever thread drops it. Hits on
+  // owned pixels are confirmed with samples of them, so the cache doesn't
+  // keep the pixels alive.
+  struct TextureCache {
+    struct Entry {
+      PixelSamples samples;
+      std::weak_ptr<Texture> texture;
+    };
+    std::mutex mutex;
+    std::map<RawImageKey, Entry> entries;
+  };
+  std::shared_ptr<TextureCache> _textures = std::make_shared<TextureCache>();
+  std::vector<SDL_Vertex> _vertices;
+  std::vector<int> _indices;
 };
 
 } // namespace
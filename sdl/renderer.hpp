@@ -1,13 +1,18 @@
 #pragma once
 
+#include <array>
 #include <memory>
+#include <optional>
+#include <span>
 
 #include "color.hpp"
+#include "frame_limiter.hpp"
 #include "rect.hpp"
 #include "texture.hpp"
 #include "window.hpp"
 
 #include "bee/or_error.hpp"
+#include "bee/span.hpp"
 
 namespace sdl {
 
@@ -16,19 +21,86 @@ enum class BlendMode {
   Add,
 };
 
+enum class PresentMode {
+  // Waits for the vertical blank, no tearing
+  VSync,
+
+  // Presents right away, may tear
+  Immediate,
+
+  // Waits for the vertical blank unless the frame is already late for it.
+  // Only the OpenGL backend supports it, others fall back to VSync.
+  Adaptive,
+};
+
+// A rect with one color per corner, colors are interpolated across the rect
+struct GradientRect {
+  Recti rect;
+  Color top_left;
+  Color top_right;
+  Color bottom_right;
+  Color bottom_left;
+
+  std::array<Color, 4> corners() const
+  {
+    return {top_left, top_right, bottom_right, bottom_left};
+  }
+};
+
+// A piece of a texture and where to draw it
+struct TextureQuad {
+  Recti source;
+  Recti dest;
+};
+
 struct Renderer {
  public:
   using ptr = std::shared_ptr<Renderer>;
 
   struct Attr {
     BlendMode blend_mode = BlendMode::None;
+    PresentMode present_mode = PresentMode::VSync;
+
+    // Frames per second present() is held to, unlimited when 0. Combined with
+    // VSync, the lower of the two rates wins.
+    int target_fps = 0;
+
+    // Records draws and issues them sorted and batched at present(), see
+    // CommandBuffer for the ordering guarantees. Textures drawn meanwhile are
+    // kept alive until then, so they must be owned by a Texture::ptr.
+    bool deferred = false;
+
+    // Draws into an offscreen target that present() stretches over the
+    // output, which lets set_resolution_scale() trade sharpness for fill
+    // rate. Coordinates and the viewport don't change with the scale.
+    bool dynamic_resolution = false;
+
+    // Draws at this fixed resolution, which is also the size of the
+    // viewport, then scales it by the largest whole factor that fits the
+    // output with nearest sampling and centers it. Can't be combined with
+    // dynamic_resolution.
+    std::optional<vec2i> internal_size = std::nullopt;
   };
 
+  static constexpr float min_resolution_scale = 0.25f;
+
   virtual ~Renderer();
 
   [[nodiscard]] virtual bee::OrError<> fill_rect(
     const Color& color, const Recti& rect) = 0;
 
+  // Draws all rects with a single color change and a single draw call
+  [[nodiscard]] virtual bee::OrError<> fill_rects(
+    const Color& color, std::span<const Recti> rects) = 0;
+
+  // Draws all rects with a single draw call, whatever their colors
+  [[nodiscard]] virtual bee::OrError<> fill_rects(
+    std::span<const GradientRect> rects) = 0;
+
+  // Draws all quads of the texture with a single draw call
+  [[nodiscard]] virtual bee::OrError<> fill_rects(
+    const Texture& texture, std::span<const TextureQuad> quads) = 0;
+
   [[nodiscard]] virtual bee::OrError<> fill_rect(
     const Texture& texture, const vec2i& pos) = 0;
 
@@ -46,9 +118,15 @@ struct Renderer {
 
   [[nodiscard]] virtual bee::OrError<> fill_all(const pixel::Image& img) = 0;
 
-  virtual void present() = 0;
+  // Waits for the frame limiter, if there is one, before presenting
+  virtual bee::OrError<> present() = 0;
   virtual bee::OrError<> clear() = 0;
 
+  // Draws on higher layers end up on top of draws on lower layers. Only
+  // matters in deferred mode, where draws within a layer may be reordered.
+  // clear() resets the layer to 0.
+  virtual void set_layer(int layer) = 0;
+
   virtual void set_view(const vec2f& offset) = 0;
   virtual void set_zoom(float zoom) = 0;
 
@@ -56,12 +134,40 @@ struct Renderer {
 
   virtual Recti viewport() const = 0;
 
+  // In pixels, which on high-DPI displays is more than the window size
   virtual vec2i output_size() const = 0;
 
+  // Maps a point in window coordinates, like those of mouse events, to
+  // viewport coordinates
+  virtual vec2i window_to_viewport(const vec2i& pos) const = 0;
+
   virtual SDL_Renderer* sdl_renderer() = 0;
 
+  // Fraction of the output resolution frames are drawn at, clamped to
+  // [min_resolution_scale, 1]. Takes effect at the next clear() and only
+  // with dynamic_resolution.
+  virtual void set_resolution_scale(float scale) = 0;
+  virtual float resolution_scale() const = 0;
+
+  // Time from the last clear() until its frame was handed to the driver by
+  // present(), leaving out waits for the frame limiter. SDL has no GPU
+  // timers: without vsync this includes the present, which blocks once the
+  // GPU falls behind, but with vsync the present also waits for the display
+  // and is left out, so only the CPU side of the frame is measured.
+  virtual bee::Span frame_work_time() const = 0;
+
+  // nullptr without a target frame rate
+  virtual const FrameLimiter* frame_limiter() const = 0;
+  virtual FrameLimiter* frame_limiter() = 0;
+
+  // While a texture made from the same pixels is alive, returns it instead of
+  // uploading them again
   virtual bee::OrError<Texture::ptr> create_texture(const RawImage& img) = 0;
 
+  // See Texture::create_streaming
+  virtual bee::OrError<Texture::ptr> create_streaming_texture(
+    const vec2i& size) = 0;
+
   static bee::OrError<ptr> create(Window&, const Attr& attr);
 };
 
@@ -0,0 +1,48 @@
+#include "resolution_scaler.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace sdl {
+
+ResolutionScaler::ResolutionScaler(const Options& options)
+    : _options(options), _scale(options.max_scale), _floor(options.min_scale)
+{
+  _samples.reserve(options.window);
+}
+
+float ResolutionScaler::add_frame(const bee::Span& work_time)
+{
+  _samples.push_back(work_time);
+  _total += work_time;
+  if (std::ssize(_samples) < _options.window) { return _scale; }
+
+  double average = double(_total.to_nanos()) / double(_samples.size());
+  double budget = double(_options.budget.to_nanos());
+  _samples.clear();
+  _total = bee::Span::zero();
+
+  float scale = _scale;
+  auto last_decrease = std::exchange(_last_decrease, std::nullopt);
+  if (last_decrease.has_value() &&
+      average > last_decrease->previous_average * (1.0 - _options.min_gain)) {
+    scale = last_decrease->previous_scale;
+    _floor = scale;
+    _reverts++;
+  } else if (average > budget * _options.high) {
+    scale = std::max(_scale - _options.step, _floor);
+    if (scale < _scale) {
+      _last_decrease = {.previous_scale = _scale, .previous_average = average};
+    }
+  } else if (average < budget * _options.low) {
+    scale = std::min(_scale + _options.step, _options.max_scale);
+    // Less work than before, lower scales may pay off again
+    _floor = _options.min_scale;
+  }
+  if (scale < _scale) { _decreases++; }
+  if (scale > _scale) { _increases++; }
+  _scale = scale;
+  return _scale;
+}
+
+} // namespace sdl
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "bee/span.hpp"
+
+namespace sdl {
+
+// Picks the resolution scale of the next frame from the average work time of
+// the last frames. The thresholds for scaling down and up are apart, and the
+// average starts over after every change, so the scale settles instead of
+// flipping back and forth around the budget.
+//
+// Lowering the resolution only saves GPU time, and the work time a Renderer
+// can measure may be mostly CPU time (see Renderer::frame_work_time). So a
+// decrease has to show up in the measured time: one that doesn't is taken
+// back, and the scale stays at or above that point until it goes up on its
+// own, instead of sliding down to min_scale without making frames faster.
+struct ResolutionScaler {
+ public:
+  struct Options {
+    // Work time a frame should fit in
+    bee::Span budget = bee::Span::of_micros(16667);
+
+    float min_scale = 0.5f;
+    float max_scale = 1.0f;
+    float step = 0.05f;
+
+    // The scale goes down when the average is above budget * high and up
+    // when it is below budget * low
+    double high = 0.9;
+    double low = 0.7;
+
+    // Frames averaged before each decision
+    int window = 30;
+
+    // Fraction of the average a decrease must save to be kept, 0 keeps every
+    // decrease that doesn't make frames slower
+    double min_gain = 0.02;
+  };
+
+  explicit ResolutionScaler(const Options& options);
+
+  // Returns the scale to draw the next frame at
+  float add_frame(const bee::Span& work_time);
+
+  float scale() const { return _scale; }
+
+  // How many times the scale went down and up, taking back a decrease counts
+  // as going up
+  int decreases() const { return _decreases; }
+  int increases() const { return _increases; }
+
+  // How many decreases were taken back for not saving any time
+  int reverts() const { return _reverts; }
+
+ private:
+  struct Decrease {
+    float previous_scale;
+    double previous_average;
+  };
+
+  const Options _options;
+  float _scale;
+
+  // The last decision when it was a decrease, checked by the next one
+  std::optional<Decrease> _last_decrease;
+
+  // Decreases stop here, raised when one didn't pay off
+  float _floor;
+
+  std::vector<bee::Span> _samples;
+  bee::Span _total = bee::Span::zero();
+
+  int _decreases = 0;
+  int _increases = 0;
+  int _reverts = 0;
+};
+
+} // namespace sdl
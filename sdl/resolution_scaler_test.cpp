@@ -0,0 +1,103 @@
+#include "resolution_scaler.hpp"
+
+#include <cmath>
+
+#include "bee/testing.hpp"
+
+namespace sdl {
+namespace {
+
+int percent(float scale) { return int(std::lround(scale * 100)); }
+
+TEST(adjusts_to_budget)
+{
+  ResolutionScaler scaler({
+    .budget = bee::Span::of_millis(10),
+    .min_scale = 0.5f,
+    .max_scale = 1.0f,
+    .step = 0.1f,
+    .high = 0.9,
+    .low = 0.7,
+    .window = 4,
+    // The work time doesn't depend on the scale here
+    .min_gain = 0,
+  });
+  auto run = [&](int work_ms, int windows) {
+    for (int i = 0; i < windows * 4; i++) {
+      scaler.add_frame(bee::Span::of_millis(work_ms));
+    }
+    P("work:$ms scale:$%", work_ms, percent(scaler.scale()));
+  };
+  run(5, 1);
+  run(12, 1);
+  run(12, 3);
+  run(12, 3);
+  // Between the thresholds nothing changes
+  run(8, 5);
+  run(6, 2);
+  run(1, 10);
+  P("decreases:$ increases:$", scaler.decreases(), scaler.increases());
+}
+
+ResolutionScaler::Options gain_options()
+{
+  return {
+    .budget = bee::Span::of_millis(10),
+    .min_scale = 0.5f,
+    .max_scale = 1.0f,
+    .step = 0.1f,
+    .high = 0.9,
+    .low = 0.7,
+    .window = 4,
+    .min_gain = 0.02,
+  };
+}
+
+// Work that doesn't shrink with the resolution, like a CPU bound frame
+TEST(takes_back_decreases_that_dont_help)
+{
+  ResolutionScaler scaler(gain_options());
+  auto run = [&](int work_ms) {
+    for (int i = 0; i < 4; i++) {
+      scaler.add_frame(bee::Span::of_millis(work_ms));
+    }
+    P("work:$ms scale:$% reverts:$",
+      work_ms,
+      percent(scaler.scale()),
+      scaler.reverts());
+  };
+  run(12);
+  run(12);
+  run(12);
+  run(12);
+  // Once the work goes down decreases are tried again
+  run(5);
+  run(12);
+  run(12);
+  P("decreases:$ increases:$", scaler.decreases(), scaler.increases());
+}
+
+// Work proportional to the number of pixels drawn
+TEST(keeps_decreases_that_help)
+{
+  ResolutionScaler scaler(gain_options());
+  for (int window = 0; window < 5; window++) {
+    float scale = scaler.scale();
+    auto work = bee::Span::of_micros(int64_t(12000 * scale * scale));
+    for (int i = 0; i < 4; i++) { scaler.add_frame(work); }
+    P("work:$us scale:$%", work.to_micros(), percent(scaler.scale()));
+  }
+  P("decreases:$ reverts:$", scaler.decreases(), scaler.reverts());
+}
+
+TEST(waits_for_a_full_window)
+{
+  ResolutionScaler scaler({.budget = bee::Span::of_millis(10), .window = 3});
+  for (int i = 0; i < 3; i++) {
+    P("scale:$%",
+      percent(scaler.add_frame(bee::Span::of_millis(i == 0 ? 100 : 1))));
+  }
+}
+
+} // namespace
+} // namespace sdl
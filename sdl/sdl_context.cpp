@@ -4,6 +4,7 @@
 #include "sdl_header.hpp"
 
 #include "bee/span.hpp"
+#include "bee/time.hpp"
 
 using std::nullopt;
 using std::optional;
@@ -29,6 +30,66 @@ optional<MouseButton> mouse_button_of_sdl(int sdl_button)
   return nullopt;
 }
 
+optional<Event> event_of_sdl(const SDL_Event& event)
+{
+  switch (event.type) {
+  case SDL_QUIT:
+    return Event::QuitEvent{};
+  case SDL_KEYDOWN:
+  case SDL_KEYUP:
+    return Event::KeyboardEvent{
+      .action =
+        event.type == SDL_KEYDOWN ? KeyAction::KeyDown : KeyAction::KeyUp,
+      .key = key_code_of_sdl_key(event.key.keysym.sym),
+      .repeat = event.key.repeat != 0,
+    };
+  case SDL_MOUSEBUTTONDOWN:
+  case SDL_MOUSEBUTTONUP: {
+    auto& be = event.button;
+    if (auto button = mouse_button_of_sdl(be.button)) {
+      return Event::MouseButtonEvent{
+        .action = event.type == SDL_MOUSEBUTTONDOWN
+                  ? MouseButtonAction::ButtonDown
+                  : MouseButtonAction::ButtonUp,
+        .button = *button,
+        .x = be.x,
+        .y = be.y,
+      };
+    }
+  } break;
+  case SDL_MOUSEMOTION: {
+    auto& me = event.motion;
+    return Event::MouseMotionEvent{
+      .x = me.x,
+      .y = me.y,
+      .xrel = me.xrel,
+      .yrel = me.yrel,
+    };
+  }
+  case SDL_MOUSEWHEEL: {
+    auto& ev = event.wheel;
+    return Event::MouseScrollEvent{.x = ev.x, .y = ev.y};
+  }
+  default:
+    break;
+  }
+  return nullopt;
+}
+
+// Merges events already sitting in the SDL queue into `event` for as long as
+// the filter accepts them. Events that don't translate into an `Event` would be
+// discarded by `poll_event` anyway, so they are consumed along the way.
+void coalesce_queued(EventFilter& filter, Event& event)
+{
+  SDL_Event next;
+  while (SDL_PeepEvents(
+           &next, 1, SDL_PEEKEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT) == 1) {
+    auto next_event = event_of_sdl(next);
+    if (next_event.has_value() && !filter.merge(event, *next_event)) { break; }
+    SDL_PeepEvents(&next, 1, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+  }
+}
+
 } // namespace
 
 SDLContext::~SDLContext() { SDL_Quit(); }
@@ -36,10 +97,14 @@ SDLContext::~SDLContext() { SDL_Quit(); }
 bee::OrError<SDLContext::ptr> SDLContext::create()
 {
   bail_unit_sdl(SDL_Init(SDL_INIT_EVERYTHING));
-  return ptr(new SDLContext());
+  uint32_t wake_event = SDL_RegisterEvents(1);
+  if (wake_event == uint32_t(-1)) {
+    return EF("SDL_RegisterEvents failed: $", SDL_GetError());
+  }
+  return ptr(new SDLContext(wake_event));
 }
 
-SDLContext::SDLContext() {}
+SDLContext::SDLContext(uint32_t wake_event) : _wake_event(wake_event) {}
 
 bee::OrError<optional<Event>> SDLContext::poll_event(
   const std::optional<bee::Span>& timeout)
@@ -47,54 +112,42 @@ bee::OrError<optional<Event>> SDLContext::poll_event(
   bool is_first = true;
 
   while (true) {
-    SDL_Event event;
+    SDL_Event sdl_event;
     if (is_first && timeout.has_value()) {
-      if (SDL_WaitEventTimeout(&event, timeout->to_millis()) == 0) {
+      if (SDL_WaitEventTimeout(&sdl_event, timeout->to_millis()) == 0) {
         return nullopt;
       }
     } else {
-      if (SDL_PollEvent(&event) == 0) { return nullopt; }
+      if (SDL_PollEvent(&sdl_event) == 0) { return nullopt; }
     }
     is_first = false;
-    switch (event.type) {
-    case SDL_QUIT:
-      return Event::QuitEvent{};
-      break;
-    case SDL_KEYDOWN:
-    case SDL_KEYUP:
-      return Event::KeyboardEvent{
-        .action =
-          event.type == SDL_KEYDOWN ? KeyAction::KeyDown : KeyAction::KeyUp,
-        .key = key_code_of_sdl_key(event.key.keysym.sym),
-        .repeat = event.key.repeat != 0,
-      };
-      break;
-    case SDL_MOUSEBUTTONDOWN:
-    case SDL_MOUSEBUTTONUP: {
-      auto& be = event.button;
-      if (auto button = mouse_button_of_sdl(be.button)) {
-        return Event::MouseButtonEvent{
-          .action = event.type == SDL_MOUSEBUTTONDOWN
-                    ? MouseButtonAction::ButtonDown
-                    : MouseButtonAction::ButtonUp,
-          .button = *button,
-          .x = be.x,
-          .y = be.y,
-        };
-      }
-    } break;
-    case SDL_MOUSEMOTION: {
-      auto& me = event.button;
-      return Event::MouseMotionEvent{.x = me.x, .y = me.y};
-    } break;
-    case SDL_MOUSEWHEEL: {
-      auto& ev = event.wheel;
-      return Event::MouseScrollEvent{.x = ev.x, .y = ev.y};
-    } break;
-    default:
-      break;
+    auto event = event_of_sdl(sdl_event);
+    if (!event.has_value()) { continue; }
+    event->set_timestamp(bee::Time::monotonic());
+    if (_filter.has_value()) {
+      if (!_filter->accept(*event)) { continue; }
+      coalesce_queued(*_filter, *event);
     }
+    return event;
   }
 }
 
+void SDLContext::wake()
+{
+  SDL_Event event{};
+  event.type = _wake_event;
+  SDL_PushEvent(&event);
+}
+
+void SDLContext::set_event_filter(std::optional<EventFilter>&& filter)
+{
+  _filter = std::move(filter);
+}
+
+const EventFilter* SDLContext::event_filter() const
+{
+  if (!_filter.has_value()) { return nullptr; }
+  return &*_filter;
+}
+
 } // namespace sdl
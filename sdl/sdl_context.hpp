@@ -1,29 +1,47 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <optional>
 
 #include "event.hpp"
+#include "event_filter.hpp"
+#include "event_source.hpp"
 
 #include "bee/or_error.hpp"
 #include "bee/span.hpp"
 
 namespace sdl {
 
-struct SDLContext {
+struct SDLContext final : public EventSource {
  public:
   using ptr = std::unique_ptr<SDLContext>;
-  ~SDLContext();
+  virtual ~SDLContext();
 
   SDLContext(const SDLContext& other) = delete;
   SDLContext(SDLContext&& other) = delete;
 
   static bee::OrError<ptr> create();
 
-  bee::OrError<std::optional<Event>> poll_event(
-    const std::optional<bee::Span>& timeout = std::nullopt);
+  virtual bee::OrError<std::optional<Event>> poll_event(
+    const std::optional<bee::Span>& timeout = std::nullopt) override;
+
+  // Pushes an event that ends SDL_WaitEventTimeout but isn't returned
+  virtual void wake() override;
+
+  // Installs a filter stage applied to every polled event. Consecutive queued
+  // events of a kind set to coalesce are merged into a single event.
+  void set_event_filter(std::optional<EventFilter>&& filter);
+
+  const EventFilter* event_filter() const;
 
  private:
-  SDLContext();
+  explicit SDLContext(uint32_t wake_event);
+
+  std::optional<EventFilter> _filter;
+
+  // Registered with SDL, doesn't translate to an Event
+  const uint32_t _wake_event;
 };
 
 } // namespace sdl
@@ -0,0 +1,26 @@
+#include "software_canvas.hpp"
+
+#include "sdl_header.hpp"
+
+namespace sdl {
+
+SoftwareCanvas::SoftwareCanvas(const vec2i& size)
+    : _surface(SDL_CreateRGBSurfaceWithFormat(
+        0, size.x, size.y, 32, SDL_PIXELFORMAT_RGBA8888)),
+      _ren(SDL_CreateSoftwareRenderer(_surface))
+{}
+
+SoftwareCanvas::~SoftwareCanvas()
+{
+  SDL_DestroyRenderer(_ren);
+  SDL_FreeSurface(_surface);
+}
+
+uint32_t SoftwareCanvas::pixel(int x, int y) const
+{
+  auto row =
+    reinterpret_cast<const uint8_t*>(_surface->pixels) + y * _surface->pitch;
+  return reinterpret_cast<const uint32_t*>(row)[x];
+}
+
+} // namespace sdl
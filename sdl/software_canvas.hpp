@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+#include "sdl_types.hpp"
+#include "vec2.hpp"
+
+namespace sdl {
+
+// A software renderer drawing into an RGBA8888 surface, so tests can draw
+// and upload textures without a window and read back the result
+struct SoftwareCanvas {
+ public:
+  explicit SoftwareCanvas(const vec2i& size);
+  ~SoftwareCanvas();
+
+  SoftwareCanvas(const SoftwareCanvas& other) = delete;
+
+  SDL_Renderer* ren() const { return _ren; }
+
+  // In the surface's RGBA8888 format, like Color::to_rgba32
+  uint32_t pixel(int x, int y) const;
+
+ private:
+  SDL_Surface* _surface;
+  SDL_Renderer* _ren;
+};
+
+} // namespace sdl
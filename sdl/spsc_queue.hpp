@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <utility>
+
+namespace sdl {
+
+// Bounded lock-free queue for exactly one producer thread and one consumer
+// thread. The capacity is rounded up to a power of two.
+template <class T> struct SpscQueue {
+ public:
+  explicit SpscQueue(size_t capacity)
+      : _capacity(std::bit_ceil(std::max<size_t>(capacity, 2))),
+        _mask(_capacity - 1),
+        _slots(std::make_unique<std::optional<T>[]>(_capacity))
+  {}
+
+  SpscQueue(const SpscQueue& other) = delete;
+  SpscQueue(SpscQueue&& other) = delete;
+
+  // Producer side. Returns false if the queue is full.
+  template <class U> bool try_push(U&& value)
+  {
+    auto tail = _tail.load(std::memory_order_relaxed);
+    if (tail - _cached_head == _capacity) {
+      _cached_head = _head.load(std::memory_order_acquire);
+      if (tail - _cached_head == _capacity) { return false; }
+    }
+    _slots[tail & _mask].emplace(std::forward<U>(value));
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side. Returns nullopt if the queue is empty.
+  std::optional<T> try_pop()
+  {
+    auto head = _head.load(std::memory_order_relaxed);
+    if (head == _cached_tail) {
+      _cached_tail = _tail.load(std::memory_order_acquire);
+      if (head == _cached_tail) { return std::nullopt; }
+    }
+    auto& slot = _slots[head & _mask];
+    std::optional<T> value = std::move(slot);
+    slot.reset();
+    _head.store(head + 1, std::memory_order_release);
+    return value;
+  }
+
+  // Approximate, only exact when called while neither side is active.
+  size_t size() const
+  {
+    return _tail.load(std::memory_order_acquire) -
+           _head.load(std::memory_order_acquire);
+  }
+
+  size_t capacity() const { return _capacity; }
+
+ private:
+  static constexpr size_t cache_line = 64;
+
+  const size_t _capacity;
+  const size_t _mask;
+  std::unique_ptr<std::optional<T>[]> _slots;
+
+  // Each side keeps a stale copy of the other side's index so that the shared
+  // cache line is only touched when the queue looks full or empty.
+  alignas(cache_line) std::atomic<size_t> _head = 0;
+  size_t _cached_tail = 0;
+
+  alignas(cache_line) std::atomic<size_t> _tail = 0;
+  size_t _cached_head = 0;
+};
+
+} // namespace sdl
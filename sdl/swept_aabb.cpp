@@ -0,0 +1,52 @@
+#include "swept_aabb.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace sdl {
+
+std::optional<SweepHit> sweep_aabb(
+  const Rectd& rect, const vec2d& delta, const Rectd& target)
+{
+  constexpr double inf = std::numeric_limits<double>::infinity();
+
+  // Overlap happens in the open interval (entry, exit), entry being the
+  // latest time the rects start overlapping on any single axis
+  double entry = -inf;
+  double exit = inf;
+  vec2i normal{0, 0};
+
+  for (Axis axis : {Axis::X, Axis::Y}) {
+    double lo = rect.pos.get(axis);
+    double hi = lo + rect.size.get(axis);
+    double target_lo = target.pos.get(axis);
+    double target_hi = target_lo + target.size.get(axis);
+    double d = delta.get(axis);
+
+    if (d == 0) {
+      if (hi <= target_lo || lo >= target_hi) { return std::nullopt; }
+      continue;
+    }
+
+    double axis_entry, axis_exit;
+    if (d > 0) {
+      axis_entry = (target_lo - hi) / d;
+      axis_exit = (target_hi - lo) / d;
+    } else {
+      axis_entry = (target_hi - lo) / d;
+      axis_exit = (target_lo - hi) / d;
+    }
+
+    if (axis_entry > entry) {
+      entry = axis_entry;
+      normal = {0, 0};
+      normal.get(axis) = d > 0 ? -1 : 1;
+    }
+    exit = std::min(exit, axis_exit);
+  }
+
+  if (entry >= exit || entry < 0 || entry >= 1) { return std::nullopt; }
+  return SweepHit{.time = entry, .normal = normal};
+}
+
+} // namespace sdl
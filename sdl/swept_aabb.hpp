@@ -0,0 +1,25 @@
+#pragma once
+
+#include <optional>
+
+#include "rect.hpp"
+#include "vec2.hpp"
+
+namespace sdl {
+
+struct SweepHit {
+  // Fraction of the move, in [0, 1), at which the rects start overlapping
+  double time;
+
+  // Unit normal of the face that was hit, pointing out of the target
+  vec2i normal;
+};
+
+// Continuous collision of `rect` moving by `delta` against a static `target`.
+// Returns the earliest time of impact within the move, or nullopt when the
+// rects don't start overlapping during it. Rects that already overlap don't
+// collide, so a mover can always get out, and merely touching isn't a hit.
+std::optional<SweepHit> sweep_aabb(
+  const Rectd& rect, const vec2d& delta, const Rectd& target);
+
+} // namespace sdl
@@ -0,0 +1,67 @@
+#include "swept_aabb.hpp"
+
+#include <cmath>
+
+#include "bee/testing.hpp"
+
+namespace sdl {
+namespace {
+
+void run(const Rectd& rect, const vec2d& delta, const Rectd& target)
+{
+  auto hit = sweep_aabb(rect, delta, target);
+  if (hit.has_value()) {
+    P("delta:($, $) -> time:$/1000 normal:($, $)",
+      int(delta.x),
+      int(delta.y),
+      int(std::round(hit->time * 1000)),
+      hit->normal.x,
+      hit->normal.y);
+  } else {
+    P("delta:($, $) -> no hit", int(delta.x), int(delta.y));
+  }
+}
+
+TEST(axis)
+{
+  Rectd block{{100, 0}, {10, 10}};
+  Rectd rect{{0, 0}, {10, 10}};
+  run(rect, {50, 0}, block);
+  run(rect, {90, 0}, block);
+  run(rect, {180, 0}, block);
+  run(rect, {1000, 0}, block);
+  run(rect, {-1000, 0}, block);
+  run({{200, 0}, {10, 10}}, {-180, 0}, block);
+}
+
+TEST(touching)
+{
+  Rectd ground{{0, 100}, {100, 10}};
+  // Resting on the ground and pulled down, hits right away
+  run({{10, 90}, {10, 10}}, {0, 2}, ground);
+  // Sliding along the ground doesn't hit it
+  run({{10, 90}, {10, 10}}, {20, 0}, ground);
+  // Moving away from it doesn't either
+  run({{10, 90}, {10, 10}}, {0, -2}, ground);
+}
+
+TEST(already_overlapping)
+{
+  Rectd block{{0, 0}, {10, 10}};
+  run({{5, 5}, {10, 10}}, {1, 1}, block);
+  run({{5, 5}, {10, 10}}, {-1, -1}, block);
+}
+
+TEST(diagonal)
+{
+  Rectd block{{100, 100}, {10, 10}};
+  Rectd rect{{0, 0}, {10, 10}};
+  // Hitting the corner exactly reports the x face
+  run(rect, {200, 200}, block);
+  run(rect, {200, 190}, block);
+  run(rect, {190, 200}, block);
+  run(rect, {200, 50}, block);
+}
+
+} // namespace
+} // namespace sdl
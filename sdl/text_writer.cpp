@@ -1,36 +1,116 @@
 #include "text_writer.hpp"
 
+#include <array>
+
 using std::string;
+using std::string_view;
+using std::vector;
 
 namespace sdl {
 
+namespace {
+
+// Images::Ascii has a 32x32 cell for each character from ' ' to '~', 16 to a
+// row, with the glyph starting 7 pixels into its cell. It is generated by
+// gen_ascii.py, which keeps the border of every cell transparent.
+constexpr char first_char = ' ';
+constexpr char last_char = '~';
+constexpr int cell_size = 32;
+constexpr int cells_per_row = 16;
+constexpr int glyph_inset = 7;
+
+constexpr auto glyph_table = []() {
+  std::array<TextWriter::Glyph, last_char - first_char + 1> glyphs{};
+  for (int i = 0; i < std::ssize(glyphs); i++) {
+    glyphs[i] = {
+      .source = {
+        {(i % cells_per_row) * cell_size, (i / cells_per_row) * cell_size},
+        {cell_size, cell_size},
+      },
+      .advance = TextWriter::char_advance,
+    };
+  }
+  return glyphs;
+}();
+
+} // namespace
+
 TextWriter::TextWriter(Texture::ptr&& text) : _tex(std::move(text)) {}
 
 TextWriter::~TextWriter() {}
 
-bee::OrError<> TextWriter::draw_text(
-  Renderer& ren, const vec2i& pos, const string& text)
+const TextWriter::Glyph& TextWriter::glyph(char c)
+{
+  if (c < first_char || c > last_char) { c = '?'; }
+  return glyph_table[c - first_char];
+}
+
+vector<TextureQuad> TextWriter::layout(const vec2i& pos, string_view text)
 {
-  int offset = 0;
+  vector<TextureQuad> quads;
+  quads.reserve(text.size());
+  vec2i cursor = pos;
   for (char c : text) {
-    c = tolower(c);
-    if (std::isalpha(c)) {
-      int idx = c - 'a';
-      Recti source{{idx * 32, 0}, {32, 32}};
-      Recti dest{vec2i(pos.x + offset * 18 - 7, pos.y), {32, 32}};
-      bail_unit(ren.fill_rect(*_tex, source, dest));
-      offset++;
-    } else if (isspace(c)) {
-      offset++;
+    if (c == '\n') {
+      cursor = {pos.x, cursor.y + line_height};
+      continue;
     }
+    const auto& g = glyph(c);
+    if (c != ' ') {
+      quads.push_back({
+        .source = g.source,
+        .dest = {{cursor.x - glyph_inset, cursor.y}, g.source.size},
+      });
+    }
+    cursor.x += g.advance;
   }
+  return quads;
+}
 
-  return bee::ok();
+const vector<TextureQuad>& TextWriter::_cached_layout(
+  const vec2i& pos, string_view text)
+{
+  auto it = _layouts.find(LayoutLookup{.text = text, .pos = pos});
+  if (it == _layouts.end()) {
+    if (_layouts.size() >= max_cached_layouts) {
+      std::erase_if(_layouts, [this](const auto& entry) {
+        return entry.second.last_flush + 1 < _flushes;
+      });
+      // Everything is still in use, start over rather than growing without
+      // bound
+      if (_layouts.size() >= max_cached_layouts) { _layouts.clear(); }
+    }
+    LayoutKey key{.text = string(text), .pos = pos};
+    Layout entry{.quads = layout(pos, text), .last_flush = _flushes};
+    it = _layouts.emplace(std::move(key), std::move(entry)).first;
+  }
+  it->second.last_flush = _flushes;
+  return it->second.quads;
+}
+
+void TextWriter::queue_text(const vec2i& pos, const string& text)
+{
+  const auto& quads = _cached_layout(pos, text);
+  _queued.insert(_queued.end(), quads.begin(), quads.end());
+}
+
+bee::OrError<> TextWriter::flush(Renderer& ren)
+{
+  auto res = ren.fill_rects(*_tex, _queued);
+  _queued.clear();
+  _flushes++;
+  return res;
+}
+
+bee::OrError<> TextWriter::draw_text(
+  Renderer& ren, const vec2i& pos, const string& text)
+{
+  return ren.fill_rects(*_tex, _cached_layout(pos, text));
 }
 
 bee::OrError<TextWriter::ptr> TextWriter::create(Renderer& renderer)
 {
-  bail(texture, renderer.create_texture(Images::Letters));
+  bail(texture, renderer.create_texture(Images::Ascii));
   return make_unique<TextWriter>(std::move(texture));
 }
 
@@ -1,6 +1,12 @@
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
 
 #include "renderer.hpp"
 
@@ -8,20 +14,83 @@
 
 namespace sdl {
 
+// Draws text with a monospace bitmap font covering printable ASCII. The quads
+// of each (text, position) pair are laid out once and cached, and everything
+// queued between flushes is drawn with a single draw call.
 struct TextWriter {
  public:
   using ptr = std::unique_ptr<TextWriter>;
 
+  struct Glyph {
+    Recti source;
+    int advance;
+  };
+
+  // Distance between the origins of consecutive characters and lines
+  static constexpr int char_advance = 17;
+  static constexpr int line_height = 32;
+
+  // Past this many cached layouts, those not drawn since the flush before
+  // last are dropped
+  static constexpr size_t max_cached_layouts = 256;
+
   TextWriter(Texture::ptr&& tex);
   ~TextWriter();
 
   static bee::OrError<ptr> create(Renderer& renderer);
 
+  // Characters outside of printable ASCII are drawn as '?'
+  static const Glyph& glyph(char c);
+
+  // '\n' starts a new line, spaces only advance
+  static std::vector<TextureQuad> layout(
+    const vec2i& pos, std::string_view text);
+
+  // Queues text to be drawn by the next flush
+  void queue_text(const vec2i& pos, const std::string& text);
+
+  // Draws all queued text
+  bee::OrError<> flush(Renderer& ren);
+
+  // Draws the text right away
   bee::OrError<> draw_text(
     Renderer& ren, const vec2i& pos, const std::string& text);
 
  private:
+  struct LayoutKey {
+    std::string text;
+    vec2i pos;
+  };
+
+  // Compares keys against string_view lookups, so that finding a cached
+  // layout doesn't copy the text
+  struct LayoutKeyLess {
+    using is_transparent = void;
+
+    template <class A, class B> bool operator()(const A& a, const B& b) const
+    {
+      return std::tie(a.text, a.pos) < std::tie(b.text, b.pos);
+    }
+  };
+
+  struct LayoutLookup {
+    std::string_view text;
+    vec2i pos;
+  };
+
+  struct Layout {
+    std::vector<TextureQuad> quads;
+    uint64_t last_flush;
+  };
+
+  const std::vector<TextureQuad>& _cached_layout(
+    const vec2i& pos, std::string_view text);
+
   Texture::ptr _tex;
+
+  std::map<LayoutKey, Layout, LayoutKeyLess> _layouts;
+  std::vector<TextureQuad> _queued;
+  uint64_t _flushes = 0;
 };
 
 } // namespace sdl
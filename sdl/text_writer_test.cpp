@@ -0,0 +1,87 @@
+#include "text_writer.hpp"
+
+#include <string>
+
+#include "raw_image.hpp"
+
+#include "bee/testing.hpp"
+
+using std::string;
+
+namespace sdl {
+namespace {
+
+void show_layout(const vec2i& pos, const string& text)
+{
+  auto quads = TextWriter::layout(pos, text);
+  P("quads:$", quads.size());
+  for (const auto& quad : quads) {
+    P("  source:$ dest:$", quad.source, quad.dest);
+  }
+}
+
+TEST(layout)
+{
+  show_layout({100, 50}, "ab");
+  show_layout({100, 50}, "a b");
+  show_layout({100, 50}, "a\nb");
+  show_layout({100, 50}, "\x01\xff~");
+  show_layout({100, 50}, "");
+}
+
+TEST(glyph)
+{
+  P("'?' and out of range match:$",
+    TextWriter::glyph('\x7f').source == TextWriter::glyph('?').source);
+  P("'A' source:$ advance:$",
+    TextWriter::glyph('A').source,
+    TextWriter::glyph('A').advance);
+}
+
+// Every glyph stays inside its cell, so sampling a cell with linear
+// filtering never picks up pixels of the neighbouring glyphs
+TEST(atlas_borders)
+{
+  const RawImage& img = Images::Ascii;
+  auto pixels = img.pixels();
+  auto alpha = [&](int x, int y) {
+    return uint8_t(pixels[(y * img.width + x) * img.bytes_per_pixel + 3]);
+  };
+
+  int cells = 0;
+  int blank = 0;
+  int bleeding = 0;
+  for (char c = ' '; c <= '~'; c++) {
+    auto cell = TextWriter::glyph(c).source;
+    auto min = cell.min_corner();
+    auto max = cell.max_corner() - 1;
+    bool opaque_border = false;
+    bool opaque_inside = false;
+    for (int y = min.y; y <= max.y; y++) {
+      for (int x = min.x; x <= max.x; x++) {
+        if (alpha(x, y) == 0) { continue; }
+        if (x == min.x || x == max.x || y == min.y || y == max.y) {
+          opaque_border = true;
+        } else {
+          opaque_inside = true;
+        }
+      }
+    }
+    if (opaque_border) {
+      P("'$' reaches the border of its cell", c);
+      bleeding++;
+    }
+    if (!opaque_inside) { blank++; }
+    cells++;
+  }
+  P("atlas:$x$x$ cells:$ blank:$ bleeding:$",
+    img.width,
+    img.height,
+    img.bytes_per_pixel,
+    cells,
+    blank,
+    bleeding);
+}
+
+} // namespace
+} // namespace sdl
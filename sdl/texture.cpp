@@ -1,5 +1,7 @@
 #include "texture.hpp"
 
+#include <atomic>
+
 #include "sdl_header.hpp"
 
 #include "pixel/image.hpp"
@@ -7,19 +9,41 @@
 namespace sdl {
 namespace {
 
+std::atomic<uint32_t> next_texture_id = 1;
+
 struct TextureImpl : public Texture {
  public:
   virtual ~TextureImpl() { SDL_DestroyTexture(_tex); }
 
-  TextureImpl(const vec2i& size, SDL_Texture* tex) : _size(size), _tex(tex) {}
+  TextureImpl(const vec2i& size, SDL_Texture* tex)
+      : _size(size), _tex(tex), _id(next_texture_id++)
+  {}
 
   virtual SDL_Texture* sdl_texture() const override { return _tex; }
 
   virtual const vec2i& size() const override { return _size; }
 
+  virtual uint32_t id() const override { return _id; }
+
+  virtual bee::OrError<> update(
+    const Recti& rect, const uint32_t* pixels, int pitch) override
+  {
+    SDL_Rect sdl_rect{
+      .x = rect.pos.x,
+      .y = rect.pos.y,
+      .w = rect.size.x,
+      .h = rect.size.y,
+    };
+    if (SDL_UpdateTexture(_tex, &sdl_rect, pixels, pitch * 4) != 0) {
+      return EF("Failed to update texture: $", SDL_GetError());
+    }
+    return bee::ok();
+  }
+
  private:
   const vec2i _size;
   SDL_Texture* _tex;
+  const uint32_t _id;
 };
 
 } // namespace
@@ -43,14 +67,14 @@ bee::OrError<Texture::ptr> Texture::create_from_sdl_surface(
     SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_ADD);
   }
 
-  return std::make_unique<TextureImpl>(vec2i{width, height}, texture);
+  return std::make_shared<TextureImpl>(vec2i{width, height}, texture);
 }
 
 bee::OrError<Texture::ptr> Texture::create_from_raw_image(
   SDL_Renderer* ren, const RawImage& img)
 {
   auto surface = SDL_CreateRGBSurfaceFrom(
-    (void*)img.pixel_data.data(),
+    (void*)img.pixels().data(),
     img.width,
     img.height,
     8 * img.bytes_per_pixel,
@@ -80,4 +104,20 @@ bee::OrError<Texture::ptr> Texture::create_from_image(
   return create_from_sdl_surface(ren, surface, false);
 }
 
+bee::OrError<Texture::ptr> Texture::create_streaming(
+  SDL_Renderer* ren, const vec2i& size)
+{
+  auto texture = SDL_CreateTexture(
+    ren,
+    SDL_PIXELFORMAT_RGBA8888,
+    SDL_TEXTUREACCESS_STREAMING,
+    size.x,
+    size.y);
+  if (texture == nullptr) {
+    return EF("Failed to create streaming texture: $", SDL_GetError());
+  }
+  SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+  return std::make_shared<TextureImpl>(size, texture);
+}
+
 } // namespace sdl
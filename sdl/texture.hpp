@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include "raw_image.hpp"
@@ -11,16 +12,28 @@
 
 namespace sdl {
 
-struct Texture {
+// Always owned by a ptr, which lets a deferred Renderer hold on to the
+// textures it was asked to draw until they are actually drawn
+struct Texture : public std::enable_shared_from_this<Texture> {
  public:
-  using ptr = std::unique_ptr<Texture>;
+  // Shared so that a texture made from the same pixels can be handed out
+  // again instead of uploading them twice
+  using ptr = std::shared_ptr<Texture>;
 
   virtual ~Texture();
 
   virtual const vec2i& size() const = 0;
 
+  // Unique among all textures created by the process, never 0
+  virtual uint32_t id() const = 0;
+
   virtual SDL_Texture* sdl_texture() const = 0;
 
+  // Replaces the pixels in `rect` with rows of packed RGBA8888 pixels that
+  // start `pitch` pixels apart
+  virtual bee::OrError<> update(
+    const Recti& rect, const uint32_t* pixels, int pitch) = 0;
+
   static bee::OrError<ptr> create_from_raw_image(
     SDL_Renderer* ren, const RawImage& img);
 
@@ -29,6 +42,11 @@ struct Texture {
 
   static bee::OrError<Texture::ptr> create_from_image(
     SDL_Renderer* ren, const pixel::Image& img);
+
+  // An RGBA8888 texture that blends with alpha and is meant to be updated
+  // every few frames, starts out with undefined pixels
+  static bee::OrError<ptr> create_streaming(
+    SDL_Renderer* ren, const vec2i& size);
 };
 
 } // namespace sdl
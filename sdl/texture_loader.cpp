@@ -0,0 +1,334 @@
+#include "texture_loader.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+#include "sdl_header.hpp"
+
+#include "bee/time.hpp"
+
+namespace sdl {
+
+namespace {
+
+uint32_t preferred_texture_format(SDL_Renderer* ren)
+{
+  SDL_RendererInfo info;
+  if (SDL_GetRendererInfo(ren, &info) == 0) {
+    for (uint32_t i = 0; i < info.num_texture_formats; i++) {
+      // Skip YUV formats, surfaces can't be converted to those
+      if (!SDL_ISPIXELFORMAT_FOURCC(info.texture_formats[i])) {
+        return info.texture_formats[i];
+      }
+    }
+  }
+  return SDL_PIXELFORMAT_ARGB8888;
+}
+
+} // namespace
+
+const Texture* TextureHandle::get() const
+{
+  return _slot == nullptr ? nullptr : _slot->loader->_use(*_slot);
+}
+
+const std::optional<bee::Error>& TextureHandle::error() const
+{
+  static const std::optional<bee::Error> no_error;
+  return _slot == nullptr ? no_error : _slot->error;
+}
+
+void TextureLoader::SurfaceDeleter::operator()(SDL_Surface* surface) const
+{
+  SDL_FreeSurface(surface);
+}
+
+TextureLoader::TextureLoader(
+  SDL_Renderer* ren,
+  JobSystem* jobs,
+  const Options& options,
+  uint32_t texture_format)
+    : _ren(ren), _jobs(jobs), _options(options), _texture_format(texture_format)
+{}
+
+TextureLoader::~TextureLoader()
+{
+  if (_jobs != nullptr) { _jobs->wait(_in_flight); }
+}
+
+bee::OrError<TextureLoader::ptr> TextureLoader::create(
+  Renderer& ren, JobSystem* jobs, const Options& options)
+{
+  return create(ren.sdl_renderer(), jobs, options);
+}
+
+bee::OrError<TextureLoader::ptr> TextureLoader::create(
+  Renderer& ren, JobSystem* jobs)
+{
+  return create(ren, jobs, {});
+}
+
+bee::OrError<TextureLoader::ptr> TextureLoader::create(
+  SDL_Renderer* ren, JobSystem* jobs, const Options& options)
+{
+  auto format = preferred_texture_format(ren);
+  return ptr(new TextureLoader(ren, jobs, options, format));
+}
+
+bee::OrError<TextureLoader::Converted> TextureLoader::_convert(
+  const RawImage& img) const
+{
+  // The surface only wraps the pixels, converting makes the copy the texture
+  // is uploaded from
+  SurfacePtr source(SDL_CreateRGBSurfaceFrom(
+    (void*)img.pixels().data(),
+    img.width,
+    img.height,
+    8 * img.bytes_per_pixel,
+    img.bytes_per_pixel * img.width,
+    0,
+    0,
+    0,
+    0));
+  if (source == nullptr) {
+    return EF("SDL_CreateRGBSurfaceFrom failed: $", SDL_GetError());
+  }
+  SurfacePtr converted(
+    SDL_ConvertSurfaceFormat(source.get(), _texture_format, 0));
+  if (converted == nullptr) {
+    return EF("SDL_ConvertSurfaceFormat failed: $", SDL_GetError());
+  }
+  // Same rule as Texture::create_from_raw_image
+  return Converted{
+    .surface = std::move(converted),
+    .alpha_blend = img.bytes_per_pixel == 4,
+  };
+}
+
+TextureHandle TextureLoader::_load(
+  const SourceKey& key,
+  const RawImage* image,
+  Decoder&& source,
+  bool reloadable)
+{
+  std::optional<PixelSamples> samples;
+  if (image != nullptr) { samples = PixelSamples::of(*image); }
+  auto it = _loaded.find(key);
+  if (it != _loaded.end() && it->second.samples == samples) {
+    if (auto slot = it->second.slot.lock()) { return TextureHandle(slot); }
+  }
+
+  auto handle = _create(std::move(source), reloadable);
+  std::erase_if(
+    _loaded, [](const auto& entry) { return entry.second.slot.expired(); });
+  // On a hash collision the newer image takes the entry over
+  _loaded.erase(key);
+  _loaded.emplace(key, Loaded{.samples = samples, .slot = handle._slot});
+  return handle;
+}
+
+TextureHandle TextureLoader::_create(Decoder&& source, bool reloadable)
+{
+  auto slot = std::make_shared<TextureHandle::Slot>();
+  slot->loader = this;
+  if (reloadable) { slot->source = source; }
+  _schedule(slot, std::move(source));
+  return TextureHandle(std::move(slot));
+}
+
+void TextureLoader::_schedule(
+  std::shared_ptr<TextureHandle::Slot> slot,
+  Decoder&& source,
+  bool replaces_source)
+{
+  auto job = [this, slot, replaces_source, source = std::move(source)]() {
+    auto converted = [&]() -> bee::OrError<Converted> {
+      bail(img, source());
+      return _convert(img);
+    }();
+    bool adopt = replaces_source && !converted.is_error();
+    {
+      std::lock_guard lock(_mutex);
+      _ready.push_back({
+        .slot = slot,
+        .converted = std::move(converted),
+        .source = adopt ? source : Decoder(),
+      });
+    }
+    if (_options.on_ready) { _options.on_ready(); }
+  };
+  if (_jobs != nullptr) {
+    _jobs->run(std::move(job), &_in_flight);
+  } else {
+    job();
+  }
+}
+
+TextureHandle TextureLoader::load(const RawImage& img)
+{
+  return _load(
+    RawImageKey::of(img),
+    &img,
+    [&img]() -> bee::OrError<RawImage> { return img; },
+    false);
+}
+
+TextureHandle TextureLoader::load(const EmbeddedImage& img)
+{
+  return _load(
+    std::pair<const void*, std::string>(&img, ""),
+    nullptr,
+    [&img]() -> bee::OrError<RawImage> { return img.get(); },
+    true);
+}
+
+TextureHandle TextureLoader::load(const AssetPack& pack, std::string_view name)
+{
+  return _load(
+    std::pair<const void*, std::string>(&pack, name),
+    nullptr,
+    [&pack, name = std::string(name)]() { return pack.image(name); },
+    true);
+}
+
+TextureHandle TextureLoader::load(Decoder&& decoder)
+{
+  return _create(std::move(decoder), true);
+}
+
+void TextureLoader::reload(const TextureHandle& handle, Decoder&& decoder)
+{
+  assert(handle._slot != nullptr);
+  _schedule(handle._slot, std::move(decoder), true);
+}
+
+const Texture* TextureLoader::_use(TextureHandle::Slot& slot)
+{
+  if (slot.texture != nullptr) {
+    slot.last_used = _frame;
+    _stats.hits++;
+    return slot.texture.get();
+  }
+  if (slot.loading || slot.error.has_value()) { return nullptr; }
+
+  // Evicted, decode it again
+  Decoder source;
+  {
+    std::lock_guard lock(_mutex);
+    source = slot.source;
+  }
+  _stats.misses++;
+  slot.loading = true;
+  _schedule(slot.shared_from_this(), std::move(source));
+  return nullptr;
+}
+
+void TextureLoader::_evict()
+{
+  std::vector<std::shared_ptr<TextureHandle::Slot>> slots;
+  std::erase_if(_resident, [&](const auto& weak) {
+    auto slot = weak.lock();
+    if (slot == nullptr) { return true; }
+    slots.push_back(std::move(slot));
+    return false;
+  });
+
+  size_t resident_bytes = 0;
+  int64_t resident = 0;
+  for (const auto& slot : slots) {
+    if (slot->texture == nullptr) { continue; }
+    resident_bytes += slot->bytes;
+    resident++;
+  }
+
+  if (resident_bytes > _options.max_resident_bytes) {
+    std::sort(slots.begin(), slots.end(), [](const auto& a, const auto& b) {
+      return a->last_used < b->last_used;
+    });
+    for (const auto& slot : slots) {
+      if (resident_bytes <= _options.max_resident_bytes) { break; }
+      // Anything drawn last frame is likely drawn again this one, evicting
+      // it would only make it load again
+      if (slot->last_used + 1 >= _frame) { break; }
+      if (slot->texture == nullptr || !slot->source) { continue; }
+      slot->texture.reset();
+      // Left by a reload that failed while the texture stayed, it mustn't
+      // stop the texture from loading again
+      slot->error.reset();
+      resident_bytes -= slot->bytes;
+      resident--;
+      _stats.evictions++;
+    }
+  }
+
+  _stats.resident = resident;
+  _stats.resident_bytes = resident_bytes;
+}
+
+bee::OrError<> TextureLoader::upload_pending()
+{
+  _frame++;
+  auto start = bee::Time::monotonic();
+  size_t bytes = 0;
+  while (true) {
+    std::optional<Ready> ready;
+    {
+      std::lock_guard lock(_mutex);
+      if (_ready.empty()) { break; }
+      ready.emplace(std::move(_ready.front()));
+      _ready.pop_front();
+    }
+
+    auto& slot = *ready->slot;
+    slot.loading = false;
+
+    // A failed reload leaves the previous texture in place
+    if (ready->converted.is_error()) {
+      slot.error = ready->converted.error();
+      _stats.failed++;
+      continue;
+    }
+
+    auto& converted = ready->converted.value();
+    size_t size = size_t(converted.surface->pitch) * converted.surface->h;
+    size_t pixels = size_t(converted.surface->w) * converted.surface->h;
+    // create_from_sdl_surface takes ownership of the surface
+    auto texture = Texture::create_from_sdl_surface(
+      _ren, converted.surface.release(), converted.alpha_blend);
+    if (texture.is_error()) {
+      slot.error = texture.error();
+      _stats.failed++;
+      continue;
+    }
+    // Replacing the texture of a reloaded slot is what makes every handle to
+    // it pick up the new pixels
+    slot.texture = std::move(texture.value());
+    slot.error.reset();
+    if (ready->source) {
+      std::lock_guard lock(_mutex);
+      slot.source = std::move(ready->source);
+    }
+    slot.bytes = pixels * SDL_BYTESPERPIXEL(_texture_format);
+    slot.last_used = _frame;
+    if (!slot.tracked) {
+      slot.tracked = true;
+      _resident.push_back(ready->slot);
+    }
+    _stats.uploaded++;
+    _stats.uploaded_bytes += size;
+
+    bytes += size;
+    if (bytes >= _options.upload.max_bytes) { break; }
+    if (bee::Time::monotonic() - start >= _options.upload.max_time) { break; }
+  }
+  _evict();
+  return bee::ok();
+}
+
+size_t TextureLoader::pending() const
+{
+  std::lock_guard lock(_mutex);
+  return _ready.size();
+}
+
+} // namespace sdl
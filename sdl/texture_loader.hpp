@@ -0,0 +1,238 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "asset_pack.hpp"
+#include "job_system.hpp"
+#include "raw_image.hpp"
+#include "renderer.hpp"
+#include "sdl_types.hpp"
+#include "texture.hpp"
+
+#include "bee/or_error.hpp"
+#include "bee/span.hpp"
+
+namespace sdl {
+
+struct TextureLoader;
+
+// Refers to a texture that may still be loading, or that was evicted and is
+// loading again. Handles are cheap to copy, must only be dereferenced on the
+// render thread and must not outlive their loader.
+struct TextureHandle {
+ public:
+  TextureHandle() = default;
+
+  // The texture once uploaded, nullptr before that or if loading failed.
+  // Counts as a use of the texture for eviction, and brings an evicted
+  // texture back.
+  const Texture* get() const;
+
+  bool ready() const { return _slot != nullptr && _slot->texture != nullptr; }
+
+  const std::optional<bee::Error>& error() const;
+
+ private:
+  friend struct TextureLoader;
+
+  struct Slot : std::enable_shared_from_this<Slot> {
+    Texture::ptr texture;
+    std::optional<bee::Error> error;
+
+    // Produces the pixels again after an eviction, empty when the source
+    // can't be read twice. Guarded by the loader's mutex.
+    std::function<bee::OrError<RawImage>()> source;
+
+    // Render thread only
+    TextureLoader* loader = nullptr;
+    size_t bytes = 0;
+    uint64_t last_used = 0;
+    bool loading = true;
+    bool tracked = false;
+  };
+
+  explicit TextureHandle(std::shared_ptr<Slot> slot) : _slot(std::move(slot))
+  {}
+
+  std::shared_ptr<Slot> _slot;
+};
+
+// Loads textures without stalling the render thread. Decoding and conversion
+// to the renderer's texture format happen on the job system, finished images
+// wait in a queue and upload_pending(), called at the start of a frame,
+// uploads as many as the budget allows.
+//
+// It also keeps the estimated video memory of its textures under a budget by
+// evicting the least recently drawn ones that it can decode again, which
+// happens the next time they are drawn.
+struct TextureLoader {
+ public:
+  using ptr = std::unique_ptr<TextureLoader>;
+
+  struct UploadBudget {
+    // Uploading stops once either is exceeded, but at least one texture is
+    // uploaded per frame so large ones still make progress
+    size_t max_bytes = 8 << 20;
+    bee::Span max_time = bee::Span::of_millis(2);
+  };
+
+  struct Options {
+    UploadBudget upload;
+
+    // Estimated as width * height * bytes per pixel of the texture format
+    size_t max_resident_bytes = 256 << 20;
+
+    // Called on the decoding thread once a texture is waiting to be uploaded,
+    // lets a render loop that sleeps while idle wake up for it
+    std::function<void()> on_ready;
+  };
+
+  struct Stats {
+    int64_t uploaded = 0;
+    int64_t uploaded_bytes = 0;
+    int64_t failed = 0;
+
+    // Textures in video memory and their estimated size
+    int64_t resident = 0;
+    int64_t resident_bytes = 0;
+
+    // Uses of a resident texture and of an evicted one
+    int64_t hits = 0;
+    int64_t misses = 0;
+    int64_t evictions = 0;
+  };
+
+  // Produces the pixels of a texture, runs on a worker thread
+  using Decoder = std::function<bee::OrError<RawImage>()>;
+
+  ~TextureLoader();
+
+  TextureLoader(const TextureLoader& other) = delete;
+  TextureLoader(TextureLoader&& other) = delete;
+
+  // Without a job system, decoding happens on the calling thread but uploads
+  // are still spread across frames
+  static bee::OrError<ptr> create(
+    Renderer& ren, JobSystem* jobs, const Options& options);
+  static bee::OrError<ptr> create(Renderer& ren, JobSystem* jobs);
+
+  // Uploads to a bare SDL renderer, such as a software one
+  static bee::OrError<ptr> create(
+    SDL_Renderer* ren, JobSystem* jobs, const Options& options);
+
+  // Loading the same image, pack entry or embedded image again while a handle
+  // to it is alive returns a handle to the same texture.
+
+  // The image must stay alive until the handle is ready. It isn't read again
+  // afterwards, so the texture is never evicted.
+  TextureHandle load(const RawImage& img);
+
+  // Decompresses the image on a worker the first time it is used
+  TextureHandle load(const EmbeddedImage& img);
+
+  // Uploads an image straight from the pack, which must outlive the handle
+  TextureHandle load(const AssetPack& pack, std::string_view name);
+
+  // The decoder is kept to bring the texture back after an eviction. Every
+  // call makes a new texture.
+  TextureHandle load(Decoder&& decoder);
+
+  // Decodes new pixels for a texture that is already loaded, every handle to
+  // it switches to them once uploaded and keeps the old ones if decoding
+  // fails. The decoder only replaces the one used after an eviction once it
+  // succeeded. Can be called from any thread.
+  void reload(const TextureHandle& handle, Decoder&& decoder);
+
+  // Render thread only, starts a frame for the purpose of eviction
+  bee::OrError<> upload_pending();
+
+  size_t pending() const;
+
+  const Stats& stats() const { return _stats; }
+
+ private:
+  friend struct TextureHandle;
+
+  struct SurfaceDeleter {
+    void operator()(SDL_Surface* surface) const;
+  };
+  using SurfacePtr = std::unique_ptr<SDL_Surface, SurfaceDeleter>;
+
+  struct Converted {
+    SurfacePtr surface;
+    bool alpha_blend;
+  };
+
+  struct Ready {
+    std::shared_ptr<TextureHandle::Slot> slot;
+    bee::OrError<Converted> converted;
+
+    // Set by a successful reload, becomes the source of the slot
+    Decoder source;
+  };
+
+  TextureLoader(
+    SDL_Renderer* ren,
+    JobSystem* jobs,
+    const Options& options,
+    uint32_t texture_format);
+
+  // Identifies where a texture comes from, so loading the same source again
+  // shares the texture
+  using SourceKey =
+    std::variant<RawImageKey, std::pair<const void*, std::string>>;
+
+  // Samples of `image` confirm a hit when the key is a RawImageKey
+  TextureHandle _load(
+    const SourceKey& key,
+    const RawImage* image,
+    Decoder&& source,
+    bool reloadable);
+  TextureHandle _create(Decoder&& source, bool reloadable);
+  void _schedule(
+    std::shared_ptr<TextureHandle::Slot> slot,
+    Decoder&& source,
+    bool replaces_source = false);
+
+  bee::OrError<Converted> _convert(const RawImage& img) const;
+
+  // Called by TextureHandle::get()
+  const Texture* _use(TextureHandle::Slot& slot);
+
+  void _evict();
+
+  SDL_Renderer* _ren;
+  JobSystem* _jobs;
+  const Options _options;
+  const uint32_t _texture_format;
+
+  // Render thread only
+  struct Loaded {
+    std::optional<PixelSamples> samples;
+    std::weak_ptr<TextureHandle::Slot> slot;
+  };
+  std::map<SourceKey, Loaded> _loaded;
+  uint64_t _frame = 0;
+  std::vector<std::weak_ptr<TextureHandle::Slot>> _resident;
+
+  JobCounter _in_flight;
+
+  mutable std::mutex _mutex;
+  std::deque<Ready> _ready;
+
+  Stats _stats;
+};
+
+} // namespace sdl
@@ -0,0 +1,176 @@
+#include "texture_loader.hpp"
+
+#include <string>
+
+#include "software_canvas.hpp"
+
+#include "bee/testing.hpp"
+
+using std::string;
+
+namespace sdl {
+namespace {
+
+// Each texture is 8x8 with 4 bytes per pixel in the software renderer's
+// formats, so 256 bytes of the resident budget
+constexpr int image_size = 8;
+constexpr size_t texture_bytes = image_size * image_size * 4;
+
+RawImage make_image(char fill)
+{
+  return RawImage(
+    image_size, image_size, 4, string(image_size * image_size * 4, fill));
+}
+
+// Counts how many times it decodes, and fails while `broken` is set
+TextureLoader::Decoder counting_decoder(
+  char fill, int* calls, const bool* broken = nullptr)
+{
+  return [=]() -> bee::OrError<RawImage> {
+    (*calls)++;
+    if (broken != nullptr && *broken) { return EF("Can't decode '$'", fill); }
+    return make_image(fill);
+  };
+}
+
+bee::OrError<TextureLoader::ptr> create_loader(
+  SDL_Renderer* ren, size_t max_resident_bytes)
+{
+  TextureLoader::Options options;
+  options.max_resident_bytes = max_resident_bytes;
+  return TextureLoader::create(ren, nullptr, options);
+}
+
+void show_stats(const TextureLoader& loader)
+{
+  const auto& stats = loader.stats();
+  P("uploaded:$ failed:$ resident:$ hits:$ misses:$ evictions:$",
+    stats.uploaded,
+    stats.failed,
+    stats.resident,
+    stats.hits,
+    stats.misses,
+    stats.evictions);
+}
+
+TEST(dedupe)
+{
+  SoftwareCanvas canvas({16, 16});
+  must(loader, create_loader(canvas.ren(), 16 * texture_bytes));
+
+  auto owned = make_image('a');
+  auto same = make_image('a');
+  auto different = make_image('b');
+  auto a1 = loader->load(owned);
+  auto a2 = loader->load(same);
+  auto b = loader->load(different);
+  auto s1 = loader->load(Images::Squares);
+  auto s2 = loader->load(Images::Squares);
+  P("pending:$ ready before upload:$", loader->pending(), a1.ready());
+
+  must_unit(loader->upload_pending());
+  P("same content shares:$ different content shares:$",
+    a1.get() == a2.get(),
+    a1.get() == b.get());
+  P("embedded image shares:$", s1.get() != nullptr && s1.get() == s2.get());
+
+  // Once every handle is gone the next load makes a new texture
+  a1 = {};
+  a2 = {};
+  auto a3 = loader->load(owned);
+  P("pending after handles dropped:$", loader->pending());
+  show_stats(*loader);
+}
+
+TEST(lru_eviction)
+{
+  SoftwareCanvas canvas({16, 16});
+  must(loader, create_loader(canvas.ren(), 2 * texture_bytes));
+
+  int a_calls = 0;
+  int b_calls = 0;
+  int c_calls = 0;
+  auto a = loader->load(counting_decoder('a', &a_calls));
+  auto b = loader->load(counting_decoder('b', &b_calls));
+  auto c = loader->load(counting_decoder('c', &c_calls));
+  auto show = [&]() {
+    P("ready a:$ b:$ c:$ decoded a:$ b:$ c:$",
+      a.ready(),
+      b.ready(),
+      c.ready(),
+      a_calls,
+      b_calls,
+      c_calls);
+    show_stats(*loader);
+  };
+
+  // Over budget, but everything was just uploaded and nothing is evicted
+  must_unit(loader->upload_pending());
+  show();
+
+  // Still nothing drawn for more than a frame
+  must_unit(loader->upload_pending());
+  show();
+
+  // c is the least recently drawn
+  a.get();
+  b.get();
+  must_unit(loader->upload_pending());
+  show();
+
+  // Drawing c brings it back, then a is the least recently drawn
+  P("evicted texture:$", c.get() == nullptr);
+  must_unit(loader->upload_pending());
+  show();
+}
+
+TEST(reload)
+{
+  SoftwareCanvas canvas({16, 16});
+  must(loader, create_loader(canvas.ren(), texture_bytes));
+
+  int calls = 0;
+  int new_calls = 0;
+  bool broken = false;
+  auto handle = loader->load(counting_decoder('a', &calls));
+  must_unit(loader->upload_pending());
+  auto original = handle.get();
+
+  // A failing reload keeps the previous texture
+  broken = true;
+  loader->reload(handle, counting_decoder('b', &new_calls, &broken));
+  must_unit(loader->upload_pending());
+  P("after failed reload: error:$ kept texture:$",
+    handle.error().has_value(),
+    handle.get() == original);
+
+  // Evicted by another texture, then it comes back from the decoder that
+  // last succeeded instead of staying stuck on the error
+  int other_calls = 0;
+  auto other = loader->load(counting_decoder('c', &other_calls));
+  must_unit(loader->upload_pending());
+  must_unit(loader->upload_pending());
+  P("evicted:$ error:$", !handle.ready(), handle.error().has_value());
+  handle.get();
+  must_unit(loader->upload_pending());
+  P("back:$ error:$ decoded:$ new decoder:$",
+    handle.ready(),
+    handle.error().has_value(),
+    calls,
+    new_calls);
+
+  // A successful reload switches every handle to the new pixels and
+  // replaces the decoder used after an eviction
+  broken = false;
+  loader->reload(handle, counting_decoder('b', &new_calls, &broken));
+  must_unit(loader->upload_pending());
+  P("after reload: ready:$ error:$ decoded:$ new decoder:$",
+    handle.ready(),
+    handle.error().has_value(),
+    calls,
+    new_calls);
+  show_stats(*loader);
+}
+
+} // namespace
+} // namespace sdl
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace sdl {
+
+// Lock-free hand-off of the latest value from one writer thread to one reader
+// thread. The writer fills the back buffer and publishes it, the reader picks
+// up the most recently published buffer. Neither side ever waits for the
+// other, and values published while the reader is busy are simply skipped.
+template <class T> struct TripleBuffer {
+ public:
+  TripleBuffer() {}
+
+  TripleBuffer(const TripleBuffer& other) = delete;
+  TripleBuffer(TripleBuffer&& other) = delete;
+
+  // Writer side
+
+  T& back() { return _buffers[_back]; }
+
+  void publish()
+  {
+    auto prev = _middle.exchange(_back | fresh_bit, std::memory_order_acq_rel);
+    _back = prev & index_mask;
+  }
+
+  // Reader side
+
+  // Makes the latest published value the front buffer. Returns false if
+  // nothing was published since the previous call.
+  bool consume()
+  {
+    if ((_middle.load(std::memory_order_relaxed) & fresh_bit) == 0) {
+      return false;
+    }
+    auto prev = _middle.exchange(_front, std::memory_order_acq_rel);
+    _front = prev & index_mask;
+    return true;
+  }
+
+  const T& front() const { return _buffers[_front]; }
+
+ private:
+  static constexpr uint8_t index_mask = 0x3;
+  static constexpr uint8_t fresh_bit = 0x4;
+
+  std::array<T, 3> _buffers;
+
+  uint8_t _back = 0;
+  std::atomic<uint8_t> _middle = 1;
+  uint8_t _front = 2;
+};
+
+} // namespace sdl
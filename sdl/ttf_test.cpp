@@ -1,5 +1,12 @@
 #include "font.hpp"
 
+#include <cstring>
+#include <string>
+
+#include "asset_pack.hpp"
+#include "font_locator.hpp"
+
+#include "bee/file_reader.hpp"
 #include "bee/testing.hpp"
 
 namespace sdl {
@@ -12,6 +19,31 @@ TEST(init)
   P(font->info().style);
 }
 
+// The system font, read from a pack entry in place
+TEST(packed)
+{
+  must_unit(TTF::init());
+  must(info, FontLocator::find_font());
+  must(ttf, bee::FileReader::read_file(info.file_path));
+
+  AssetPackWriter writer;
+  writer.add("font", AssetKind::Font, ttf);
+  writer.add("level", AssetKind::Data, "not a font");
+  must(buffer, writer.serialize());
+  must(pack, AssetPack::of_buffer(std::move(buffer)));
+
+  must(data, pack->blob("font", AssetKind::Font));
+  P("same bytes:$",
+    data.size() == ttf.size() &&
+      std::memcmp(data.data(), ttf.data(), ttf.size()) == 0);
+  must(font, Font::create_from_memory("font", data, 24));
+  P("name:$", font->info().name);
+
+  must(level, pack->blob("level", AssetKind::Data));
+  P("not a font: error:$",
+    Font::create_from_memory("level", level, 24).is_error());
+}
+
 } // namespace
 
 } // namespace sdl
@@ -0,0 +1,151 @@
+#include "vec2_simd.hpp"
+
+#include <cassert>
+
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace sdl {
+
+namespace {
+
+// vec2f and Rectf are read and written as packed floats, Recti as packed ints
+static_assert(sizeof(vec2f) == 2 * sizeof(float));
+static_assert(sizeof(Rectf) == 4 * sizeof(float));
+static_assert(sizeof(Recti) == 4 * sizeof(int));
+
+const float* floats_of(const auto* p)
+{
+  return reinterpret_cast<const float*>(p);
+}
+
+float* floats_of(auto* p) { return reinterpret_cast<float*>(p); }
+
+const int* ints_of(const Recti* p) { return reinterpret_cast<const int*>(p); }
+
+// Transforms `n` groups of 4 floats, either a rect (x, y, w, h) or two points
+// (x, y, x, y), with a per-lane offset. Multiplies then adds, same as
+// Affine2::apply.
+template <class Load>
+void transform_lanes(
+  size_t n,
+  float scale,
+  const float (&offset)[4],
+  Load&& load,
+  float* out)
+{
+  size_t i = 0;
+#if defined(__AVX__)
+  const __m256 vscale = _mm256_set1_ps(scale);
+  const __m256 voffset = _mm256_setr_ps(
+    offset[0],
+    offset[1],
+    offset[2],
+    offset[3],
+    offset[0],
+    offset[1],
+    offset[2],
+    offset[3]);
+  for (; i + 2 <= n; i += 2) {
+    __m256 v = load.avx(i);
+    v = _mm256_add_ps(_mm256_mul_ps(v, vscale), voffset);
+    _mm256_storeu_ps(out + i * 4, v);
+  }
+#endif
+#if defined(__SSE2__)
+  const __m128 sscale = _mm_set1_ps(scale);
+  const __m128 soffset =
+    _mm_setr_ps(offset[0], offset[1], offset[2], offset[3]);
+  for (; i < n; i++) {
+    __m128 v = load.sse(i);
+    v = _mm_add_ps(_mm_mul_ps(v, sscale), soffset);
+    _mm_storeu_ps(out + i * 4, v);
+  }
+#endif
+  for (; i < n; i++) {
+    for (size_t lane = 0; lane < 4; lane++) {
+      out[i * 4 + lane] = load.scalar(i, lane) * scale + offset[lane];
+    }
+  }
+}
+
+struct LoadFloats {
+  const float* in;
+
+#if defined(__AVX__)
+  __m256 avx(size_t i) const { return _mm256_loadu_ps(in + i * 4); }
+#endif
+#if defined(__SSE2__)
+  __m128 sse(size_t i) const { return _mm_loadu_ps(in + i * 4); }
+#endif
+  float scalar(size_t i, size_t lane) const { return in[i * 4 + lane]; }
+};
+
+struct LoadInts {
+  const int* in;
+
+#if defined(__AVX__)
+  __m256 avx(size_t i) const
+  {
+    return _mm256_cvtepi32_ps(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i * 4)));
+  }
+#endif
+#if defined(__SSE2__)
+  __m128 sse(size_t i) const
+  {
+    return _mm_cvtepi32_ps(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 4)));
+  }
+#endif
+  float scalar(size_t i, size_t lane) const
+  {
+    return float(in[i * 4 + lane]);
+  }
+};
+
+} // namespace
+
+void transform_points(
+  const Affine2& t, std::span<const vec2f> in, std::span<vec2f> out)
+{
+  assert(out.size() >= in.size());
+  const float offset[4] = {t.offset.x, t.offset.y, t.offset.x, t.offset.y};
+  size_t pairs = in.size() / 2;
+  transform_lanes(
+    pairs,
+    t.scale,
+    offset,
+    LoadFloats{floats_of(in.data())},
+    floats_of(out.data()));
+  if (in.size() % 2 != 0) { out[in.size() - 1] = t.apply(in.back()); }
+}
+
+void transform_rects(
+  const Affine2& t, std::span<const Rectf> in, std::span<Rectf> out)
+{
+  assert(out.size() >= in.size());
+  const float offset[4] = {t.offset.x, t.offset.y, 0, 0};
+  transform_lanes(
+    in.size(),
+    t.scale,
+    offset,
+    LoadFloats{floats_of(in.data())},
+    floats_of(out.data()));
+}
+
+void transform_rects(
+  const Affine2& t, std::span<const Recti> in, std::span<Rectf> out)
+{
+  assert(out.size() >= in.size());
+  const float offset[4] = {t.offset.x, t.offset.y, 0, 0};
+  transform_lanes(
+    in.size(),
+    t.scale,
+    offset,
+    LoadInts{ints_of(in.data())},
+    floats_of(out.data()));
+}
+
+} // namespace sdl
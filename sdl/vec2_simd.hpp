@@ -0,0 +1,37 @@
+#pragma once
+
+#include <span>
+
+#include "rect.hpp"
+#include "vec2.hpp"
+
+namespace sdl {
+
+// Uniform scale followed by a translation: p * scale + offset. Sizes are only
+// scaled.
+struct Affine2 {
+  float scale = 1.0f;
+  vec2f offset = {0, 0};
+
+  vec2f apply(const vec2f& p) const { return p * scale + offset; }
+
+  template <class T> Rectf apply(const Rect<T>& rect) const
+  {
+    return {
+      apply(rect.pos.template cast<float>()),
+      rect.size.template cast<float>() * scale,
+    };
+  }
+};
+
+// Batch versions of Affine2::apply, vectorized with AVX or SSE when the
+// target supports them. `out` must be at least as long as `in`, ints are
+// converted to float in the same pass.
+void transform_points(
+  const Affine2& t, std::span<const vec2f> in, std::span<vec2f> out);
+void transform_rects(
+  const Affine2& t, std::span<const Rectf> in, std::span<Rectf> out);
+void transform_rects(
+  const Affine2& t, std::span<const Recti> in, std::span<Rectf> out);
+
+} // namespace sdl
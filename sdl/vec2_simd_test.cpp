@@ -0,0 +1,96 @@
+#include "vec2_simd.hpp"
+
+#include <vector>
+
+#include "bee/testing.hpp"
+
+using std::vector;
+
+namespace sdl {
+namespace {
+
+// Covers empty input, the scalar tail, the SSE tail after a whole number of
+// AVX iterations and a mix of all three
+const vector<size_t> lengths = {0, 1, 3, 7, 8, 9, 17};
+
+const Affine2 transform = {.scale = 1.75f, .offset = {-3.5f, 120.25f}};
+
+// Fractions that don't round the same way in every order of operations, so
+// a lane that skipped the multiply or added the wrong offset shows up
+float value(size_t i, int lane) { return float(i) * 1.3f - 7.1f * lane; }
+
+// Written after the end of the output, must come out untouched
+const vec2f point_sentinel = {-1234.5f, 5678.25f};
+const Rectf rect_sentinel = {{-1234.5f, 5678.25f}, {9.5f, 10.5f}};
+
+bool same(const vec2f& a, const vec2f& b) { return a.x == b.x && a.y == b.y; }
+
+bool same(const Rectf& a, const Rectf& b)
+{
+  return same(a.pos, b.pos) && same(a.size, b.size);
+}
+
+TEST(transform_points)
+{
+  for (size_t n : lengths) {
+    vector<vec2f> in;
+    for (size_t i = 0; i < n; i++) { in.push_back({value(i, 0), value(i, 1)}); }
+    vector<vec2f> out(n + 1, point_sentinel);
+    transform_points(transform, in, out);
+
+    int mismatches = 0;
+    for (size_t i = 0; i < n; i++) {
+      if (!same(out[i], transform.apply(in[i]))) { mismatches++; }
+    }
+    P("n:$ mismatches:$ sentinel kept:$",
+      n,
+      mismatches,
+      same(out[n], point_sentinel));
+  }
+}
+
+TEST(transform_rectfs)
+{
+  for (size_t n : lengths) {
+    vector<Rectf> in;
+    for (size_t i = 0; i < n; i++) {
+      in.push_back({{value(i, 0), value(i, 1)}, {value(i, 2), value(i, 3)}});
+    }
+    vector<Rectf> out(n + 1, rect_sentinel);
+    transform_rects(transform, in, out);
+
+    int mismatches = 0;
+    for (size_t i = 0; i < n; i++) {
+      if (!same(out[i], transform.apply(in[i]))) { mismatches++; }
+    }
+    P("n:$ mismatches:$ sentinel kept:$",
+      n,
+      mismatches,
+      same(out[n], rect_sentinel));
+  }
+}
+
+TEST(transform_rectis)
+{
+  for (size_t n : lengths) {
+    vector<Recti> in;
+    for (size_t i = 0; i < n; i++) {
+      int v = int(i) * 37 - 300;
+      in.push_back({{v, -v}, {int(i) + 1, 2 * int(i)}});
+    }
+    vector<Rectf> out(n + 1, rect_sentinel);
+    transform_rects(transform, in, out);
+
+    int mismatches = 0;
+    for (size_t i = 0; i < n; i++) {
+      if (!same(out[i], transform.apply(in[i]))) { mismatches++; }
+    }
+    P("n:$ mismatches:$ sentinel kept:$",
+      n,
+      mismatches,
+      same(out[n], rect_sentinel));
+  }
+}
+
+} // namespace
+} // namespace sdl
@@ -0,0 +1,36 @@
+#include "viewport_mapping.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace sdl {
+
+Recti upscaled_rect(const vec2i& output_size, const vec2i& internal_size)
+{
+  int factor = std::max(
+    1,
+    std::min(
+      output_size.x / internal_size.x, output_size.y / internal_size.y));
+  auto size = internal_size * factor;
+  return {(output_size - size) / 2, size};
+}
+
+vec2i window_to_viewport(
+  const vec2i& pos,
+  const vec2i& window_size,
+  const vec2i& output_size,
+  const std::optional<vec2i>& internal_size)
+{
+  vec2f p = pos.cast<float>();
+  if (window_size.x > 0 && window_size.y > 0) {
+    p = p * output_size.cast<float>() / window_size.cast<float>();
+  }
+  if (internal_size.has_value()) {
+    auto dest = upscaled_rect(output_size, *internal_size);
+    float factor = float(dest.size.x / internal_size->x);
+    p = (p - dest.pos.cast<float>()) / factor;
+  }
+  return {int(std::floor(p.x)), int(std::floor(p.y))};
+}
+
+} // namespace sdl
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <optional>
+
+#include "rect.hpp"
+#include "vec2.hpp"
+
+namespace sdl {
+
+// Where a frame of `internal_size` goes on the output: scaled by the largest
+// whole factor that fits, but at least 1, and centered. When the output is
+// smaller than the frame the position is negative and the frame is cropped.
+Recti upscaled_rect(const vec2i& output_size, const vec2i& internal_size);
+
+// Maps a point in window coordinates to the viewport. On high-DPI displays
+// the output has more pixels than the window has coordinates. With an
+// internal size the point is then mapped into the upscaled frame, so points
+// in the bars around it fall outside the viewport.
+vec2i window_to_viewport(
+  const vec2i& pos,
+  const vec2i& window_size,
+  const vec2i& output_size,
+  const std::optional<vec2i>& internal_size);
+
+} // namespace sdl
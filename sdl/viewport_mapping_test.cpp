@@ -0,0 +1,83 @@
+#include "viewport_mapping.hpp"
+
+#include <optional>
+#include <vector>
+
+#include "bee/testing.hpp"
+
+using std::vector;
+
+namespace sdl {
+namespace {
+
+void show_mapping(
+  const vec2i& window_size,
+  const vec2i& output_size,
+  const std::optional<vec2i>& internal_size,
+  const vector<vec2i>& points)
+{
+  for (const auto& pos : points) {
+    auto p = window_to_viewport(pos, window_size, output_size, internal_size);
+    P("  $,$ -> $,$", pos.x, pos.y, p.x, p.y);
+  }
+}
+
+void show_upscaled(const vec2i& output_size, const vec2i& internal_size)
+{
+  P("output:$x$ internal:$x$ upscaled:$",
+    output_size.x,
+    output_size.y,
+    internal_size.x,
+    internal_size.y,
+    upscaled_rect(output_size, internal_size));
+}
+
+TEST(upscaled_rect)
+{
+  // Exact fit
+  show_upscaled({960, 540}, {320, 180});
+  // Leftover on one axis only, bars on the sides
+  show_upscaled({1280, 540}, {320, 180});
+  // Leftover on both axes, factor picked by the tighter one
+  show_upscaled({1000, 700}, {320, 180});
+  // Smaller than the frame, drawn at 1x and cropped
+  show_upscaled({200, 100}, {320, 180});
+  show_upscaled({321, 100}, {320, 180});
+}
+
+TEST(window_to_viewport)
+{
+  P("Without internal size");
+  show_mapping({800, 600}, {800, 600}, std::nullopt, {{0, 0}, {799, 599}});
+
+  P("High-DPI at 2x");
+  show_mapping({800, 600}, {1600, 1200}, std::nullopt, {{0, 0}, {400, 300}});
+
+  P("Letterboxed, factor 2 with bars of 20 and 10 output pixels");
+  show_mapping(
+    {680, 380},
+    {680, 380},
+    vec2i{320, 180},
+    {{20, 10}, {21, 11}, {659, 369}, {340, 190}});
+
+  P("In the bars");
+  show_mapping(
+    {680, 380}, {680, 380}, vec2i{320, 180}, {{0, 0}, {19, 190}, {660, 369}});
+
+  P("High-DPI at 2x and letterboxed, factor 4");
+  show_mapping(
+    {680, 380},
+    {1360, 760},
+    vec2i{320, 180},
+    {{20, 10}, {340, 190}, {659, 369}, {10, 5}});
+
+  P("Output smaller than the frame, factor 1 and negative offset");
+  show_mapping(
+    {200, 100}, {200, 100}, vec2i{320, 180}, {{0, 0}, {100, 50}, {199, 99}});
+
+  P("Minimized window");
+  show_mapping({0, 0}, {0, 0}, std::nullopt, {{5, 5}});
+}
+
+} // namespace
+} // namespace sdl
@@ -17,7 +17,10 @@ struct WindowImpl final : public Window {
   virtual SDL_Window* sdl_window() override { return _win; }
 
   static bee::OrError<ptr> create(
-    const SDLContext&, const std::string& title, const vec2i& size)
+    const SDLContext&,
+    const std::string& title,
+    const vec2i& size,
+    const Attr& attr)
   {
     auto win = SDL_CreateWindow(
       title.c_str(),
@@ -25,7 +28,8 @@ struct WindowImpl final : public Window {
       SDL_WINDOWPOS_CENTERED,
       size.x,
       size.y,
-      SDL_WINDOW_SHOWN | SDL_WINDOW_ALLOW_HIGHDPI | SDL_WINDOW_RESIZABLE |
+      (attr.hidden ? SDL_WINDOW_HIDDEN : SDL_WINDOW_SHOWN) |
+        SDL_WINDOW_ALLOW_HIGHDPI | SDL_WINDOW_RESIZABLE |
         SDL_WINDOW_ALWAYS_ON_TOP);
     if (win == nullptr) {
       return bee::Error::fmt("SDL_CreateWindow failed: $", SDL_GetError());
@@ -83,7 +87,16 @@ Window::~Window() {}
 bee::OrError<Window::ptr> Window::create(
   const SDLContext& ctx, const std::string& title, const vec2i& size)
 {
-  return WindowImpl::create(ctx, title, size);
+  return create(ctx, title, size, Attr{});
+}
+
+bee::OrError<Window::ptr> Window::create(
+  const SDLContext& ctx,
+  const std::string& title,
+  const vec2i& size,
+  const Attr& attr)
+{
+  return WindowImpl::create(ctx, title, size, attr);
 }
 
 } // namespace sdl
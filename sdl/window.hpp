@@ -15,11 +15,23 @@ struct Window {
  public:
   using ptr = std::unique_ptr<Window>;
 
+  struct Attr {
+    // Hidden windows can still be rendered to, which is useful to run
+    // benchmarks and replays without stealing focus
+    bool hidden = false;
+  };
+
   virtual ~Window();
 
   static bee::OrError<ptr> create(
     const SDLContext& ctx, const std::string& title, const vec2i& size);
 
+  static bee::OrError<ptr> create(
+    const SDLContext& ctx,
+    const std::string& title,
+    const vec2i& size,
+    const Attr& attr);
+
   virtual SDL_Window* sdl_window() = 0;
 
   virtual vec2i size() const = 0;